@@ -0,0 +1,154 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include <hayai/hayai.hpp>
+
+#include <libcjel-ir/libcjel-ir>
+
+using namespace libcjel_ir;
+
+static const u32 STATEMENTS = 100000;
+
+static Module::Ptr create( u8 options )
+{
+    auto module = libstdhl::Memory::make< Module >( "benchmark", options );
+
+    auto t = libstdhl::Memory::get< BitType >( 32 );
+
+    auto function = module->make< Function >(
+        "f",
+        libstdhl::Memory::make< RelationType >(
+            std::vector< Type::Ptr >{ t }, std::vector< Type::Ptr >{ t } ) );
+
+    auto a = module->make< Reference >( "a", t, Reference::INPUT );
+    function->add( a );
+
+    auto r = module->make< Reference >( "r", t, Reference::OUTPUT );
+    function->add( r );
+
+    auto scope = module->make< SequentialScope >();
+    function->setContext( scope );
+
+    for( u32 c = 0; c < STATEMENTS; c++ )
+    {
+        auto stmt = module->make< TrivialStatement >();
+
+        auto load = stmt->add( module->make< LoadInstruction >( a ) );
+        auto add = stmt->add(
+            module->make< AddUnsignedInstruction >( load, module->make< BitConstant >( t, c ) ) );
+        stmt->add( module->make< StoreInstruction >( add, r ) );
+
+        scope->add( stmt );
+    }
+
+    module->add( function );
+
+    return module;
+}
+
+template < u8 OPTIONS >
+class ModuleFixture : public ::hayai::Fixture
+{
+  public:
+    void SetUp( void ) override
+    {
+        module = create( OPTIONS );
+    }
+
+    void TearDown( void ) override
+    {
+        module = nullptr;
+    }
+
+    Module::Ptr module;
+};
+
+using SharedModule = ModuleFixture< Module::NONE >;
+using ArenaModule = ModuleFixture< Module::ARENA >;
+
+BENCHMARK( libcjel_ir__arena, construct_shared, 10, 1 )
+{
+    auto module = create( Module::NONE );
+}
+
+BENCHMARK( libcjel_ir__arena, construct_arena, 10, 1 )
+{
+    auto module = create( Module::ARENA );
+}
+
+BENCHMARK( libcjel_ir__arena, construct_arena_index, 10, 1 )
+{
+    auto module = create( Module::ARENA | Module::INDEX );
+}
+
+BENCHMARK_F( SharedModule, iterate, 10, 10 )
+{
+    u64 count = 0;
+    module->iterate( Traversal::PREORDER, [&count]( Value& ) { count++; } );
+}
+
+BENCHMARK_F( ArenaModule, iterate, 10, 10 )
+{
+    u64 count = 0;
+    module->iterate( Traversal::PREORDER, [&count]( Value& ) { count++; } );
+}
+
+BENCHMARK_F( SharedModule, traverse, 10, 10 )
+{
+    u64 count = 0;
+    Traverser::iterate( *module, Traversal::PREORDER, [&count]( Value& ) { count++; } );
+}
+
+BENCHMARK_F( ArenaModule, traverse, 10, 10 )
+{
+    u64 count = 0;
+    Traverser::iterate( *module, Traversal::PREORDER, [&count]( Value& ) { count++; } );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
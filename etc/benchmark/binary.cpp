@@ -0,0 +1,123 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+
+#include "main.h"
+
+#include <cstdio>
+
+using namespace libcjel_ir_benchmark;
+
+/**
+   encodes the generated module into a temporary file once, every run opens
+   (maps and validates) it, the module benchmarks materialize the opened
+   binary into a fresh arena module
+*/
+
+template < u64 INSTRUCTIONS >
+class BinaryFixture : public ::hayai::Fixture
+{
+  public:
+    void SetUp( void ) override
+    {
+        binary = Binary::open( filename() );
+    }
+
+    void TearDown( void ) override
+    {
+        binary = nullptr;
+    }
+
+    static const std::string& filename( void )
+    {
+        static const std::string obj = []( void ) {
+            const auto result =
+                "/tmp/libcjel_ir__binary_" + std::to_string( INSTRUCTIONS ) + ".cjelir";
+            const auto buffer = CjelIRToBinaryPass::encode( *create( INSTRUCTIONS ) );
+
+            auto file = fopen( result.c_str(), "wb" );
+            if( not file or fwrite( buffer.data(), 1, buffer.size(), file ) != buffer.size() )
+            {
+                throw std::domain_error( "unable to write '" + result + "'" );
+            }
+            fclose( file );
+
+            return result;
+        }();
+
+        return obj;
+    }
+
+    Binary::Ptr binary;
+};
+
+using Binary1M = BinaryFixture< 1000000 >;
+using Binary5M = BinaryFixture< 5000000 >;
+
+BENCHMARK_F( Binary1M, open, 10, 10 )
+{
+    Binary::open( filename() );
+}
+
+BENCHMARK_F( Binary1M, module, 5, 1 )
+{
+    binary->module( Module::ARENA );
+}
+
+BENCHMARK_F( Binary5M, open, 10, 10 )
+{
+    Binary::open( filename() );
+}
+
+BENCHMARK_F( Binary5M, module, 1, 1 )
+{
+    binary->module( Module::ARENA );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
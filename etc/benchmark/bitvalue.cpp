@@ -0,0 +1,180 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_benchmark;
+
+static const u32 OPERATIONS = 10000;
+
+/**
+   random operands of a bit size, every second value is a divisor of half
+   the bit size which is never zero
+*/
+
+template < u16 BITS >
+static const std::vector< BitValue >& operands( void )
+{
+    static const std::vector< BitValue > obj = []( void ) {
+        u64 state = 0x9e3779b97f4a7c15;
+        const auto next = [&state]( void ) {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545f4914f6cdd1d;
+        };
+
+        std::vector< BitValue > result;
+        for( u32 c = 0; c < OPERATIONS + 1; c++ )
+        {
+            BitValue value(
+                BITS, { next(), next(), next(), next(), next(), next(), next(), next() } );
+
+            if( c % 2 )
+            {
+                const u16 half = BITS > 1 ? BITS / 2 : 1;
+                value = value.trunc( half ).zext( BITS ) | BitValue( BITS, 1 );
+            }
+
+            result.emplace_back( value );
+        }
+        return result;
+    }();
+
+    return obj;
+}
+
+/**
+   the operands with bit 32 set, these divisors are wider than 32 bits and
+   take the multi-digit division
+*/
+
+template < u16 BITS >
+static const std::vector< BitValue >& divisors( void )
+{
+    static const std::vector< BitValue > obj = []( void ) {
+        std::vector< BitValue > result;
+        for( const auto& value : operands< BITS >() )
+        {
+            result.emplace_back( value | BitValue( BITS, (u64)1 << 32 ) );
+        }
+        return result;
+    }();
+
+    return obj;
+}
+
+/**
+   applies 'kernel' to all neighbouring operands (the right-hand side taken
+   from 'rhs'), the result is consumed so that the kernel cannot be removed
+*/
+
+template < u16 BITS, typename Kernel >
+static void run( Kernel kernel, const std::vector< BitValue >& rhs = operands< BITS >() )
+{
+    const auto& values = operands< BITS >();
+
+    u64 sink = 0;
+    for( u32 c = 0; c < OPERATIONS; c++ )
+    {
+        sink += kernel( values[ c ], rhs[ c + 1 ] ).value();
+    }
+
+    volatile u64 result = sink;
+    (void)result;
+}
+
+#define LIBCJEL_IR_BENCHMARK_BIT_VALUE_( BITS )                                                    \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, addu, 10, 10 )                                        \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) { return a.addu( b ); } );         \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, xor, 10, 10 )                                         \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) { return a ^ b; } );               \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, not, 10, 10 )                                         \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& ) { return ~a; } );                    \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, equ, 10, 10 )                                         \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) { return a.equ( b ); } );          \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, divs, 10, 1 )                                         \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) {                                  \
+            return b.isZero() ? a : a.divs( b );                                                   \
+        } );                                                                                       \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, modu, 10, 1 )                                         \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) {                                  \
+            return b.isZero() ? a : a.modu( b );                                                   \
+        } );                                                                                       \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, divs_wide, 10, 1 )                                    \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) { return a.divs( b ); },           \
+            divisors< BITS >() );                                                                  \
+    }                                                                                              \
+    BENCHMARK( libcjel_ir__bit_value_##BITS, modu_wide, 10, 1 )                                    \
+    {                                                                                              \
+        run< BITS >( []( const BitValue& a, const BitValue& b ) { return a.modu( b ); },           \
+            divisors< BITS >() );                                                                  \
+    }
+
+LIBCJEL_IR_BENCHMARK_BIT_VALUE_( 64 );
+LIBCJEL_IR_BENCHMARK_BIT_VALUE_( 128 );
+LIBCJEL_IR_BENCHMARK_BIT_VALUE_( 256 );
+LIBCJEL_IR_BENCHMARK_BIT_VALUE_( 512 );
+
+#undef LIBCJEL_IR_BENCHMARK_BIT_VALUE_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
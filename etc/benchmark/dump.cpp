@@ -0,0 +1,84 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <cstdio>
+
+using namespace libcjel_ir_benchmark;
+
+/**
+   writes the dump to '/dev/null', the measured time is the CPU time of
+   the printer plus the write system calls
+*/
+
+static void null( const char* data, std::size_t size )
+{
+    static FILE* file = fopen( "/dev/null", "w" );
+    fwrite( data, 1, size, file );
+}
+
+#define DUMP( FIXTURE, RUNS, ITERATIONS )                                                          \
+    BENCHMARK_F( FIXTURE, dump, RUNS, ITERATIONS )                                                 \
+    {                                                                                              \
+        CjelIRDumpPass::dump( *module, null );                                                     \
+    }                                                                                              \
+                                                                                                   \
+    BENCHMARK_F( FIXTURE, dump_parallel, RUNS, ITERATIONS )                                        \
+    {                                                                                              \
+        static ThreadPool pool;                                                                    \
+        CjelIRDumpPass::dump( *module, pool, null );                                               \
+    }
+
+DUMP( Module1K, 10, 100 );
+DUMP( Module100K, 10, 1 );
+DUMP( Module1M, 5, 1 );
+DUMP( Module10M, 1, 1 );
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
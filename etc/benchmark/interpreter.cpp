@@ -0,0 +1,159 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include <hayai/hayai.hpp>
+
+#include <libcjel-ir/libcjel-ir>
+
+#include <chrono>
+#include <iostream>
+
+using namespace libcjel_ir;
+
+static const u32 CALLS = 100000;
+
+static const std::string SOURCE = R"***(
+struct Int { u32 value, u1 isdef }
+
+function casmrt.add( Int ra, Int rb ) -> ( Int rt )
+{|
+    [ va = load ra.value
+    ; vb = load rb.value
+    ; vt = adds va, vb
+    ; store vt, rt.value
+    ]
+    [ ua = load ra.isdef
+    ; ub = load rb.isdef
+    ; ut = and ua, ub
+    ; store ut, rt.isdef
+    ]
+|}
+
+function casmrt.inc( u32 a ) -> ( u32 r )
+{|
+    [ x = addu a, 1 : u32 ; store x, r ]
+|}
+
+function casmrt.inc.twice( u32 a ) -> ( u32 r )
+{|
+    [ x = call casmrt.inc, a ; y = call casmrt.inc, x ; store y, r ]
+|}
+)***";
+
+/**
+   reports the executed operations per second of all runs of a benchmark
+*/
+
+class InterpreterFixture : public ::hayai::Fixture
+{
+  public:
+    void SetUp( void ) override
+    {
+        module = libstdhl::Memory::make< Module >( "benchmark" );
+        Parser parser( module );
+        parser.parse( SOURCE );
+
+        const auto i32 = BitType::get( 32 );
+        const auto i1 = BitType::get( 1 );
+        arguments = { BitConstant( i32, 40 ), BitConstant( i1, 1 ), BitConstant( i32, 2 ),
+            BitConstant( i1, 1 ) };
+
+        interpreter = libstdhl::Memory::make< Interpreter >();
+        start = std::chrono::steady_clock::now();
+    }
+
+    void TearDown( void ) override
+    {
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "                 " << ( interpreter->executed() / elapsed.count() / 1e6 )
+                  << " M instructions/s" << std::endl;
+
+        interpreter = nullptr;
+        module = nullptr;
+    }
+
+    const Function& function( const std::string& name ) const
+    {
+        for( const auto& value : module->get< Function >() )
+        {
+            if( value->name() == name )
+            {
+                return static_cast< const Function& >( *value );
+            }
+        }
+        throw std::domain_error( "'" + name + "' not found" );
+    }
+
+    Module::Ptr module;
+    std::vector< BitConstant > arguments;
+    std::shared_ptr< Interpreter > interpreter;
+    std::chrono::steady_clock::time_point start;
+};
+
+BENCHMARK_F( InterpreterFixture, casmrt_add, 10, 1 )
+{
+    const auto& add = function( "casmrt.add" );
+    for( u32 c = 0; c < CALLS; c++ )
+    {
+        interpreter->run( add, arguments );
+    }
+}
+
+BENCHMARK_F( InterpreterFixture, casmrt_inc_twice, 10, 1 )
+{
+    const auto& twice = function( "casmrt.inc.twice" );
+    const std::vector< BitConstant > argument = { arguments[ 0 ] };
+    for( u32 c = 0; c < CALLS; c++ )
+    {
+        interpreter->run( twice, argument );
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
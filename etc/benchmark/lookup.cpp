@@ -0,0 +1,177 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_benchmark;
+
+static const u32 LOOKUPS = 100000;
+
+/**
+   all values of a module with 1M instructions in pre-order
+*/
+
+static const std::vector< Value* >& values( void )
+{
+    static const auto module = create( 1000000 );
+    static const std::vector< Value* > obj = []( void ) {
+        std::vector< Value* > result;
+        module->iterate(
+            Traversal::PREORDER, [&result]( Value& value ) { result.emplace_back( &value ); } );
+        return result;
+    }();
+
+    return obj;
+}
+
+BENCHMARK( libcjel_ir__rtti, isa, 10, 1 )
+{
+    u64 count = 0;
+    for( auto value : values() )
+    {
+        count += isa< Instruction >( value );
+        count += isa< AddUnsignedInstruction >( value );
+        count += isa< Block >( value );
+    }
+}
+
+BENCHMARK( libcjel_ir__rtti, cast, 10, 1 )
+{
+    u64 count = 0;
+    for( auto value : values() )
+    {
+        if( auto instruction = cast< StoreInstruction >( value ) )
+        {
+            count += instruction->id();
+        }
+    }
+}
+
+BENCHMARK( libcjel_ir__cache, bit_type, 10, 1 )
+{
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        BitType::get( 1 + c % 64 );
+    }
+}
+
+BENCHMARK( libcjel_ir__cache, memory_type, 10, 1 )
+{
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        libstdhl::Memory::get< BitType >( 1 + c % 64 );
+    }
+}
+
+BENCHMARK( libcjel_ir__cache, bit_constant, 10, 1 )
+{
+    static ConstantPool pool;
+
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        pool.bit( 32, c % 1024 );
+    }
+}
+
+BENCHMARK( libcjel_ir__cache, string_constant, 10, 1 )
+{
+    static ConstantPool pool;
+    static const std::vector< std::string > strings = []( void ) {
+        std::vector< std::string > result;
+        for( u32 c = 0; c < 1024; c++ )
+        {
+            result.emplace_back( "string constant " + std::to_string( c ) );
+        }
+        return result;
+    }();
+
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        pool.string( strings[ c % strings.size() ] );
+    }
+}
+
+BENCHMARK( libcjel_ir__lookup, reference, 10, 1 )
+{
+    static const auto function = []( void ) {
+        const auto& t = BitType::get( 32 );
+        std::vector< Type::Ptr > inputs( 32, t );
+        auto result = libstdhl::Memory::make< Function >( "f",
+            libstdhl::Memory::make< RelationType >( inputs, std::vector< Type::Ptr >{ t } ) );
+
+        for( u32 c = 0; c < inputs.size(); c++ )
+        {
+            result->add( libstdhl::Memory::make< Reference >(
+                "argument" + std::to_string( c ), t, Reference::INPUT ) );
+        }
+        result->add( libstdhl::Memory::make< Reference >( "result", t, Reference::OUTPUT ) );
+        return result;
+    }();
+
+    static const std::vector< std::string > names = { "argument0", "argument17", "result" };
+
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        function->reference( names[ c % names.size() ] );
+    }
+}
+
+BENCHMARK( libcjel_ir__lookup, module_get, 10, 1 )
+{
+    const auto& module = libcjel_ir_benchmark::module( 1000000 );
+
+    u64 count = 0;
+    for( u32 c = 0; c < LOOKUPS; c++ )
+    {
+        count += module->get< Function >().size();
+        count += module->get< Variable >().size();
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -39,10 +39,34 @@
 //  statement from your version.
 //
 
-#include <hayai/hayai.hpp>
+#include "main.h"
 
-BENCHMARK( libcjel_ir, main, 0, 0 )
+using namespace libcjel_ir_benchmark;
+
+static const u64 FUNCTION_SIZE = 1000;
+
+Module::Ptr libcjel_ir_benchmark::create( u64 instructions )
+{
+    Generator::Options options;
+    options.instructions = instructions;
+    options.functions = ( instructions + FUNCTION_SIZE - 1 ) / FUNCTION_SIZE;
+
+    return Generator( options ).generate();
+}
+
+const Module::Ptr& libcjel_ir_benchmark::module( u64 instructions )
 {
+    static Module::Ptr cache;
+    static u64 size = 0;
+
+    if( not cache or size != instructions )
+    {
+        cache = nullptr;
+        cache = create( instructions );
+        size = instructions;
+    }
+
+    return cache;
 }
 
 //
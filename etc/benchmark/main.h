@@ -0,0 +1,134 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_BENCHMARK_MAIN_H_
+#define _LIBCJEL_IR_BENCHMARK_MAIN_H_
+
+#include <hayai/hayai.hpp>
+
+#include <libcjel-ir/libcjel-ir>
+
+namespace libcjel_ir_benchmark
+{
+    using namespace libcjel_ir;
+
+    /**
+       generates an arena module with 'instructions' instructions in
+       functions of 1000 instructions, see 'Generator' for the default mix
+    */
+
+    Module::Ptr create( u64 instructions );
+
+    /**
+       returns the module of 'create', the last module is kept so that the
+       runs of a benchmark share it
+    */
+
+    const Module::Ptr& module( u64 instructions );
+
+    /**
+       visitor with an empty override for every hook
+    */
+
+    class EmptyVisitor : public Visitor
+    {
+      public:
+        LIBCJEL_IR_VISITOR_INTERFACE_(, override {} );
+    };
+
+    template < u64 INSTRUCTIONS >
+    class ModuleFixture : public ::hayai::Fixture
+    {
+      public:
+        void SetUp( void ) override
+        {
+            module = libcjel_ir_benchmark::module( INSTRUCTIONS );
+        }
+
+        void TearDown( void ) override
+        {
+            module = nullptr;
+        }
+
+        Module::Ptr module;
+    };
+
+    using Module1K = ModuleFixture< 1000 >;
+    using Module100K = ModuleFixture< 100000 >;
+    using Module1M = ModuleFixture< 1000000 >;
+    using Module10M = ModuleFixture< 10000000 >;
+
+    /**
+       creates a new module for every run, for benchmarks which modify it
+    */
+
+    template < u64 INSTRUCTIONS >
+    class FreshModuleFixture : public ::hayai::Fixture
+    {
+      public:
+        void SetUp( void ) override
+        {
+            module = create( INSTRUCTIONS );
+        }
+
+        void TearDown( void ) override
+        {
+            module = nullptr;
+        }
+
+        Module::Ptr module;
+    };
+
+    using FreshModule100K = FreshModuleFixture< 100000 >;
+    using FreshModule1M = FreshModuleFixture< 1000000 >;
+}
+
+#endif  // _LIBCJEL_IR_BENCHMARK_MAIN_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
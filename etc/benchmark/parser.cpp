@@ -0,0 +1,147 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include <hayai/hayai.hpp>
+
+#include <libcjel-ir/libcjel-ir>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+using namespace libcjel_ir;
+
+static const u32 FUNCTIONS = 2000;
+static const u32 STATEMENTS = 50;
+
+/**
+   generates a module of roughly 10 MB source text
+*/
+
+static const std::string& source( void )
+{
+    static const std::string obj = []() {
+        std::string result = "struct Int { u32 value, u1 isdef }\n"
+                             "variable counter : u32 = 0\n";
+
+        for( u32 f = 0; f < FUNCTIONS; f++ )
+        {
+            const auto name = "f" + std::to_string( f );
+
+            result += "\n// function " + name + "\n";
+            result += "function " + name + "( Int a, u32 b ) -> ( Int r )\n{|\n";
+
+            for( u32 s = 0; s < STATEMENTS; s++ )
+            {
+                const auto n = std::to_string( s );
+
+                result += "    [ x" + n + " = load a.value ; y" + n + " = addu x" + n + ", b ; z" +
+                          n + " = xor y" + n + ", " + n + " : u32 ; store z" + n +
+                          ", r.value ]\n";
+
+                if( s % 10 == 9 )
+                {
+                    result += "    branch [ e" + n + " = equ x" + n + ", y" + n + " ]\n" +
+                              "    {| [ c" + n + " = load counter ; d" + n + " = addu c" + n +
+                              ", 1 : u32 ; store d" + n + ", counter ] |}\n";
+                }
+            }
+
+            result += "|}\n";
+        }
+
+        return result;
+    }();
+
+    return obj;
+}
+
+/**
+   reports the parsed source bytes per second of each run, the module is
+   released after the measurement
+*/
+
+class ParserFixture : public ::hayai::Fixture
+{
+  public:
+    void SetUp( void ) override
+    {
+        module = libstdhl::Memory::make< Module >( "benchmark", Module::ARENA );
+        input.str( source() );
+        start = std::chrono::steady_clock::now();
+    }
+
+    void TearDown( void ) override
+    {
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "                 " << ( source().size() / elapsed.count() / 1e6 )
+                  << " MB/s" << std::endl;
+
+        module = nullptr;
+    }
+
+    Module::Ptr module;
+    std::istringstream input;
+    std::chrono::steady_clock::time_point start;
+};
+
+BENCHMARK_F( ParserFixture, string, 5, 1 )
+{
+    Parser parser( module );
+    parser.parse( source() );
+}
+
+BENCHMARK_F( ParserFixture, stream, 5, 1 )
+{
+    Parser parser( module );
+    parser.parse( input );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,122 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include <hayai/hayai.hpp>
+
+#include <libcjel-ir/libcjel-ir>
+
+using namespace libcjel_ir;
+
+static const u32 BLOCKS = 1024;
+static const u32 INSTRUCTIONS = 16;
+
+static Scope::Ptr create( void )
+{
+    auto scope = libstdhl::Memory::make< ParallelScope >();
+
+    for( u32 c = 0; c < BLOCKS; c++ )
+    {
+        auto statement = libstdhl::Memory::make< TrivialStatement >();
+        for( u32 i = 0; i < INSTRUCTIONS; i++ )
+        {
+            statement->add( libstdhl::Memory::make< NopInstruction >() );
+        }
+        scope->add( statement );
+    }
+
+    return scope;
+}
+
+static void work( const Statement& statement )
+{
+    // stands in for an interpreter or analysis step of the statement
+    const u64 size = statement.instructions().size();
+    volatile u64 sum = 0;
+    for( u32 c = 0; c < 10000; c++ )
+    {
+        sum += size + c;
+    }
+}
+
+template < u32 WORKERS >
+class SchedulerFixture : public ::hayai::Fixture
+{
+  public:
+    void SetUp( void ) override
+    {
+        scope = create();
+        pool.reset( new ThreadPool( WORKERS == 0 ? 0 : ThreadPool::defaultWorkers() ) );
+    }
+
+    void TearDown( void ) override
+    {
+        pool = nullptr;
+        scope = nullptr;
+    }
+
+    Scope::Ptr scope;
+    std::unique_ptr< ThreadPool > pool;
+};
+
+using InlineScheduler = SchedulerFixture< 0 >;
+using PoolScheduler = SchedulerFixture< 1 >;
+
+BENCHMARK_F( InlineScheduler, parallel_scope, 10, 1 )
+{
+    Scheduler scheduler( *pool );
+    scheduler.run( *scope, work );
+}
+
+BENCHMARK_F( PoolScheduler, parallel_scope, 10, 1 )
+{
+    Scheduler scheduler( *pool );
+    scheduler.run( *scope, work );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,164 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <thread>
+
+using namespace libcjel_ir;
+
+TEST( libcjel_ir__arena, allocate_aligned )
+{
+    Arena arena( 64 );
+
+    auto a = arena.allocate( 3, 1 );
+    auto b = arena.allocate( 8, 8 );
+    auto c = arena.allocate( 128, 16 );
+
+    EXPECT_EQ( reinterpret_cast< std::uintptr_t >( b ) % 8, 0 );
+    EXPECT_EQ( reinterpret_cast< std::uintptr_t >( c ) % 16, 0 );
+    EXPECT_NE( a, b );
+    EXPECT_EQ( arena.bytes(), 3 + 8 + 128 );
+    EXPECT_EQ( arena.slabs(), 2 );
+}
+
+TEST( libcjel_ir__arena, module_make )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::ARENA );
+    ASSERT_TRUE( module->hasArena() );
+
+    auto c = module->make< BitConstant >( 8, 42 );
+    auto i = module->make< AddUnsignedInstruction >( c, c );
+
+    EXPECT_STREQ( c->name().c_str(), "42" );
+    EXPECT_TRUE( isa< AddUnsignedInstruction >( i ) );
+    EXPECT_EQ( i->operand( 0 ), c );
+    EXPECT_GT( module->arena()->bytes(), sizeof( BitConstant ) + sizeof( AddUnsignedInstruction ) );
+
+    // objects keep the arena alive beyond the module lifetime
+    auto arena = std::weak_ptr< Arena >( module->arena() );
+    module = nullptr;
+    EXPECT_FALSE( arena.expired() );
+    c = nullptr;
+    i = nullptr;
+    EXPECT_TRUE( arena.expired() );
+}
+
+TEST( libcjel_ir__arena, pool_and_references )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::ARENA );
+    auto b8 = BitType::get( 8 );
+
+    auto function = module->make< Function >(
+        "f", libstdhl::Memory::make< RelationType >(
+                 std::vector< Type::Ptr >{ b8 }, std::vector< Type::Ptr >{ b8 } ) );
+
+    const auto bytes = module->arena()->bytes();
+
+    ConstantPool pool( module.get() );
+    auto c = pool.bit( b8, 42 );
+    auto s = pool.string( "text" );
+    auto a = function->in( *module, "a", b8 );
+    auto r = function->out( *module, "r", b8 );
+
+    EXPECT_GE( module->arena()->bytes(),
+        bytes + sizeof( BitConstant ) + sizeof( StringConstant ) + 2 * sizeof( Reference ) );
+    EXPECT_EQ( pool.bit( b8, 42 ), c );
+    EXPECT_EQ( function->inputs().size(), 1 );
+    EXPECT_EQ( function->outputs().size(), 1 );
+    EXPECT_EQ( function->reference( "a" ), a );
+}
+
+TEST( libcjel_ir__arena, module_make_concurrently )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::ARENA | Module::INDEX );
+    auto owned = module->make< BitConstant >( 8, 0 );
+
+    std::vector< std::vector< Instruction::Ptr > > results( 4 );
+    std::vector< std::thread > builders;
+    for( auto& result : results )
+    {
+        builders.emplace_back( [&module, &result]() {
+            for( u64 c = 0; c < 1000; c++ )
+            {
+                auto value = module->make< BitConstant >( 8, c % 256 );
+                result.emplace_back( module->make< AddUnsignedInstruction >( value, value ) );
+            }
+        } );
+    }
+
+    for( auto& builder : builders )
+    {
+        builder.join();
+    }
+
+    EXPECT_EQ( module->index< AddUnsignedInstruction >().size(), 4000 );
+    EXPECT_GE( module->arena()->bytes(),
+        4000 * ( sizeof( BitConstant ) + sizeof( AddUnsignedInstruction ) ) );
+
+    for( const auto& result : results )
+    {
+        for( u64 c = 0; c < result.size(); c++ )
+        {
+            EXPECT_EQ( result[ c ]->operand( 0 )->name(), std::to_string( c % 256 ) );
+        }
+    }
+}
+
+TEST( libcjel_ir__arena, module_make_without_arena )
+{
+    auto module = libstdhl::Memory::make< Module >( "m" );
+    EXPECT_FALSE( module->hasArena() );
+    EXPECT_EQ( module->arena(), nullptr );
+
+    auto c = module->make< BitConstant >( 8, 1 );
+    EXPECT_STREQ( c->name().c_str(), "1" );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,256 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <cstdio>
+#include <regex>
+
+using namespace libcjel_ir;
+
+static Module::Ptr example( void )
+{
+    auto module = libstdhl::Memory::make< Module >( "example" );
+
+    auto b1 = BitType::get( 1 );
+    auto b8 = BitType::get( 8 );
+
+    auto structure = libstdhl::Memory::make< Structure >(
+        "pair", std::initializer_list< StructureElement >{ { b8, "value" }, { b1, "valid" } } );
+    module->add( structure );
+
+    auto three = libstdhl::Memory::make< BitConstant >( b8, 3 );
+    module->add( three );
+    module->add( libstdhl::Memory::make< StringConstant >( "hello" ) );
+    module->add( libstdhl::Memory::make< StructureConstant >(
+        structure, std::vector< Constant >{ BitConstant( b8, 5 ), BitConstant( b1, 1 ) } ) );
+
+    auto variable = libstdhl::Memory::make< Variable >( b8, three, "var" );
+    module->add( variable );
+    module->add( libstdhl::Memory::make< Memory >( "mem", b8, 16 ) );
+
+    auto interconnect = libstdhl::Memory::make< Interconnect >( "bus" );
+    interconnect->add( variable );
+    module->add( interconnect );
+
+    auto function = libstdhl::Memory::make< Function >( "f",
+        libstdhl::Memory::make< RelationType >(
+            std::vector< Type::Ptr >{ b8 }, std::vector< Type::Ptr >{ b8, b8 } ) );
+    module->add( function );
+
+    auto a = function->in( "a", b8 );
+    auto b = function->in( "b", b8 );
+    auto r = function->out( "r", b8 );
+    a->setCallable( function );
+
+    auto scope = libstdhl::Memory::make< SequentialScope >();
+    function->setContext( scope );
+
+    auto stmt = libstdhl::Memory::make< TrivialStatement >();
+    stmt->setParent( scope );
+    scope->add( stmt );
+
+    auto add = stmt->add( libstdhl::Memory::make< AddUnsignedInstruction >( a, b ) );
+    add->setStatement( stmt );
+    auto land = stmt->add( libstdhl::Memory::make< AndInstruction >( add, three ) );
+    land->setStatement( stmt );
+    stmt->add( libstdhl::Memory::make< StoreInstruction >( land, r ) );
+    stmt->add( libstdhl::Memory::make< CallInstruction >(
+        function, std::vector< Value::Ptr >{ a, add } ) );
+
+    auto parallel = libstdhl::Memory::make< ParallelScope >();
+    parallel->setParent( scope );
+    scope->add( parallel );
+
+    auto branch = libstdhl::Memory::make< BranchStatement >();
+    branch->setParent( parallel );
+    parallel->add( branch );
+    branch->add( libstdhl::Memory::make< EquInstruction >( a, b ) );
+
+    auto taken = libstdhl::Memory::make< SequentialScope >();
+    taken->setParent( branch );
+    branch->add( taken );
+
+    auto inner = libstdhl::Memory::make< TrivialStatement >();
+    inner->setParent( taken );
+    taken->add( inner );
+    inner->add( libstdhl::Memory::make< NotInstruction >( a ) );
+
+    return module;
+}
+
+static std::string dump( const Module::Ptr& module )
+{
+    CjelIRDumpPass pass;
+
+    testing::internal::CaptureStdout();
+    module->iterate( Traversal::PREORDER, &pass );
+    const auto output = testing::internal::GetCapturedStdout();
+
+    // object addresses differ between the original and the loaded module
+    return std::regex_replace( output, std::regex( "0x[0-9a-f]+|\\(nil\\)" ), "_" );
+}
+
+TEST( libcjel_ir__binary, round_trip_matches_dump )
+{
+    const auto module = example();
+    const auto buffer = CjelIRToBinaryPass::encode( *module );
+
+    const auto filename = testing::TempDir() + "libcjel_ir__binary.cjelir";
+    {
+        auto file = fopen( filename.c_str(), "wb" );
+        ASSERT_TRUE( file != nullptr );
+        fwrite( buffer.data(), 1, buffer.size(), file );
+        fclose( file );
+    }
+
+    const auto binary = Binary::open( filename );
+    std::remove( filename.c_str() );
+
+    EXPECT_EQ( binary->size(), buffer.size() );
+    EXPECT_STREQ( binary->name(), "example" );
+    EXPECT_EQ( binary->functions(), 1 );
+    EXPECT_EQ( binary->contents(), 8 );
+
+    const auto& function = binary->function( 0 );
+    EXPECT_EQ( binary->value( function.value ).id, Value::FUNCTION );
+    EXPECT_STREQ( binary->string( binary->value( function.value ).name ), "f" );
+    EXPECT_EQ( binary->value( function.context ).id, Value::SEQUENTIAL_SCOPE );
+
+    const auto loaded = binary->module();
+    EXPECT_EQ( dump( loaded ), dump( module ) );
+    EXPECT_EQ( CjelIRToBinaryPass::encode( *loaded ), buffer );
+}
+
+TEST( libcjel_ir__binary, values_are_read_in_place )
+{
+    const auto buffer = CjelIRToBinaryPass::encode( *example() );
+    const Binary binary( reinterpret_cast< const u8* >( buffer.data() ), buffer.size() );
+
+    u1 found = false;
+    for( u32 c = 0; c < binary.values(); c++ )
+    {
+        const auto& record = binary.value( c );
+        if( record.id == Value::BIT_CONSTANT and record.payload == 3 )
+        {
+            EXPECT_EQ( binary.type( record.type ).id, Type::BIT );
+            EXPECT_EQ( binary.type( record.type ).length, 8 );
+            found = true;
+        }
+
+        if( record.id == Value::ADDU_INSTRUCTION )
+        {
+            const auto operands = binary.operands( record.first, record.count );
+            ASSERT_EQ( record.count, 2 );
+            EXPECT_STREQ( binary.string( binary.value( operands[ 0 ] ).name ), "a" );
+            EXPECT_STREQ( binary.string( binary.value( operands[ 1 ] ).name ), "b" );
+        }
+    }
+
+    EXPECT_TRUE( found );
+    EXPECT_THROW( binary.value( binary.values() ), std::domain_error );
+}
+
+TEST( libcjel_ir__binary, invalid_buffers_are_rejected )
+{
+    auto buffer = CjelIRToBinaryPass::encode( *example() );
+    const auto data = reinterpret_cast< const u8* >( buffer.data() );
+
+    EXPECT_THROW( Binary( data, buffer.size() - 8 ), std::domain_error );
+    EXPECT_THROW( Binary( data, 16 ), std::domain_error );
+
+    buffer[ 1 ] = 'X';
+    EXPECT_THROW( Binary( data, buffer.size() ), std::domain_error );
+
+    EXPECT_THROW( Binary::open( "/nonexistent/module.cjelir" ), std::domain_error );
+}
+
+static u32 find( const Binary& binary, u8 id )
+{
+    for( u32 c = 0; c < binary.values(); c++ )
+    {
+        if( binary.value( c ).id == id )
+        {
+            return c;
+        }
+    }
+
+    throw std::domain_error( "no such value record" );
+}
+
+TEST( libcjel_ir__binary, invalid_payloads_are_rejected )
+{
+    const auto buffer = CjelIRToBinaryPass::encode( *example() );
+
+    // a statement scope count and a callable context beyond 32-bit
+    for( const auto id : { Value::BRANCH_STATEMENT, Value::FUNCTION } )
+    {
+        auto copy = buffer;
+        const Binary binary( reinterpret_cast< const u8* >( copy.data() ), copy.size() );
+        auto& record = const_cast< Binary::ValueRecord& >( binary.value( find( binary, id ) ) );
+        record.payload |= ( u64 )1 << 32;
+
+        EXPECT_THROW( binary.module(), std::domain_error );
+    }
+}
+
+TEST( libcjel_ir__binary, cyclic_records_are_rejected )
+{
+    auto buffer = CjelIRToBinaryPass::encode( *example() );
+    const Binary binary( reinterpret_cast< const u8* >( buffer.data() ), buffer.size() );
+
+    // let the 'not' instruction be its own operand
+    const auto index = find( binary, Value::NOT_INSTRUCTION );
+    const auto& record = binary.value( index );
+    const_cast< u32& >( binary.operands( record.first, record.count )[ 0 ] ) = index;
+
+    EXPECT_THROW( binary.module(), std::domain_error );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,260 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir;
+
+using u128 = unsigned __int128;
+
+namespace libcjel_ir
+{
+    static void PrintTo( const BitValue& value, std::ostream* stream )
+    {
+        *stream << value.to_string( libstdhl::Type::HEXADECIMAL ) << " : u" << value.bitsize();
+    }
+}
+
+namespace
+{
+    class Random
+    {
+      public:
+        u64 next( void )
+        {
+            m_state ^= m_state >> 12;
+            m_state ^= m_state << 25;
+            m_state ^= m_state >> 27;
+            return m_state * 0x2545f4914f6cdd1d;
+        }
+
+        BitValue value( u16 bitsize )
+        {
+            return BitValue( bitsize,
+                { next(), next(), next(), next(), next(), next(), next(), next() } );
+        }
+
+      private:
+        u64 m_state = 0x9e3779b97f4a7c15;
+    };
+}
+
+static BitValue value( u128 value )
+{
+    return BitValue( 128, { (u64)value, (u64)( value >> 64 ) } );
+}
+
+static u128 value( const BitValue& value )
+{
+    return ( (u128)value.limb( 1 ) << 64 ) | value.limb( 0 );
+}
+
+static u1 bit( const BitValue& value, u32 index )
+{
+    return ( value.limb( index / 64 ) >> ( index % 64 ) ) & 1;
+}
+
+static BitValue negate( const BitValue& value )
+{
+    return ( ~value ).addu( BitValue( value.bitsize(), 1 ) );
+}
+
+static BitValue multiply( BitValue lhs, const BitValue& rhs )
+{
+    // shift and add, 'x.addu( x )' shifts 'x' by one bit
+    BitValue result( lhs.bitsize(), 0 );
+    for( u32 c = 0; c < rhs.bitsize(); c++ )
+    {
+        if( bit( rhs, c ) )
+        {
+            result = result.addu( lhs );
+        }
+        lhs = lhs.addu( lhs );
+    }
+    return result;
+}
+
+TEST( libcjel_ir__bit_value, construction )
+{
+    EXPECT_EQ( BitValue( 8, 0x1ff ).value(), 0xff );
+    EXPECT_EQ( BitValue( 70, { 1, ~( (u64)0 ), 5 } ).limb( 1 ), 0x3f );
+    EXPECT_EQ( BitValue( 70, { 1, ~( (u64)0 ), 5 } ).limb( 2 ), 0 );
+    EXPECT_EQ( BitValue( 512 ).size(), 8 );
+    EXPECT_EQ( BitValue( 65 ).size(), 2 );
+
+    EXPECT_TRUE( BitValue( 128, { 1 } ).fits() );
+    EXPECT_FALSE( BitValue( 128, { 1, 1 } ).fits() );
+
+    const BitConstant constant( BitType::get( 300 ), 42 );
+    EXPECT_EQ( BitValue( constant ), BitValue( 300, 42 ) );
+    EXPECT_NE( BitValue( 300, 42 ), BitValue( 301, 42 ) );
+
+    EXPECT_THROW( BitValue( 0 ), std::domain_error );
+    EXPECT_THROW( BitValue( BitType::SizeMax + 1 ), std::domain_error );
+    EXPECT_THROW( BitValue( 8 ).zext( 4 ), std::domain_error );
+    EXPECT_THROW( BitValue( 8 ).trunc( 16 ), std::domain_error );
+    EXPECT_THROW( BitValue( 8, 1 ).divs( BitValue( 8 ) ), std::domain_error );
+    EXPECT_THROW( BitValue( 256, 1 ).modu( BitValue( 256 ) ), std::domain_error );
+}
+
+TEST( libcjel_ir__bit_value, up_to_64_bits )
+{
+    EXPECT_EQ( BitValue( 8, 250 ).addu( BitValue( 8, 10 ) ).value(), 4 );
+    EXPECT_EQ( BitValue( 8, 0xff ).adds( BitValue( 8, 0xff ) ).value(), 0xfe );
+    EXPECT_EQ( ( ~BitValue( 5, 3 ) ).value(), 28 );
+    EXPECT_EQ( BitValue( 8, 0 ).lnot().value(), 1 );
+    EXPECT_EQ( BitValue( 8, 3 ).equ( BitValue( 8, 3 ) ), BitValue( 1, 1 ) );
+    EXPECT_EQ( BitValue( 8, 3 ).neq( BitValue( 8, 3 ) ), BitValue( 1, 0 ) );
+
+    // -7 / 2 = -3, -128 / -1 = -128 and 7 % 3 = 1
+    EXPECT_EQ( BitValue( 8, 0xf9 ).divs( BitValue( 8, 2 ) ).value(), 0xfd );
+    EXPECT_EQ( BitValue( 8, 0x80 ).divs( BitValue( 8, 0xff ) ).value(), 0x80 );
+    EXPECT_EQ( BitValue( 64, 1ull << 63 ).divs( BitValue( 64, ~0ull ) ).value(), 1ull << 63 );
+    EXPECT_EQ( BitValue( 8, 7 ).modu( BitValue( 8, 3 ) ).value(), 1 );
+
+    EXPECT_EQ( BitValue( 16, 0x1234 ).trunc( 8 ), BitValue( 8, 0x34 ) );
+    EXPECT_EQ( BitValue( 8, 0x80 ).zext( 200 ), BitValue( 200, 0x80 ) );
+}
+
+TEST( libcjel_ir__bit_value, matches_128_bit_reference )
+{
+    Random random;
+
+    for( u32 c = 0; c < 1000; c++ )
+    {
+        const auto a = random.value( 128 );
+        auto b = random.value( 128 );
+        if( c % 4 == 0 )
+        {
+            b = b.trunc( 1 + c % 127 ).zext( 128 );
+        }
+        if( b.isZero() )
+        {
+            continue;
+        }
+
+        const auto x = value( a );
+        const auto y = value( b );
+
+        EXPECT_EQ( a.addu( b ), value( x + y ) );
+        EXPECT_EQ( a & b, value( x & y ) );
+        EXPECT_EQ( a | b, value( x | y ) );
+        EXPECT_EQ( a ^ b, value( x ^ y ) );
+        EXPECT_EQ( ~a, value( ~x ) );
+        EXPECT_EQ( a.modu( b ), value( x % y ) );
+
+        // signed division by magnitudes
+        const u1 sx = x >> 127;
+        const u1 sy = y >> 127;
+        const u128 mx = sx ? 0 - x : x;
+        const u128 my = sy ? 0 - y : y;
+        const u128 q = mx / my;
+        EXPECT_EQ( a.divs( b ), value( sx != sy ? 0 - q : q ) );
+    }
+}
+
+TEST( libcjel_ir__bit_value, division_identity_up_to_512_bits )
+{
+    Random random;
+
+    for( const u16 bits : { 65, 100, 256, 300, 511, 512 } )
+    {
+        for( u32 c = 0; c < 50; c++ )
+        {
+            // non-negative operands, 'divs' then equals the unsigned division
+            const auto a = random.value( bits ).trunc( bits - 1 ).zext( bits );
+            auto b = random.value( bits ).trunc( 1 + ( c * 37 ) % ( bits - 1 ) ).zext( bits );
+            if( b.isZero() )
+            {
+                b = BitValue( bits, 3 );
+            }
+
+            const auto r = a.modu( b );
+            EXPECT_EQ( multiply( a.divs( b ), b ).addu( r ), a );
+
+            // 'r < b'
+            EXPECT_TRUE( r.trunc( bits - 1 ).zext( bits ).divs( b ).isZero() );
+
+            EXPECT_TRUE( a.addu( negate( a ) ).isZero() );
+            EXPECT_EQ( negate( a ).divs( b ), negate( a.divs( b ) ) );
+        }
+    }
+
+    const auto minimum = BitValue( 512, { 0, 0, 0, 0, 0, 0, 0, 1ull << 63 } );
+    EXPECT_EQ( minimum.divs( ~BitValue( 512 ) ), minimum );
+}
+
+TEST( libcjel_ir__bit_value, wide_divisor_digit_corrections )
+{
+    // the first quotient digit estimate is too large and is added back
+    const auto a = BitValue( 128, { 0, 0x7fffffff80000000 } );
+    const auto b = BitValue( 128, { 1, 0x80000000 } );
+    EXPECT_EQ( a.divs( b ), BitValue( 128, 0xfffffffe ) );
+    EXPECT_EQ( a.modu( b ), BitValue( 128, { 0xffffffff00000002, 0x7fffffff } ) );
+
+    // unsigned remainder of the maximum value, the divisor is not aligned
+    const auto maximum = ~BitValue( 512 );
+    const auto divisor = BitValue( 512, { 12345, 0, 0, 1ull << 8, 1ull << 44 } );
+    EXPECT_EQ( maximum.modu( divisor ),
+        BitValue( 512, { 0xfffffffffcfca038, 0x3038ffffffffffff, 0, 0xfffffffcfc600100,
+                           0xfffffffffff } ) );
+}
+
+TEST( libcjel_ir__bit_value, to_string )
+{
+    EXPECT_EQ( BitValue( 8, 0 ).to_string(), "0" );
+    EXPECT_EQ( BitValue( 8, 0xab ).to_string( libstdhl::Type::HEXADECIMAL ), "ab" );
+    EXPECT_EQ( BitValue( 8, 5 ).to_string( libstdhl::Type::BINARY ), "101" );
+    EXPECT_EQ( ( ~BitValue( 256 ) ).to_string(),
+        "115792089237316195423570985008687907853269984665640564039457584007913129639935" );
+    EXPECT_EQ( ( ~BitValue( 130 ) ).to_string( libstdhl::Type::HEXADECIMAL ),
+        "3ffffffffffffffffffffffffffffffff" );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,347 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+using namespace libcjel_ir_test;
+
+static u1 compiler( void )
+{
+    return std::system( "cc --version > /dev/null 2>&1" ) == 0;
+}
+
+/**
+   compiles the emitted module together with a 'main' driver and returns
+   the standard output of the resulting program
+*/
+
+static std::string execute( const std::string& name, const Module& module,
+    const std::string& driver )
+{
+    const auto source = "libcjel-ir-test-c11-" + name + ".c";
+    const auto binary = "./libcjel-ir-test-c11-" + name;
+
+    std::ofstream file( source, std::ios::trunc );
+    file << CjelIRToC11Pass::emit( module ) << "#include <stdio.h>\n\n" << driver;
+    file.close();
+
+    const auto command = "cc -std=c11 -Wall -Wno-unused-function -Wno-unused-but-set-variable "
+                         "-o " + binary + " " + source;
+    EXPECT_EQ( std::system( command.c_str() ), 0 );
+
+    std::string result;
+    auto pipe = popen( binary.c_str(), "r" );
+    if( pipe )
+    {
+        char buffer[ 256 ];
+        while( fgets( buffer, sizeof( buffer ), pipe ) )
+        {
+            result += buffer;
+        }
+        pclose( pipe );
+    }
+
+    std::remove( source.c_str() );
+    std::remove( binary.c_str() + 2 );
+    return result;
+}
+
+static BitConstant u( u16 bitsize, u64 value )
+{
+    return BitConstant( BitType::get( bitsize ), value );
+}
+
+static const std::string SOURCE = R"***(
+struct Int { u32 value, u1 isdef }
+
+variable counter : u32 = 5
+memory heap : u32 -> 4
+
+function casmrt.add( Int ra, Int rb ) -> ( Int rt )
+{|
+    {
+        [ va = load ra.value ]
+        [ vb = load rb.value ]
+        [ ua = load ra.isdef ]
+        [ ub = load rb.isdef ]
+    }
+    {
+        [ vt = adds va, vb ; store vt, rt.value ]
+        [ ut = and ua, ub ; store ut, rt.isdef ]
+    }
+|}
+
+function sum( u32 n ) -> ( u32 r )
+{|
+    [ i = alloc -> u32 ; store 0 : u32, r ]
+    loop [ c = load i ; x = neq c, n ]
+    {|
+        [ d = load i ; e = addu d, 1 : u32 ; store e, i ; f = load r ; g = addu f, e ; store g, r ]
+    |}
+|}
+
+function select( u8 a, u8 b ) -> ( u8 r )
+{|
+    branch [ e = equ a, b ]
+    {| [ store 1 : u8, r ] |}
+    {| [ store 2 : u8, r ] |}
+|}
+
+function mem.put( u32 i, u32 v ) -> ( u32 r )
+{|
+    [ a = extract heap, i ; store v, a ]
+    [ c = load counter ; d = addu c, 1 : u32 ; store d, counter ; store d, r ]
+|}
+
+function arith( u8 a, u8 b ) -> ( u8 q, u8 m, u8 n, u1 l, u4 t )
+{|
+    [ x = divs a, b ; store x, q ]
+    [ y = modu a, b ; store y, m ]
+    [ z = not a ; store z, n ]
+    [ w = lnot b ; store w, l ]
+    [ v = trunc a -> u4 ; store v, t ]
+|}
+)***";
+
+TEST( libcjel_ir__c11, deterministic )
+{
+    const auto module = parse( SOURCE );
+
+    ThreadPool sequential( 0 );
+    ThreadPool concurrent( 3 );
+    const auto source = CjelIRToC11Pass::emit( *module, sequential );
+
+    EXPECT_EQ( CjelIRToC11Pass::emit( *module, concurrent ), source );
+    EXPECT_NE( source.find( "struct CJEL_PACKED Int" ), std::string::npos );
+    EXPECT_NE( source.find( "void casmrt_add( struct Int ra, struct Int rb, struct Int* rt );" ),
+        std::string::npos );
+    EXPECT_NE( source.find( "static uint32_t heap[ 4 ];" ), std::string::npos );
+}
+
+TEST( libcjel_ir__c11, matches_interpreter )
+{
+    if( not compiler() )
+    {
+        GTEST_SKIP();
+    }
+
+    const auto module = parse( SOURCE );
+
+    const auto output = execute( "interpreter", *module, R"***(
+int main( void )
+{
+    struct Int a = { 40, 1 }, b = { 2, 1 }, r;
+    casmrt_add( a, b, &r );
+    printf( "%u %u\n", r.value, r.isdef );
+
+    a.value = 0xffffffff;
+    b.isdef = 0;
+    casmrt_add( a, b, &r );
+    printf( "%u %u\n", r.value, r.isdef );
+
+    uint32_t s;
+    sum( 10, &s );
+    printf( "%u\n", s );
+
+    uint8_t e, f;
+    select( 3, 3, &e );
+    select( 3, 4, &f );
+    printf( "%u %u\n", e, f );
+
+    uint32_t p;
+    mem_put( 2, 7, &p );
+    printf( "%u %u %u\n", p, counter, heap[ 2 ] );
+
+    uint8_t q, m, n, l, t;
+    arith( 0xf9, 2, &q, &m, &n, &l, &t );
+    printf( "%u %u %u %u %u\n", q, m, n, l, t );
+    arith( 0x80, 0xff, &q, &m, &n, &l, &t );
+    printf( "%u\n", q );
+    return 0;
+}
+)***" );
+
+    Interpreter interpreter;
+    const auto run = [&interpreter, &module](
+                         const std::string& name, const std::vector< BitConstant >& arguments ) {
+        std::string result;
+        for( const auto& value : interpreter.run( lookup< Function >( module, name ), arguments ) )
+        {
+            result += ( result.empty() ? "" : " " ) + std::to_string( value.value().value() );
+        }
+        return result;
+    };
+
+    std::string expected;
+    expected += run( "casmrt.add", { u( 32, 40 ), u( 1, 1 ), u( 32, 2 ), u( 1, 1 ) } ) + "\n";
+    expected +=
+        run( "casmrt.add", { u( 32, 0xffffffff ), u( 1, 1 ), u( 32, 2 ), u( 1, 0 ) } ) + "\n";
+    expected += run( "sum", { u( 32, 10 ) } ) + "\n";
+    expected += run( "select", { u( 8, 3 ), u( 8, 3 ) } ) + " " +
+                run( "select", { u( 8, 3 ), u( 8, 4 ) } ) + "\n";
+    expected += run( "mem.put", { u( 32, 2 ), u( 32, 7 ) } );
+    expected += " " + std::to_string( interpreter.load( lookup< Variable >( module, "counter" ) )
+                                          .value()
+                                          .value() );
+    expected += " " + std::to_string( interpreter.load( lookup< Memory >( module, "heap" ), 2 )
+                                          .value()
+                                          .value() ) +
+                "\n";
+    expected += run( "arith", { u( 8, 0xf9 ), u( 8, 2 ) } ) + "\n";
+    expected += run( "arith", { u( 8, 0x80 ), u( 8, 0xff ) } ).substr( 0, 3 ) + "\n";
+
+    EXPECT_EQ( output, expected );
+}
+
+TEST( libcjel_ir__c11, wide_bit_types )
+{
+    if( not compiler() )
+    {
+        GTEST_SKIP();
+    }
+
+    const auto module = parse( R"***(
+function wide( u100 a, u100 b ) -> ( u100 r, u100 n, u1 e, u64 t )
+{|
+    [ x = addu a, b ; store x, r ]
+    [ y = not a ; store y, n ]
+    [ z = equ a, b ; store z, e ]
+    [ w = trunc x -> u64 ; store w, t ]
+|}
+)***" );
+
+    const auto output = execute( "wide", *module, R"***(
+int main( void )
+{
+    cjel_b100 a = { { UINT64_C( 0xffffffffffffffff ), 0 } };
+    cjel_b100 b = { { 1, 0 } };
+    cjel_b100 r, n;
+    uint8_t e;
+    uint64_t t;
+    wide( a, b, &r, &n, &e, &t );
+    printf( "%llx %llx %llx %llx %u %llx\n", (unsigned long long)r.word[ 1 ],
+        (unsigned long long)r.word[ 0 ], (unsigned long long)n.word[ 1 ],
+        (unsigned long long)n.word[ 0 ], e, (unsigned long long)t );
+
+    a.word[ 1 ] = 0xfffffffff;
+    wide( a, a, &r, &n, &e, &t );
+    printf( "%llx %llx %u\n", (unsigned long long)r.word[ 1 ], (unsigned long long)r.word[ 0 ],
+        e );
+    return 0;
+}
+)***" );
+
+    EXPECT_EQ( output, "1 0 fffffffff 0 0 0\n"
+                       "fffffffff fffffffffffffffe 1\n" );
+}
+
+TEST( libcjel_ir__c11, wide_arithmetic )
+{
+    if( not compiler() )
+    {
+        GTEST_SKIP();
+    }
+
+    const auto module = parse( R"***(
+function wide( u100 a, u100 b ) -> ( u100 q, u100 m, u1 l )
+{|
+    [ x = divs a, b ; store x, q ]
+    [ y = modu a, b ; store y, m ]
+    [ z = lnot a ; store z, l ]
+|}
+)***" );
+
+    const auto output = execute( "wide-arithmetic", *module, R"***(
+static void print( cjel_b100 a, cjel_b100 b )
+{
+    cjel_b100 q, m;
+    uint8_t l;
+    wide( a, b, &q, &m, &l );
+    printf( "%llx %llx %llx %llx %u\n", (unsigned long long)q.word[ 1 ],
+        (unsigned long long)q.word[ 0 ], (unsigned long long)m.word[ 1 ],
+        (unsigned long long)m.word[ 0 ], l );
+}
+
+int main( void )
+{
+    print( ( cjel_b100 ){ { 5, 1 } }, ( cjel_b100 ){ { 3, 0 } } );
+    print( ( cjel_b100 ){ { UINT64_C( 0xfffffffffffffff9 ), UINT64_C( 0xfffffffff ) } },
+        ( cjel_b100 ){ { 2, 0 } } );
+    print( ( cjel_b100 ){ { 7, 0 } },
+        ( cjel_b100 ){ { UINT64_C( 0xfffffffffffffffe ), UINT64_C( 0xfffffffff ) } } );
+    print( ( cjel_b100 ){ { 0, 0 } }, ( cjel_b100 ){ { 0, 1 } } );
+    return 0;
+}
+)***" );
+
+    EXPECT_EQ( output, "0 5555555555555557 0 0 0\n"
+                       "fffffffff fffffffffffffffd 0 1 0\n"
+                       "fffffffff fffffffffffffffd 0 7 0\n"
+                       "0 0 0 0 1\n" );
+}
+
+TEST( libcjel_ir__c11, unsupported )
+{
+    const auto module = parse( R"***(
+memory heap : u32 -> 4
+
+function f( u100 i ) -> ( u32 r )
+{|
+    [ a = extract heap, i ; x = load a ; store x, r ]
+|}
+)***" );
+
+    EXPECT_THROW( CjelIRToC11Pass::emit( *module ), std::domain_error );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -60,6 +60,10 @@ static void test_constant_bit( u64 i, i16 s )
 
     EXPECT_STREQ( v->name().c_str(), std::to_string( i_mask ).c_str() );
 
+    std::string output = "x";
+    v->appendName( output );
+    EXPECT_EQ( output, "x" + v->name() );
+
     if( v->name().compare( std::to_string( i_mask ) ) )
     {
         printf( "input: '%lu' with bitsize: '%lu'\n", i, v->type().bitsize() );
@@ -0,0 +1,135 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "../main.h"
+
+using namespace libcjel_ir;
+
+TEST( libcjel_ir__constant_pool, bit_constants_are_unique )
+{
+    ConstantPool pool;
+
+    auto a = pool.bit( 1, 0 );
+    auto b = pool.bit( 1, 1 );
+    auto c = pool.bit( libstdhl::Memory::make< BitType >( 1 ), 0 );
+    auto d = pool.bit( 2, 0 );
+
+    EXPECT_EQ( a, c );
+    EXPECT_NE( a, b );
+    EXPECT_NE( a, d );
+    EXPECT_EQ( pool.size(), 3 );
+
+    for( u32 i = 0; i < 1000; i++ )
+    {
+        EXPECT_EQ( pool.bit( 1, i % 2 ), i % 2 ? b : a );
+    }
+
+    EXPECT_EQ( pool.size(), 3 );
+}
+
+TEST( libcjel_ir__constant_pool, bit_constant_hash_depends_on_payload )
+{
+    BitConstant a( 8, 1 );
+    BitConstant b( 8, 2 );
+    BitConstant c( 16, 1 );
+
+    EXPECT_NE( a.hash(), b.hash() );
+    EXPECT_NE( a.hash(), c.hash() );
+    EXPECT_TRUE( a.equals( BitConstant( 8, 1 ) ) );
+    EXPECT_FALSE( a.equals( b ) );
+    EXPECT_FALSE( a.equals( c ) );
+}
+
+TEST( libcjel_ir__constant_pool, string_constants_are_unique )
+{
+    ConstantPool pool;
+
+    auto a = pool.string( "foo" );
+    auto b = pool.string( "bar" );
+
+    EXPECT_EQ( a, pool.string( "foo" ) );
+    EXPECT_NE( a, b );
+    EXPECT_NE( a->hash(), b->hash() );
+}
+
+TEST( libcjel_ir__constant_pool, structure_constants_are_unique )
+{
+    ConstantPool pool;
+
+    auto t0 = libstdhl::Memory::get< BitType >( 10 );
+    auto s0 = libstdhl::Memory::make< StructureType >( libstdhl::Memory::make< Structure >(
+        "s0", std::initializer_list< StructureElement >{ { t0, "x" }, { t0, "y" } } ) );
+
+    auto a = pool.structure( s0, { BitConstant( t0, 1 ), BitConstant( t0, 2 ) } );
+    auto b = pool.structure( s0, { BitConstant( t0, 1 ), BitConstant( t0, 2 ) } );
+    auto c = pool.structure( s0, { BitConstant( t0, 2 ), BitConstant( t0, 1 ) } );
+
+    EXPECT_EQ( a, b );
+    EXPECT_NE( a, c );
+    EXPECT_NE( a->hash(), c->hash() );
+}
+
+TEST( libcjel_ir__constant_pool, get_interns_existing_constants )
+{
+    ConstantPool pool;
+
+    auto a = pool.get( libstdhl::Memory::make< BitConstant >( 32, 7 ) );
+    auto b = pool.get( libstdhl::Memory::make< BitConstant >( 32, 7 ) );
+    auto c = pool.bit( 32, 7 );
+    auto t = libstdhl::Memory::get< BitType >( 64 );
+    auto d = pool.get( libstdhl::Memory::make< Identifier >( t, "id" ) );
+    auto e = pool.identifier( t, "id" );
+
+    EXPECT_EQ( a, b );
+    EXPECT_EQ( a, c );
+    EXPECT_EQ( d, e );
+    EXPECT_EQ( pool.size(), 2 );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,136 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static const std::string SOURCE = R"***(
+function f( u8 x ) -> ( u8 r )
+{|
+    branch [ e = equ x, x ]
+    {| [ store 1 : u8, r ] |}
+|}
+)***";
+
+static std::string strip( const std::string& dump )
+{
+    // removes the addresses of the values
+    std::string result;
+    std::size_t begin = 0;
+    while( begin < dump.size() )
+    {
+        const auto end = dump.find( '\n', begin );
+        const auto address = dump.find( ": 0x", begin );
+        const auto rest = dump.find( ", ", address );
+        result += dump.substr( begin, address - begin ) + ":" +
+                  dump.substr( rest + 1, end - rest );
+        begin = end + 1;
+    }
+    return result;
+}
+
+TEST( libcjel_ir__dump, lines_and_indentation )
+{
+    const auto module = parse( SOURCE, "dump" );
+
+    EXPECT_STREQ( strip( CjelIRDumpPass::dump( *module ) ).c_str(),
+        "visit_prolog  : dump, dump \n"
+        "visit_prolog  : f, f \n"
+        "visit_prolog  : x, x u8 in\n"
+        "visit_prolog  : r, r u8 out\n"
+        "visit_prolog  : seq, seq \n"
+        "visit_prolog  : branch,   branch \n"
+        "visit_prolog  : equ,     equ , x (u8), x (u8)\n"
+        "visit_prolog  : seq,     seq \n"
+        "visit_prolog  : stmt,       stmt \n"
+        "visit_prolog  : store,         store , 1 (u8), r (u8)\n" );
+}
+
+TEST( libcjel_ir__dump, sink_receives_all_chunks )
+{
+    const auto module = libstdhl::Memory::make< Module >( "dump" );
+    auto t = BitType::get( 32 );
+
+    auto function = module->make< Function >( "f",
+        libstdhl::Memory::make< RelationType >(
+            std::vector< Type::Ptr >{ t }, std::vector< Type::Ptr >{ t } ) );
+    auto a = module->make< Reference >( "a", t, Reference::INPUT );
+    function->add( a );
+    auto r = module->make< Reference >( "r", t, Reference::OUTPUT );
+    function->add( r );
+
+    auto scope = module->make< SequentialScope >();
+    function->setContext( scope );
+
+    // more than one buffer of output
+    for( u32 c = 0; c < 20000; c++ )
+    {
+        auto stmt = module->make< TrivialStatement >();
+        auto load = stmt->add( module->make< LoadInstruction >( a ) );
+        stmt->add( module->make< StoreInstruction >( load, r ) );
+        scope->add( stmt );
+    }
+    module->add( function );
+
+    std::string streamed;
+    u32 chunks = 0;
+    CjelIRDumpPass::dump( *module, [&]( const char* data, std::size_t size ) {
+        streamed.append( data, size );
+        chunks++;
+    } );
+
+    EXPECT_GT( chunks, 1 );
+    EXPECT_EQ( streamed, CjelIRDumpPass::dump( *module ) );
+
+    ThreadPool pool( 2 );
+    EXPECT_EQ( CjelIRDumpPass::dump( *module, pool ), streamed );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,185 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static const Variable& counter( const Module::Ptr& module )
+{
+    return static_cast< const Variable& >( *module->get< Variable >()[ 0 ] );
+}
+
+static u64 count( const Function& function, Value::ID id )
+{
+    u64 result = 0;
+    const_cast< Function& >( function ).iterate(
+        Traversal::PREORDER, [&result, id]( Value& value ) { result += value.id() == id; } );
+    return result;
+}
+
+static const std::string SOURCE = R"***(
+variable counter : u32 = 5
+
+function pure.add( u32 a, u32 b ) -> ( u32 r )
+{|
+    [ c = addu a, b ; store c, r ]
+|}
+
+function bump( u32 a ) -> ( u32 r )
+{|
+    [ c = load counter ; d = addu c, a ; store d, counter ; store d, r ]
+|}
+
+function f( u32 x ) -> ( u32 r )
+{|
+    [ a = addu x, 1 : u32 ; b = xor a, x ; nop ]
+    {
+        [ c = addu x, 2 : u32 ]
+        [ d = divs x, 3 : u32 ]
+    }
+    [ e = call pure.add, x, x ]
+    [ g = call bump, x ]
+    [ h = divs x, x ]
+    branch [ i = equ x, 0 : u32 ]
+    {| [ j = addu x, 4 : u32 ] |}
+    {| {| [ nop ] |} |}
+    [ k = alloc -> u32 ]
+    loop [ l = load k ; m = neq l, 0 : u32 ]
+    {| [ n = addu l, 1 : u32 ] |}
+    [ o = addu x, 5 : u32 ; store o, r ]
+|}
+)***";
+
+TEST( libcjel_ir__elimination, removes_dead_code_bottom_up )
+{
+    const auto module = parse( SOURCE );
+    const auto& f = lookup( module, "f" );
+
+    Interpreter before;
+    std::vector< u64 > expected;
+    for( const u64 input : { 1, 7, 1000 } )
+    {
+        const auto outputs = before.run( f, { BitConstant( BitType::get( 32 ), input ) } );
+        expected.emplace_back( outputs[ 0 ].value().value() );
+        expected.emplace_back( before.load( counter( module ) ).value().value() );
+    }
+
+    // 'a', 'b' and the 'nop', 'c' and 'd', the pure call 'e', 'j', the
+    // 'nop' and the condition 'i' of the emptied branch and 'n'
+    EXPECT_EQ( CjelIRDeadCodeEliminationPass::eliminate( *module ), 10 );
+    EXPECT_EQ( CjelIRDeadCodeEliminationPass::eliminate( *module ), 0 );
+
+    EXPECT_EQ( f.context()->blocks().size(), 5 );
+    EXPECT_EQ( count( f, Value::PARALLEL_SCOPE ), 0 );
+    EXPECT_EQ( count( f, Value::BRANCH_STATEMENT ), 0 );
+    EXPECT_EQ( count( f, Value::NOP_INSTRUCTION ), 0 );
+    EXPECT_EQ( count( f, Value::CALL_INSTRUCTION ), 1 );
+    EXPECT_EQ( count( f, Value::DIVS_INSTRUCTION ), 1 );
+    EXPECT_EQ( count( f, Value::LOOP_STATEMENT ), 1 );
+
+    Interpreter after;
+    std::vector< u64 > actual;
+    for( const u64 input : { 1, 7, 1000 } )
+    {
+        const auto outputs = after.run( f, { BitConstant( BitType::get( 32 ), input ) } );
+        actual.emplace_back( outputs[ 0 ].value().value() );
+        actual.emplace_back( after.load( counter( module ) ).value().value() );
+    }
+
+    EXPECT_EQ( actual, expected );
+    EXPECT_LT( after.executed(), before.executed() );
+}
+
+TEST( libcjel_ir__elimination, keeps_used_conditions_and_effects )
+{
+    const auto module = parse( R"***(
+memory heap : u8 -> 4
+
+function g( u8 x ) -> ( u8 r )
+{|
+    branch [ a = equ x, 1 : u8 ] {| [ b = addu x, 1 : u8 ] |}
+    [ c = zext a -> u8 ; store c, r ]
+    [ d = extract heap, x ; e = extract heap, 3 : u8 ; f = modu x, 0 : u8 ]
+|}
+)***" );
+    const auto& g = lookup( module, "g" );
+
+    // the condition 'a' is used after its branch, 'd' and 'f' may fault
+    EXPECT_EQ( CjelIRDeadCodeEliminationPass::eliminate( *module ), 2 );
+
+    EXPECT_EQ( count( g, Value::BRANCH_STATEMENT ), 1 );
+    EXPECT_EQ( count( g, Value::SEQUENTIAL_SCOPE ), 2 );
+    EXPECT_EQ( count( g, Value::EXTRACT_INSTRUCTION ), 1 );
+    EXPECT_EQ( count( g, Value::MODU_INSTRUCTION ), 1 );
+}
+
+TEST( libcjel_ir__elimination, generated_module_behaves_equally )
+{
+    Generator::Options options;
+    options.instructions = 20000;
+    options.functions = 20;
+    options.seed = 11;
+    options.mix.emplace_back( Value::NOP_INSTRUCTION, 1 );
+
+    const auto module = Generator( options ).generate();
+
+    Interpreter before;
+    const auto expected = execute( before, *module );
+    const auto code = CjelIRToC11Pass::emit( *module ).size();
+
+    EXPECT_GT( CjelIRDeadCodeEliminationPass::eliminate( *module ), 0 );
+
+    Interpreter after;
+    EXPECT_EQ( execute( after, *module ), expected );
+    EXPECT_LT( after.executed(), before.executed() );
+    EXPECT_LT( CjelIRToC11Pass::emit( *module ).size(), code );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
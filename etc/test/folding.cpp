@@ -0,0 +1,256 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static u64 count( Module& module )
+{
+    u64 result = 0;
+    module.iterate(
+        Traversal::PREORDER, [&result]( Value& value ) { result += isa< Instruction >( value ); } );
+    return result;
+}
+
+static std::vector< const BitConstant* > stored( Module& module )
+{
+    std::vector< const BitConstant* > result;
+    module.iterate( Traversal::PREORDER, [&result]( Value& value ) {
+        if( isa< StoreInstruction >( value ) )
+        {
+            const auto& operand = static_cast< StoreInstruction& >( value ).operand( 0 );
+            result.emplace_back( isa< BitConstant >( operand )
+                                     ? static_cast< const BitConstant* >( operand.get() )
+                                     : nullptr );
+        }
+    } );
+    return result;
+}
+
+TEST( libcjel_ir__folding, chains_fold_to_a_fixpoint )
+{
+    const auto module = parse( R"***(
+function f( u8 x ) -> ( u8 r )
+{|
+    [ a = addu 250 : u8, 10 : u8
+    ; b = xor a, 255 : u8
+    ; c = zext b -> u32
+    ; d = addu c, 4294967295 : u32
+    ; e = trunc d -> u8
+    ; store e, r
+    ]
+    branch [ g = not 0 : u8 ; h = equ g, 255 : u8 ]
+    {| [ i = addu x, x ; j = addu i, 1 : u8 ; store j, r ] |}
+|}
+)***" );
+
+    const auto before = count( *module );
+    EXPECT_EQ( CjelIRConstantFoldingPass::fold( *module ), 6 );
+    EXPECT_EQ( count( *module ), before - 6 );
+
+    // 250 + 10 = 4, 4 ^ 255 = 251, 251 + 0xffffffff = 250
+    const auto values = stored( *module );
+    ASSERT_EQ( values.size(), 2 );
+    ASSERT_TRUE( values[ 0 ] );
+    EXPECT_EQ( values[ 0 ]->value().value(), 250 );
+    EXPECT_EQ( values[ 0 ]->type().bitsize(), 8 );
+    EXPECT_FALSE( values[ 1 ] );
+
+    // the condition of the branch is kept with a folded operand
+    module->iterate( Traversal::PREORDER, []( Value& value ) {
+        if( isa< BranchStatement >( value ) )
+        {
+            const auto& instructions = static_cast< BranchStatement& >( value ).instructions();
+            ASSERT_EQ( instructions.size(), 1 );
+            EXPECT_TRUE( isa< EquInstruction >( *instructions.begin() ) );
+        }
+    } );
+
+    EXPECT_EQ( CjelIRConstantFoldingPass::fold( *module ), 0 );
+}
+
+TEST( libcjel_ir__folding, matches_interpreter )
+{
+    static const std::vector< std::pair< std::string, u32 > > operators = {
+        { "addu", 2 }, { "adds", 2 }, { "divs", 2 }, { "modu", 2 }, { "and", 2 }, { "or", 2 },
+        { "xor", 2 }, { "equ", 2 }, { "neq", 2 }, { "not", 1 }, { "lnot", 1 }, { "zext", 1 },
+        { "trunc", 1 },
+    };
+    static const std::vector< u16 > widths = { 1, 5, 8, 16, 31, 32, 33, 63, 64 };
+
+    u64 state = 0x9e3779b97f4a7c15;
+    const auto random = [&state]( u16 bits ) {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        const u64 value = state * 0x2545f4914f6cdd1d;
+        return bits >= 64 ? value : value & ( ( (u64)1 << bits ) - 1 );
+    };
+
+    std::string source;
+    std::vector< std::string > names;
+    for( const auto& op : operators )
+    {
+        for( const auto bits : widths )
+        {
+            for( u32 c = 0; c < 8; c++ )
+            {
+                const auto type = "u" + std::to_string( bits );
+                const auto lhs = std::to_string( random( bits ) ) + " : " + type;
+                auto rhs = random( bits );
+                rhs = ( op.first == "divs" or op.first == "modu" ) and rhs == 0 ? 1 : rhs;
+
+                // the special values of the signed division
+                if( op.first == "divs" and c < 2 and bits > 1 )
+                {
+                    rhs = bits == 64 ? ~( (u64)0 ) : ( ( (u64)1 << bits ) - 1 );
+                }
+
+                std::string result = type;
+                std::string expression = op.first + " " + lhs;
+                if( op.first == "zext" or op.first == "trunc" )
+                {
+                    const i32 step = ( op.first == "zext" ? 1 : -1 ) * (i32)( 1 + c * 4 );
+                    result = "u" + std::to_string( std::min( 64, std::max( 1, bits + step ) ) );
+                    expression += " -> " + result;
+                }
+                else if( op.second == 2 )
+                {
+                    expression += ", " + std::to_string( rhs ) + " : " + type;
+                }
+
+                if( op.first == "equ" or op.first == "neq" or op.first == "lnot" )
+                {
+                    result = "u1";
+                }
+
+                const auto name = "f" + std::to_string( names.size() );
+                names.emplace_back( name );
+                source += "function " + name + "( u8 x ) -> ( " + result + " r )\n{| [ v = " +
+                          expression + " ; store v, r ] |}\n";
+            }
+        }
+    }
+
+    const auto module = parse( source );
+
+    const auto run = [&]( std::vector< u64 >& results ) {
+        Interpreter interpreter;
+        for( const auto& value : module->get< Function >() )
+        {
+            const auto& function = static_cast< const Function& >( *value );
+            const auto outputs =
+                interpreter.run( function, { BitConstant( BitType::get( 8 ), 0 ) } );
+            results.emplace_back( outputs[ 0 ].value().value() );
+        }
+    };
+
+    std::vector< u64 > expected;
+    run( expected );
+
+    EXPECT_EQ( CjelIRConstantFoldingPass::fold( *module ), names.size() );
+
+    std::vector< u64 > actual;
+    run( actual );
+
+    ASSERT_EQ( actual.size(), expected.size() );
+    for( std::size_t c = 0; c < expected.size(); c++ )
+    {
+        EXPECT_EQ( actual[ c ], expected[ c ] ) << names[ c ];
+    }
+
+    for( const auto value : stored( *module ) )
+    {
+        EXPECT_TRUE( value );
+    }
+}
+
+TEST( libcjel_ir__folding, wide_results_are_exact )
+{
+    const auto module = parse( R"***(
+function f( u8 x ) -> ( u128 r )
+{|
+    [ a = addu 18446744073709551615 : u128, 0 : u128 ; store a, r ]
+    [ b = addu 18446744073709551615 : u128, 1 : u128 ; store b, r ]
+    [ c = not 0 : u128 ; store c, r ]
+    [ d = divs 18446744073709551615 : u128, 5 : u128 ; store d, r ]
+    [ e = zext 18446744073709551615 : u64 -> u128 ; store e, r ]
+    [ f = trunc 255 : u512 -> u128 ; g = xor f, 15 : u128 ; store g, r ]
+    [ h = modu 7 : u256, 0 : u256 ; i = zext h -> u512 ; j = trunc i -> u128 ; store j, r ]
+|}
+)***" );
+
+    EXPECT_EQ( CjelIRConstantFoldingPass::fold( *module ), 5 );
+
+    const auto values = stored( *module );
+    ASSERT_EQ( values.size(), 7 );
+
+    ASSERT_TRUE( values[ 0 ] );
+    EXPECT_EQ( values[ 0 ]->value().value(), 18446744073709551615u );
+    EXPECT_EQ( values[ 0 ]->type().bitsize(), 128 );
+
+    // the carry and the inverted high bits do not fit, nothing is truncated
+    EXPECT_FALSE( values[ 1 ] );
+    EXPECT_FALSE( values[ 2 ] );
+
+    ASSERT_TRUE( values[ 3 ] );
+    EXPECT_EQ( values[ 3 ]->value().value(), 3689348814741910323u );
+
+    ASSERT_TRUE( values[ 4 ] );
+    EXPECT_EQ( values[ 4 ]->value().value(), 18446744073709551615u );
+
+    ASSERT_TRUE( values[ 5 ] );
+    EXPECT_EQ( values[ 5 ]->value().value(), 240 );
+
+    // the division by zero stays a runtime fault
+    EXPECT_FALSE( values[ 6 ] );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,169 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static std::string signature( Module& module )
+{
+    std::string result;
+    module.iterate( Traversal::PREORDER, [&result]( Value& value ) {
+        result += value.name() + ":" + value.type().name() + ";";
+    } );
+    return result;
+}
+
+static u64 count( Module& module )
+{
+    u64 result = 0;
+    module.iterate(
+        Traversal::PREORDER, [&result]( Value& value ) { result += isa< Instruction >( value ); } );
+    return result;
+}
+
+TEST( libcjel_ir__generator, exact_and_deterministic )
+{
+    Generator::Options options;
+    options.instructions = 10007;
+    options.functions = 10;
+    options.seed = 42;
+
+    const auto a = Generator( options ).generate();
+    const auto b = Generator( options ).generate();
+
+    EXPECT_EQ( count( *a ), 10007 );
+    EXPECT_EQ( a->get< Function >().size(), 10 );
+    EXPECT_EQ( signature( *a ), signature( *b ) );
+
+    options.seed = 43;
+    const auto c = Generator( options ).generate();
+
+    EXPECT_EQ( count( *c ), 10007 );
+    EXPECT_NE( signature( *a ), signature( *c ) );
+}
+
+TEST( libcjel_ir__generator, mix_widths_and_depth )
+{
+    Generator::Options options;
+    options.instructions = 5000;
+    options.functions = 5;
+    options.depth = 0;
+    options.mix = { { Value::ADDU_INSTRUCTION, 1 }, { Value::STORE_INSTRUCTION, 1 } };
+    options.widths = { { 13, 1 } };
+
+    const auto module = Generator( options ).generate();
+
+    module->iterate( Traversal::PREORDER, []( Value& value ) {
+        if( isa< Instruction >( value ) )
+        {
+            EXPECT_TRUE( isa< AddUnsignedInstruction >( value ) or
+                         isa< LoadInstruction >( value ) or isa< StoreInstruction >( value ) );
+        }
+        else if( isa< Scope >( value ) )
+        {
+            for( const auto& block : static_cast< Scope& >( value ).blocks() )
+            {
+                EXPECT_TRUE( isa< TrivialStatement >( block ) );
+            }
+        }
+        else if( isa< Function >( value ) )
+        {
+            EXPECT_EQ( value.type().results()[ 0 ]->name(), "u13" );
+        }
+    } );
+}
+
+TEST( libcjel_ir__generator, valid_for_interpreter_and_backends )
+{
+    Generator::Options options;
+    options.instructions = 20000;
+    options.functions = 20;
+    options.seed = 7;
+    options.mix.emplace_back( Value::LNOT_INSTRUCTION, 1 );
+    options.mix.emplace_back( Value::NOP_INSTRUCTION, 1 );
+
+    const auto module = Generator( options ).generate();
+
+    EXPECT_NO_THROW( execute( *module ) );
+
+    EXPECT_NO_THROW( CjelIRToC11Pass::emit( *module ) );
+    EXPECT_NO_THROW( CjelIRToLLPass::emit( *module ) );
+}
+
+TEST( libcjel_ir__generator, parallel_blocks_are_independent )
+{
+    Generator::Options options;
+    options.instructions = 20000;
+    options.functions = 20;
+    options.seed = 11;
+
+    const auto module = Generator( options ).generate();
+
+    const auto expected = execute( *module );
+    EXPECT_GT( reverse( *module ), 0 );
+    EXPECT_EQ( execute( *module ), expected );
+}
+
+TEST( libcjel_ir__generator, invalid_options )
+{
+    Generator::Options options;
+    options.mix = { { Value::ID_CALL_INSTRUCTION, 1 } };
+    EXPECT_THROW( Generator{ options }, std::domain_error );
+
+    options = Generator::Options();
+    options.widths = { { 0, 1 } };
+    EXPECT_THROW( Generator{ options }, std::domain_error );
+
+    options = Generator::Options();
+    options.functions = 0;
+    EXPECT_THROW( Generator{ options }, std::domain_error );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -56,6 +56,42 @@ TEST( libcjel_ir, instruction )
     auto i_add = AddSignedInstruction( c, c );
 }
 
+TEST( libcjel_ir, instruction_hash_is_structural )
+{
+    auto a = std::make_shared< AllocInstruction >( BitType::get( 8 ) );
+    auto b = std::make_shared< AllocInstruction >( BitType::get( 8 ) );
+    auto one = std::make_shared< BitConstant >( 8, 1 );
+    auto also_one = std::make_shared< BitConstant >( 8, 1 );
+
+    // commutative operands in any order, constants by value
+    const AddUnsignedInstruction ab( a, b );
+    const AddUnsignedInstruction ba( b, a );
+    const AddUnsignedInstruction a1( a, one );
+    const AddUnsignedInstruction a1_( a, also_one );
+    EXPECT_EQ( ab.hash(), ba.hash() );
+    EXPECT_TRUE( ab.congruent( ba ) );
+    EXPECT_EQ( a1.hash(), a1_.hash() );
+    EXPECT_TRUE( a1.congruent( a1_ ) );
+    EXPECT_FALSE( ab.congruent( a1 ) );
+
+    // the opcode, the operand order of other operators and the result type
+    const AddSignedInstruction signed_ab( a, b );
+    const DivSignedInstruction div_ab( a, b );
+    const DivSignedInstruction div_ba( b, a );
+    const ZeroExtendInstruction wide( a, BitType::get( 16 ) );
+    const ZeroExtendInstruction wider( a, BitType::get( 32 ) );
+    EXPECT_NE( ab.hash(), signed_ab.hash() );
+    EXPECT_FALSE( ab.congruent( signed_ab ) );
+    EXPECT_FALSE( div_ab.congruent( div_ba ) );
+    EXPECT_NE( wide.hash(), wider.hash() );
+    EXPECT_FALSE( wide.congruent( wider ) );
+    EXPECT_TRUE( wide.congruent( ZeroExtendInstruction( a, BitType::get( 16 ) ) ) );
+
+    // every alloc is its own operand identity
+    EXPECT_FALSE(
+        AddUnsignedInstruction( a, one ).congruent( AddUnsignedInstruction( b, one ) ) );
+}
+
 //
 //  Local variables:
 //  mode: c++
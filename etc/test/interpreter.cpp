@@ -0,0 +1,225 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static BitConstant u( u16 bitsize, u64 value )
+{
+    return BitConstant( BitType::get( bitsize ), value );
+}
+
+static std::vector< u64 > values( const std::vector< BitConstant >& constants )
+{
+    std::vector< u64 > result;
+    for( const auto& constant : constants )
+    {
+        result.emplace_back( constant.value().value() );
+    }
+    return result;
+}
+
+static const std::string CASMRT = R"***(
+struct Int { u32 value, u1 isdef }
+
+function casmrt.add( Int ra, Int rb ) -> ( Int rt )
+{|
+    [ va = load ra.value
+    ; vb = load rb.value
+    ; vt = adds va, vb
+    ; store vt, rt.value
+    ]
+    [ ua = load ra.isdef
+    ; ub = load rb.isdef
+    ; ut = and ua, ub
+    ; store ut, rt.isdef
+    ]
+|}
+
+function casmrt.add.parallel( Int ra, Int rb ) -> ( Int rt )
+{|
+    {
+        [ va = load ra.value ]
+        [ vb = load rb.value ]
+        [ ua = load ra.isdef ]
+        [ ub = load rb.isdef ]
+    }
+    {
+        [ vt = adds va, vb ; store vt, rt.value ]
+        [ ut = and ua, ub ; store ut, rt.isdef ]
+    }
+|}
+)***";
+
+TEST( libcjel_ir__interpreter, casmrt_add )
+{
+    const auto module = parse( CASMRT );
+    Interpreter interpreter;
+
+    for( const auto name : { "casmrt.add", "casmrt.add.parallel" } )
+    {
+        const auto& function = lookup< Function >( module, name );
+
+        EXPECT_EQ( values( interpreter.run(
+                       function, { u( 32, 40 ), u( 1, 1 ), u( 32, 2 ), u( 1, 1 ) } ) ),
+            ( std::vector< u64 >{ 42, 1 } ) );
+
+        EXPECT_EQ( values( interpreter.run(
+                       function, { u( 32, 0xffffffff ), u( 1, 1 ), u( 32, 2 ), u( 1, 0 ) } ) ),
+            ( std::vector< u64 >{ 1, 0 } ) );
+    }
+
+    EXPECT_GT( interpreter.executed(), 0 );
+}
+
+TEST( libcjel_ir__interpreter, branch_and_loop )
+{
+    const auto module = parse( R"***(
+function sum( u32 n ) -> ( u32 r )
+{|
+    [ i = alloc -> u32 ; store 0 : u32, r ]
+    loop [ c = load i ; x = neq c, n ]
+    {|
+        [ d = load i ; e = addu d, 1 : u32 ; store e, i ; f = load r ; g = addu f, e ; store g, r ]
+    |}
+|}
+
+function select( u8 a, u8 b ) -> ( u8 r )
+{|
+    branch [ e = equ a, b ]
+    {| [ store 1 : u8, r ] |}
+    {| [ store 2 : u8, r ] |}
+|}
+)***" );
+
+    Interpreter interpreter;
+    const auto& sum = lookup< Function >( module, "sum" );
+    const auto& select = lookup< Function >( module, "select" );
+
+    EXPECT_EQ( interpreter.run( sum, { u( 32, 0 ) } )[ 0 ].value().value(), 0 );
+    EXPECT_EQ( interpreter.run( sum, { u( 32, 10 ) } )[ 0 ].value().value(), 55 );
+    EXPECT_EQ( interpreter.run( select, { u( 8, 3 ), u( 8, 3 ) } )[ 0 ].value().value(), 1 );
+    EXPECT_EQ( interpreter.run( select, { u( 8, 3 ), u( 8, 4 ) } )[ 0 ].value().value(), 2 );
+}
+
+TEST( libcjel_ir__interpreter, globals_and_calls )
+{
+    const auto module = parse( R"***(
+variable counter : u32 = 5
+memory heap : u32 -> 4
+
+function mem.put( u32 i, u32 v ) -> ( u32 r )
+{|
+    [ a = extract heap, i ; store v, a ]
+    [ c = load counter ; d = addu c, 1 : u32 ; store d, counter ; store d, r ]
+|}
+
+function main( u32 i ) -> ( u32 r )
+{|
+    [ x = call mem.put, i, 7 : u32 ; store x, r ]
+|}
+)***" );
+
+    Interpreter interpreter;
+    const auto& main = lookup< Function >( module, "main" );
+    const auto& counter = lookup< Variable >( module, "counter" );
+    const auto& heap = lookup< Memory >( module, "heap" );
+
+    EXPECT_EQ( interpreter.run( main, { u( 32, 2 ) } )[ 0 ].value().value(), 6 );
+    EXPECT_EQ( interpreter.load( counter ).value().value(), 6 );
+    EXPECT_EQ( interpreter.load( heap, 2 ).value().value(), 7 );
+    EXPECT_EQ( interpreter.load( heap, 1 ).value().value(), 0 );
+
+    interpreter.store( counter, u( 32, 100 ) );
+    EXPECT_EQ( interpreter.run( main, { u( 32, 3 ) } )[ 0 ].value().value(), 101 );
+    EXPECT_EQ( interpreter.load( heap, 3 ).value().value(), 7 );
+
+    EXPECT_THROW( interpreter.run( main, { u( 32, 4 ) } ), std::domain_error );
+    EXPECT_THROW( interpreter.load( heap, 4 ), std::domain_error );
+}
+
+TEST( libcjel_ir__interpreter, arithmetic )
+{
+    const auto module = parse( R"***(
+function f( u8 a, u8 b ) -> ( u8 q, u8 m, u8 n, u1 l, u4 t )
+{|
+    [ x = divs a, b ; store x, q ]
+    [ y = modu a, b ; store y, m ]
+    [ z = not a ; store z, n ]
+    [ w = lnot b ; store w, l ]
+    [ v = trunc a -> u4 ; store v, t ]
+|}
+)***" );
+
+    Interpreter interpreter;
+    const auto& f = lookup< Function >( module, "f" );
+
+    // -7 / 2 == -3 in 8-bit two's complement
+    EXPECT_EQ( values( interpreter.run( f, { u( 8, 0xf9 ), u( 8, 2 ) } ) ),
+        ( std::vector< u64 >{ 0xfd, 0xf9 % 2, 0x06, 0, 0x9 } ) );
+
+    // -128 / -1 wraps around
+    EXPECT_EQ( values( interpreter.run( f, { u( 8, 0x80 ), u( 8, 0xff ) } ) )[ 0 ], 0x80 );
+
+    EXPECT_THROW( interpreter.run( f, { u( 8, 1 ), u( 8, 0 ) } ), std::domain_error );
+}
+
+TEST( libcjel_ir__interpreter, invalid_arguments )
+{
+    const auto module = parse( CASMRT );
+    const auto& function = lookup< Function >( module, "casmrt.add" );
+
+    Interpreter interpreter;
+    EXPECT_THROW( interpreter.run( function, { u( 32, 1 ) } ), std::domain_error );
+    EXPECT_THROW( interpreter.run( function, { u( 32, 1 ), u( 1, 1 ), u( 8, 2 ), u( 1, 1 ) } ),
+        std::domain_error );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
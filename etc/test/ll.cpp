@@ -0,0 +1,244 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static const std::string SOURCE = R"***(
+struct Int { u32 value, u1 isdef }
+
+memory heap : u100 -> 8
+
+function casmrt.add( Int ra, Int rb ) -> ( Int rt )
+{|
+    [ va = load ra.value ; vb = load rb.value ; vt = adds va, vb ; store vt, rt.value ]
+    [ ua = load ra.isdef ; ub = load rb.isdef ; ut = and ua, ub ; store ut, rt.isdef ]
+|}
+
+function sum( u100 n ) -> ( u100 r )
+{|
+    [ i = alloc -> u100 ; store 0 : u100, r ]
+    loop [ c = load i ; x = neq c, n ]
+    {|
+        [ d = load i ; e = addu d, 1 : u100 ; store e, i ; f = load r ; g = addu f, e ; store g, r ]
+    |}
+|}
+
+function main( u8 i ) -> ( u100 r )
+{|
+    [ s = call sum, 10 : u100 ; a = extract heap, i ; v = load s ; store v, a ; store v, r ]
+|}
+)***";
+
+static const std::string GOLDEN = R"***(; ModuleID = 'll'
+source_filename = "ll"
+
+%Int = type <{ i32, i1 }>
+
+@heap = internal global [8 x i100] zeroinitializer
+
+define void @casmrt.add(ptr %ra, ptr %rb, ptr %rt) {
+entry:
+  %.0 = getelementptr inbounds %Int, ptr %ra, i32 0, i32 0
+  %.1 = load i32, ptr %.0
+  %.2 = getelementptr inbounds %Int, ptr %rb, i32 0, i32 0
+  %.3 = load i32, ptr %.2
+  %.4 = add i32 %.1, %.3
+  %.5 = getelementptr inbounds %Int, ptr %rt, i32 0, i32 0
+  store i32 %.4, ptr %.5
+  %.6 = getelementptr inbounds %Int, ptr %ra, i32 0, i32 1
+  %.7 = load i1, ptr %.6
+  %.8 = getelementptr inbounds %Int, ptr %rb, i32 0, i32 1
+  %.9 = load i1, ptr %.8
+  %.10 = and i1 %.7, %.9
+  %.11 = getelementptr inbounds %Int, ptr %rt, i32 0, i32 1
+  store i1 %.10, ptr %.11
+  ret void
+}
+
+define void @sum(ptr %n, ptr %r) {
+entry:
+  %.0 = alloca i100
+  store i100 zeroinitializer, ptr %.0
+  store i100 0, ptr %r
+  br label %bb.0
+
+bb.0:
+  %.1 = load i100, ptr %.0
+  %.2 = load i100, ptr %n
+  %.3 = icmp ne i100 %.1, %.2
+  br i1 %.3, label %bb.1, label %bb.2
+
+bb.1:
+  %.4 = load i100, ptr %.0
+  %.5 = add i100 %.4, 1
+  store i100 %.5, ptr %.0
+  %.6 = load i100, ptr %r
+  %.7 = add i100 %.6, %.5
+  store i100 %.7, ptr %r
+  br label %bb.0
+
+bb.2:
+  ret void
+}
+
+define void @main(ptr %i, ptr %r) {
+entry:
+  %.0 = alloca i100
+  %.1 = alloca i100
+  store i100 10, ptr %.0
+  call void @sum(ptr %.0, ptr %.1)
+  %.2 = load i8, ptr %i
+  %.3 = zext i8 %.2 to i64
+  %.4 = icmp uge i64 %.3, 8
+  br i1 %.4, label %trap, label %bb.0
+
+bb.0:
+  %.5 = getelementptr inbounds [8 x i100], ptr @heap, i64 0, i64 %.3
+  %.6 = load i100, ptr %.1
+  store i100 %.6, ptr %.5
+  store i100 %.6, ptr %r
+  ret void
+
+trap:
+  call void @llvm.trap()
+  unreachable
+}
+
+declare void @llvm.trap() cold noreturn nounwind
+)***";
+
+TEST( libcjel_ir__ll, golden )
+{
+    const auto module = parse( SOURCE, "ll" );
+
+    EXPECT_EQ( CjelIRToLLPass::emit( *module ), GOLDEN );
+}
+
+TEST( libcjel_ir__ll, deterministic )
+{
+    const auto module = parse( SOURCE, "ll" );
+
+    ThreadPool sequential( 0 );
+    ThreadPool concurrent( 3 );
+
+    EXPECT_EQ( CjelIRToLLPass::emit( *module, sequential ), GOLDEN );
+    EXPECT_EQ( CjelIRToLLPass::emit( *module, concurrent ), GOLDEN );
+}
+
+TEST( libcjel_ir__ll, branch_and_arithmetic )
+{
+    const auto module = parse( R"***(
+function f( u8 a, u8 b ) -> ( u8 q, u1 l )
+{|
+    branch [ e = equ a, b ]
+    {| [ x = divs a, b ; store x, q ] |}
+    {| [ y = lnot b ; store y, l ] |}
+|}
+)***",
+        "ll" );
+
+    EXPECT_EQ( CjelIRToLLPass::emit( *module ), R"***(; ModuleID = 'll'
+source_filename = "ll"
+
+define void @f(ptr %a, ptr %b, ptr %q, ptr %l) {
+entry:
+  %.0 = load i8, ptr %a
+  %.1 = load i8, ptr %b
+  %.2 = icmp eq i8 %.0, %.1
+  br i1 %.2, label %bb.0, label %bb.1
+
+bb.0:
+  %.3 = load i8, ptr %a
+  %.4 = load i8, ptr %b
+  %.5 = icmp eq i8 %.4, 0
+  br i1 %.5, label %trap, label %bb.3
+
+bb.3:
+  %.6 = icmp eq i8 %.4, -1
+  %.7 = select i1 %.6, i8 1, i8 %.4
+  %.8 = sdiv i8 %.3, %.7
+  %.9 = sub i8 0, %.3
+  %.10 = select i1 %.6, i8 %.9, i8 %.8
+  store i8 %.10, ptr %q
+  br label %bb.2
+
+bb.1:
+  %.11 = load i8, ptr %b
+  %.12 = icmp eq i8 %.11, 0
+  store i1 %.12, ptr %l
+  br label %bb.2
+
+bb.2:
+  ret void
+
+trap:
+  call void @llvm.trap()
+  unreachable
+}
+
+declare void @llvm.trap() cold noreturn nounwind
+)***" );
+}
+
+TEST( libcjel_ir__ll, missing_condition )
+{
+    const auto module = parse( R"***(
+function f( u8 a ) -> ( u8 r )
+{|
+    branch [ store a, r ]
+    {| [ store 1 : u8, r ] |}
+|}
+)***" );
+
+    EXPECT_THROW( CjelIRToLLPass::emit( *module ), std::domain_error );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -48,6 +48,81 @@ void libcjel_ir_main_dummy( void )
     libstdhl::Log::defaultSource( source );
 }
 
+using namespace libcjel_ir_test;
+
+Module::Ptr libcjel_ir_test::parse( const std::string& source, const std::string& name )
+{
+    auto module = libstdhl::Memory::make< Module >( name );
+    Parser parser( module );
+    parser.parse( source );
+    return module;
+}
+
+void libcjel_ir_test::flatten( const Type& type, std::vector< BitConstant >& arguments )
+{
+    if( type.isStructure() )
+    {
+        for( const auto& element : type.results() )
+        {
+            flatten( *element, arguments );
+        }
+        return;
+    }
+
+    arguments.emplace_back( BitType::get( type.bitsize() ), 3 );
+}
+
+std::vector< u64 > libcjel_ir_test::execute( Interpreter& interpreter, const Module& module )
+{
+    std::vector< u64 > result;
+    for( const auto& value : module.get< Function >() )
+    {
+        const auto& function = static_cast< const Function& >( *value );
+
+        std::vector< BitConstant > arguments;
+        for( const auto& input : function.inputs() )
+        {
+            flatten( input->type(), arguments );
+        }
+
+        for( const auto& output : interpreter.run( function, arguments ) )
+        {
+            result.emplace_back( output.value().value() );
+        }
+    }
+    return result;
+}
+
+std::vector< u64 > libcjel_ir_test::execute( const Module& module )
+{
+    Interpreter interpreter;
+    return execute( interpreter, module );
+}
+
+u64 libcjel_ir_test::reverse( Module& module )
+{
+    // scopes are collected first, the traversal does not follow edits
+    std::vector< ParallelScope* > scopes;
+    module.iterate( Traversal::PREORDER, [&scopes]( Value& value ) {
+        if( isa< ParallelScope >( value ) )
+        {
+            scopes.emplace_back( static_cast< ParallelScope* >( &value ) );
+        }
+    } );
+
+    for( auto scope : scopes )
+    {
+        std::vector< Block::Ptr > blocks( scope->blocks().begin(), scope->blocks().end() );
+        scope->remove( []( const Block& ) { return true; } );
+        for( auto block = blocks.rbegin(); block != blocks.rend(); ++block )
+        {
+            scope->add( *block );
+        }
+    }
+
+    return scopes.size();
+}
+
 TEST( libcjel_ir_main, empty )
 {
     std::cout << libcjel_ir::REVTAG << "\n";
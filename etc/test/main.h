@@ -46,6 +46,61 @@
 
 #include <libcjel-ir/libcjel-ir>
 
+namespace libcjel_ir_test
+{
+    using namespace libcjel_ir;
+
+    /**
+       parses 'source' into a new module named 'name'
+    */
+
+    Module::Ptr parse( const std::string& source, const std::string& name = "test" );
+
+    /**
+       returns the value of kind 'T' named 'name' of 'module'
+    */
+
+    template < typename T = Function >
+    const T& lookup( const Module::Ptr& module, const std::string& name )
+    {
+        for( const auto& value : module->get< T >() )
+        {
+            if( value->name() == name )
+            {
+                return static_cast< const T& >( *value );
+            }
+        }
+        throw std::domain_error( "'" + name + "' not found" );
+    }
+
+    /**
+       appends an argument of value 3 for every bit element of 'type'
+    */
+
+    void flatten( const Type& type, std::vector< BitConstant >& arguments );
+
+    /**
+       runs every function of 'module' once with the arguments of 'flatten'
+       and returns all outputs in order
+    */
+
+    std::vector< u64 > execute( Interpreter& interpreter, const Module& module );
+
+    /**
+       'execute' with a fresh interpreter, which decodes the current
+       instructions and starts with the initial globals
+    */
+
+    std::vector< u64 > execute( const Module& module );
+
+    /**
+       reverses the blocks of every parallel scope of 'module', returns the
+       number of parallel scopes
+    */
+
+    u64 reverse( Module& module );
+}
+
 #endif  // _LIBCJEL_IR_TEST_MAIN_H_
 
 //
@@ -0,0 +1,184 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <thread>
+
+using namespace libcjel_ir_test;
+
+TEST( libcjel_ir__module, index_disabled_by_default )
+{
+    auto module = libstdhl::Memory::make< Module >( "m" );
+    EXPECT_FALSE( module->hasIndex() );
+
+    auto c = module->make< BitConstant >( 8, 1 );
+    auto i = module->make< AddUnsignedInstruction >( c, c );
+
+    EXPECT_EQ( module->index< AddUnsignedInstruction >().size(), 0 );
+}
+
+TEST( libcjel_ir__module, index_kind_query )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::INDEX );
+    ASSERT_TRUE( module->hasIndex() );
+
+    auto c = module->make< BitConstant >( 8, 1 );
+    auto a0 = module->make< AddUnsignedInstruction >( c, c );
+    auto a1 = module->make< AddUnsignedInstruction >( c, c );
+    auto a2 = module->make< AddUnsignedInstruction >( c, c );
+    auto x0 = module->make< XorInstruction >( c, c );
+
+    EXPECT_EQ( module->index< BitConstant >().size(), 1 );
+    EXPECT_EQ( module->index< AddUnsignedInstruction >().size(), 3 );
+    EXPECT_EQ( module->index< XorInstruction >().size(), 1 );
+    EXPECT_EQ( module->index< ArithmeticInstruction >().size(), 4 );
+    EXPECT_EQ( module->index< Instruction >().size(), 4 );
+    EXPECT_EQ( module->index< Constant >().size(), 1 );
+
+    a0 = nullptr;
+
+    auto adds = module->index< AddUnsignedInstruction >();
+    ASSERT_EQ( adds.size(), 2 );
+    EXPECT_TRUE(
+        ( adds[ 0 ] == a1.get() and adds[ 1 ] == a2.get() ) or
+        ( adds[ 0 ] == a2.get() and adds[ 1 ] == a1.get() ) );
+}
+
+TEST( libcjel_ir__module, index_outlived_by_objects )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::ARENA | Module::INDEX );
+
+    auto c = module->make< BitConstant >( 8, 1 );
+
+    module = nullptr;
+    c = nullptr;
+}
+
+TEST( libcjel_ir__module, index_concurrent_builders )
+{
+    auto module = libstdhl::Memory::make< Module >( "m", Module::INDEX );
+
+    std::vector< std::thread > builders;
+    for( u32 t = 0; t < 4; t++ )
+    {
+        builders.emplace_back( [&module]() {
+            std::vector< Instruction::Ptr > objects;
+            auto c = module->make< BitConstant >( 8, 1 );
+            for( u32 i = 0; i < 1000; i++ )
+            {
+                objects.emplace_back( module->make< AndInstruction >( c, c ) );
+            }
+            objects.resize( 500 );
+        } );
+    }
+
+    for( auto& builder : builders )
+    {
+        builder.join();
+    }
+
+    EXPECT_EQ( module->index< AndInstruction >().size(), 0 );
+    EXPECT_EQ( module->index< BitConstant >().size(), 0 );
+}
+
+TEST( libcjel_ir__module, index_released_with_module_on_other_thread )
+{
+    for( u32 r = 0; r < 20; r++ )
+    {
+        auto module = libstdhl::Memory::make< Module >( "m", Module::INDEX );
+
+        auto c = module->make< BitConstant >( 8, 1 );
+        std::vector< Instruction::Ptr > objects;
+        for( u32 i = 0; i < 1000; i++ )
+        {
+            objects.emplace_back( module->make< AndInstruction >( c, c ) );
+        }
+
+        std::thread releaser( [&objects]() { objects.clear(); } );
+        module = nullptr;
+        releaser.join();
+    }
+}
+
+TEST( libcjel_ir__module, accessors_return_references )
+{
+    const auto module = parse( R"***(
+struct Int { u32 value, u1 isdef }
+
+function f( Int a ) -> ( u32 r )
+{|
+    [ v = load a.value ; store v, r ]
+|}
+)***" );
+
+    const auto& functions = module->get< Function >();
+    EXPECT_EQ( &functions, &module->get< Function >() );
+
+    const auto& function = static_cast< const Function& >( **functions.begin() );
+    const auto& context = *function.context();
+    EXPECT_EQ( &context.blocks(), &function.context()->blocks() );
+
+    const auto& statement = static_cast< const Statement& >( **context.blocks().begin() );
+    EXPECT_EQ( &statement.instructions(), &statement.instructions() );
+    EXPECT_EQ( &statement.scopes(), &statement.scopes() );
+
+    const auto& structure = static_cast< const Structure& >( **module->get< Structure >().begin() );
+    EXPECT_EQ( &structure.elements(), &structure.elements() );
+    EXPECT_EQ( &structure.element( 1 ), &structure.element( "isdef" ) );
+    EXPECT_EQ( &function.type().ptr_results(), &function.type().results() );
+
+    // the traversal does not take references to the values
+    const auto uses = functions.begin()->use_count();
+    module->iterate( Traversal::PREORDER, [&]( Value& ) {
+        EXPECT_EQ( functions.begin()->use_count(), uses );
+    } );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
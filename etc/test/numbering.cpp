@@ -0,0 +1,201 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static u64 count( Module& module )
+{
+    u64 result = 0;
+    module.iterate(
+        Traversal::PREORDER, [&result]( Value& value ) { result += isa< Instruction >( value ); } );
+    return result;
+}
+
+/**
+   runs 'name' of 'module' for every input, a fresh interpreter decodes the
+   current instructions and starts with the initial globals
+*/
+
+static std::vector< u64 > run(
+    const Module::Ptr& module, const std::string& name, u16 bitsize, std::vector< u64 > inputs )
+{
+    Interpreter interpreter;
+    const auto& function = lookup( module, name );
+
+    std::vector< u64 > result;
+    for( const auto input : inputs )
+    {
+        for( const auto& output :
+            interpreter.run( function, { BitConstant( BitType::get( bitsize ), input ) } ) )
+        {
+            result.emplace_back( output.value().value() );
+        }
+    }
+    return result;
+}
+
+TEST( libcjel_ir__numbering, redundant_operators_across_statements )
+{
+    const auto module = parse( R"***(
+function f( u8 x, u8 y ) -> ( u8 r, u8 s )
+{|
+    [ u = load x ; v = load y ; a = addu u, v ; b = addu v, u ; c = xor a, b ; store c, r ]
+    [ d = addu u, v ; e = xor d, 3 : u8 ; f = xor e, 3 : u8 ; g = xor a, 3 : u8
+    ; h = divs e, g ; store h, s
+    ]
+|}
+)***" );
+
+    Interpreter interpreter;
+    const auto& function = lookup( module, "f" );
+    const auto u8 = []( u64 value ) { return BitConstant( BitType::get( 8 ), value ); };
+    const auto expected = interpreter.run( function, { u8( 7 ), u8( 200 ) } );
+
+    // 'b' is 'a' commuted, 'd' is 'a' and then 'g' is 'e'
+    const auto before = count( *module );
+    EXPECT_EQ( CjelIRValueNumberingPass::eliminate( *module ), 3 );
+    EXPECT_EQ( count( *module ), before - 3 );
+    EXPECT_EQ( CjelIRValueNumberingPass::eliminate( *module ), 0 );
+
+    const auto actual = Interpreter().run( function, { u8( 7 ), u8( 200 ) } );
+    ASSERT_EQ( actual.size(), 2 );
+    EXPECT_EQ( actual[ 0 ].value().value(), expected[ 0 ].value().value() );
+    EXPECT_EQ( actual[ 1 ].value().value(), expected[ 1 ].value().value() );
+    EXPECT_EQ( actual[ 0 ].value().value(), 0 );
+    EXPECT_EQ( actual[ 1 ].value().value(), 1 );
+}
+
+TEST( libcjel_ir__numbering, stores_separate_loads )
+{
+    const auto module = parse( R"***(
+variable counter : u32 = 5
+
+function g( u32 x ) -> ( u32 r )
+{|
+    [ a = load counter ; b = load counter ; c = addu a, b ; store c, counter ]
+    [ d = load counter ; e = addu d, x ; store e, r ]
+    [ i = alloc -> u32 ; j = alloc -> u32 ; store 0 : u32, i ; k = load i ]
+    loop [ l = load i ; m = neq l, x ]
+    {|
+        [ n = load i ; o = addu n, 1 : u32 ; store o, i ; p = load r ; q = addu p, o ; store q, r ]
+    |}
+|}
+)***" );
+
+    const auto expected = run( module, "g", 32, { 0, 1, 4 } );
+
+    // 'b' is 'a' and 'n' is the 'l' of the same iteration, 'd' follows a
+    // store, 'j' is a separate allocation and 'l' follows the loop body
+    EXPECT_EQ( CjelIRValueNumberingPass::eliminate( *module ), 2 );
+    EXPECT_EQ( run( module, "g", 32, { 0, 1, 4 } ), expected );
+}
+
+TEST( libcjel_ir__numbering, stores_separate_implicit_reads )
+{
+    const auto module = parse( R"***(
+function g( u8 x ) -> ( u8 r, u8 s )
+{|
+    [ store x, r ]
+    [ a = addu r, 1 : u8 ; store a, r ]
+    [ b = addu r, 1 : u8 ; store b, s ]
+    [ c = addu r, 1 : u8 ; d = addu r, 1 : u8 ; e = xor c, d ; store e, r ]
+|}
+)***" );
+
+    const auto expected = run( module, "g", 8, { 0, 7, 255 } );
+
+    // 'r' is read without a 'load', 'b' follows the store of 'a' and only
+    // 'd' is redundant
+    EXPECT_EQ( CjelIRValueNumberingPass::eliminate( *module ), 1 );
+    EXPECT_EQ( run( module, "g", 8, { 0, 7, 255 } ), expected );
+    EXPECT_EQ( expected, ( std::vector< u64 >{ 0, 2, 0, 9, 0, 1 } ) );
+}
+
+TEST( libcjel_ir__numbering, scopes_limit_availability )
+{
+    const auto module = parse( R"***(
+function h( u8 x ) -> ( u8 r, u8 s )
+{|
+    [ v = load x ]
+    {
+        [ a = addu v, 1 : u8 ; store a, r ]
+        [ b = addu v, 1 : u8 ; store b, s ]
+    }
+    [ c = addu v, 1 : u8 ; store c, r ]
+    branch [ d = addu v, 2 : u8 ; e = equ d, 5 : u8 ]
+    {| [ f = addu v, 2 : u8 ; g = addu v, 3 : u8 ; store g, s ] |}
+    [ h = addu v, 3 : u8 ; i = equ d, 5 : u8 ; j = zext i -> u8 ; k = addu h, j ; store k, r ]
+    branch [ l = addu v, 2 : u8 ; m = equ l, 5 : u8 ]
+    {| [ store x, s ] |}
+|}
+)***" );
+
+    const auto expected = run( module, "h", 8, { 0, 3, 255 } );
+
+    // parallel siblings, the parallel scope and the branch scope do not
+    // share 'a', 'b' and 'g', the header values 'd' and 'e' reach 'f', 'i'
+    // and 'l', the condition 'm' is kept
+    EXPECT_EQ( CjelIRValueNumberingPass::eliminate( *module ), 3 );
+    EXPECT_EQ( run( module, "h", 8, { 0, 3, 255 } ), expected );
+
+    std::vector< std::string > conditions;
+    module->iterate( Traversal::PREORDER, [&conditions]( Value& value ) {
+        if( isa< BranchStatement >( value ) )
+        {
+            const auto& instructions = static_cast< BranchStatement& >( value ).instructions();
+            conditions.emplace_back( instructions[ instructions.size() - 1 ]->name() );
+            EXPECT_EQ( instructions.size(), conditions.size() == 1 ? 2 : 1 );
+        }
+    } );
+    EXPECT_EQ( conditions, ( std::vector< std::string >{ "equ", "equ" } ) );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
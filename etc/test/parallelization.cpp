@@ -0,0 +1,252 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+/**
+   numbers the statements of the top-level scope of 'function' in their
+   original order
+*/
+
+static std::unordered_map< const Block*, u32 > number( const Function& function )
+{
+    std::unordered_map< const Block*, u32 > result;
+    for( const auto& block : function.context()->blocks() )
+    {
+        result.emplace( block.get(), result.size() );
+    }
+    return result;
+}
+
+/**
+   the scopes of the top-level scope of 'function' as '{| ... |}' and
+   '{ ... }' with the original statement numbers
+*/
+
+static std::string shape(
+    const Block& block, const std::unordered_map< const Block*, u32 >& numbers )
+{
+    if( not isa< Scope >( block ) )
+    {
+        const auto result = numbers.find( &block );
+        return result != numbers.end() ? std::to_string( result->second ) : "?";
+    }
+
+    const u1 parallel = isa< ParallelScope >( block );
+    std::string result = parallel ? "{" : "{|";
+    for( const auto& child : static_cast< const Scope& >( block ).blocks() )
+    {
+        result += " " + shape( *child, numbers );
+    }
+    return result + ( parallel ? " }" : " |}" );
+}
+
+static std::vector< u64 > run( const Function& function, const std::vector< BitConstant >& inputs )
+{
+    Interpreter interpreter;
+    std::vector< u64 > result;
+    for( const auto& output : interpreter.run( function, inputs ) )
+    {
+        result.emplace_back( output.value().value() );
+    }
+    return result;
+}
+
+TEST( libcjel_ir__parallelization, casmrt_add )
+{
+    const auto module = parse( R"***(
+struct Int { u32 value, u1 isdef }
+
+function casmrt.add( Int ra, Int rb ) -> ( Int rt )
+{|
+    [ va = load ra.value
+    ; vb = load rb.value
+    ; vt = adds va, vb
+    ; store vt, rt.value
+    ]
+    [ ua = load ra.isdef
+    ; ub = load rb.isdef
+    ; ut = and ua, ub
+    ; store ut, rt.isdef
+    ]
+|}
+)***" );
+
+    const auto& function = lookup( module, "casmrt.add" );
+    const auto numbers = number( function );
+    const std::vector< BitConstant > inputs = { BitConstant( 32, 40 ), BitConstant( 1, 1 ),
+        BitConstant( 32, 2 ), BitConstant( 1, 1 ) };
+    const auto expected = run( function, inputs );
+
+    // the two statements access different elements of 'rt'
+    EXPECT_EQ( CjelIRParallelizationPass::parallelize( *module ), 1 );
+    EXPECT_EQ( shape( *function.context(), numbers ), "{| { 0 1 } |}" );
+    EXPECT_EQ( run( function, inputs ), expected );
+    EXPECT_EQ( expected, ( std::vector< u64 >{ 42, 1 } ) );
+
+    EXPECT_EQ( CjelIRParallelizationPass::parallelize( *module ), 0 );
+
+    EXPECT_EQ( reverse( *module ), 1 );
+    EXPECT_EQ( run( function, inputs ), expected );
+}
+
+TEST( libcjel_ir__parallelization, dependences_order_levels )
+{
+    const auto module = parse( R"***(
+variable a : u32 = 1
+variable b : u32 = 2
+memory heap : u32 -> 4
+
+function inc( u32 x ) -> ( u32 r )
+{|
+    [ c = load a ; d = addu c, x ; store d, a ; store d, r ]
+|}
+
+function f( u32 x ) -> ( u32 r, u32 s )
+{|
+    [ p = load a ; store p, r ]
+    [ q = load b ; store q, s ]
+    [ t = addu x, 1 : u32 ; store t, a ]
+    [ u = load r ; v = addu u, t ; store v, b ]
+    [ w = load s ; store w, r ]
+|}
+
+function g( u32 x ) -> ( u32 r, u32 s, u32 t )
+{|
+    [ p = load b ; store p, r ]
+    [ k = divs 9 : u32, 3 : u32 ; h = extract heap, 1 : u32 ; store k, h ]
+    [ q = call inc, x ; store q, s ]
+    [ e = divs 7 : u32, x ; store e, t ]
+    [ l = extract heap, 2 : u32 ; m = load l ; store m, t ]
+    [ i = extract heap, x ; j = load i ]
+|}
+)***" );
+
+    const auto& f = lookup( module, "f" );
+    const auto& g = lookup( module, "g" );
+    const auto f_numbers = number( f );
+    const auto g_numbers = number( g );
+
+    const auto results = [&f, &g]( void ) {
+        std::vector< std::vector< u64 > > result;
+        for( const u64 x : { 1, 3 } )
+        {
+            result.emplace_back( run( f, { BitConstant( 32, x ) } ) );
+            result.emplace_back( run( g, { BitConstant( 32, x ) } ) );
+        }
+        return result;
+    };
+
+    const auto expected = results();
+
+    EXPECT_EQ( CjelIRParallelizationPass::parallelize( *module ), 3 );
+
+    // 2 writes 'a' after 0 reads it, 3 uses 't' of 2, 4 writes 'r' after 3
+    // reads it
+    EXPECT_EQ( shape( *f.context(), f_numbers ), "{| { 0 1 } 2 3 4 |}" );
+
+    // the call follows the load of 'b' and the store to 'heap', the fault
+    // of 3 follows the call, 4 writes 't' after 3, 5 reads all elements of
+    // 'heap' and its fault follows 3
+    EXPECT_EQ( shape( *g.context(), g_numbers ), "{| { 0 1 } 2 3 { 4 5 } |}" );
+
+    EXPECT_EQ( results(), expected );
+
+    EXPECT_EQ( reverse( *module ), 3 );
+    EXPECT_EQ( results(), expected );
+}
+
+TEST( libcjel_ir__parallelization, implicit_reads_order_stores )
+{
+    const auto module = parse( R"***(
+function h( u8 x ) -> ( u8 r, u8 s, u8 t )
+{|
+    [ a = addu x, 1 : u8 ; store a, r ]
+    [ store r, s ]
+    [ b = addu x, 2 : u8 ; store b, t ]
+    [ c = addu s, t ; store c, r ]
+|}
+)***" );
+
+    const auto& h = lookup( module, "h" );
+    const auto numbers = number( h );
+    const auto expected = run( h, { BitConstant( 8, 5 ) } );
+
+    // 1 reads 'r' without a 'load' after 0 writes it, 3 reads 's' and 't'
+    // and writes 'r' after 1 reads it
+    EXPECT_EQ( CjelIRParallelizationPass::parallelize( *module ), 1 );
+    EXPECT_EQ( shape( *h.context(), numbers ), "{| { 0 2 } 1 3 |}" );
+    EXPECT_EQ( run( h, { BitConstant( 8, 5 ) } ), expected );
+    EXPECT_EQ( expected, ( std::vector< u64 >{ 13, 6, 7 } ) );
+
+    EXPECT_EQ( reverse( *module ), 1 );
+    EXPECT_EQ( run( h, { BitConstant( 8, 5 ) } ), expected );
+}
+
+TEST( libcjel_ir__parallelization, generated_module_behaves_equally )
+{
+    Generator::Options options;
+    options.instructions = 20000;
+    options.functions = 20;
+    options.seed = 13;
+
+    const auto module = Generator( options ).generate();
+
+    // the blocks of the generated parallel scopes are independent as well,
+    // every parallel scope is reversed at once
+    const auto expected = execute( *module );
+    EXPECT_GT( CjelIRParallelizationPass::parallelize( *module ), 0 );
+    EXPECT_EQ( execute( *module ), expected );
+    EXPECT_GT( reverse( *module ), 0 );
+    EXPECT_EQ( execute( *module ), expected );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,217 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <regex>
+#include <sstream>
+
+using namespace libcjel_ir_test;
+
+static const std::string SOURCE = R"***(
+// integer with validity flag
+struct Int { u32 value, u1 isdef }
+
+variable counter : u32 = 0x10
+memory heap : u8 -> 256
+
+function add( Int a, Int b ) -> ( Int r )
+{|
+    [ x = load a.value
+    ; y = load b.value
+    ; z = addu x, y
+    ; store z, r.value
+    ]
+    {
+        [ c = load counter ; d = addu c, 1 : u32 ; store d, counter ]
+        branch [ equ x, 0 : u32 ]
+        {| [ nop ] |}
+        {| [ e = zext x -> u64 ] |}
+    }
+    loop [ f = neq x, y ] {| [ g = call add, a, b ] |}
+|}
+)***";
+
+static std::string dump( const Module::Ptr& module )
+{
+    CjelIRDumpPass pass;
+
+    testing::internal::CaptureStdout();
+    module->iterate( Traversal::PREORDER, &pass );
+    const auto output = testing::internal::GetCapturedStdout();
+
+    return std::regex_replace( output, std::regex( "0x[0-9a-f]+|\\(nil\\)" ), "_" );
+}
+
+TEST( libcjel_ir__parser, module_contents )
+{
+    const auto module = parse( SOURCE + "intrinsic intr.add( Int a, Int b ) -> ( Int r )\n" );
+
+    EXPECT_EQ( module->get< Structure >().size(), 1 );
+    EXPECT_EQ( module->get< Variable >().size(), 1 );
+    EXPECT_EQ( module->get< Memory >().size(), 1 );
+    EXPECT_EQ( module->get< Intrinsic >().size(), 1 );
+    ASSERT_EQ( module->get< Function >().size(), 1 );
+
+    const auto function = std::static_pointer_cast< Function >( module->get< Function >()[ 0 ] );
+    EXPECT_EQ( function->name(), "add" );
+    EXPECT_EQ( function->inputs().size(), 2 );
+    EXPECT_EQ( function->outputs().size(), 1 );
+
+    const auto context = function->context();
+    ASSERT_TRUE( isa< SequentialScope >( context ) );
+    ASSERT_EQ( context->blocks().size(), 3 );
+    EXPECT_TRUE( isa< TrivialStatement >( context->blocks()[ 0 ] ) );
+    EXPECT_TRUE( isa< ParallelScope >( context->blocks()[ 1 ] ) );
+    EXPECT_TRUE( isa< LoopStatement >( context->blocks()[ 2 ] ) );
+
+    // 'a.value', 'b.value' and 'r.value' emit an extract each
+    const auto stmt = std::static_pointer_cast< Statement >( context->blocks()[ 0 ] );
+    ASSERT_EQ( stmt->instructions().size(), 7 );
+    EXPECT_TRUE( isa< ExtractInstruction >( stmt->instructions()[ 0 ] ) );
+    EXPECT_TRUE( isa< LoadInstruction >( stmt->instructions()[ 1 ] ) );
+    EXPECT_TRUE( isa< AddUnsignedInstruction >( stmt->instructions()[ 4 ] ) );
+    EXPECT_TRUE( isa< StoreInstruction >( stmt->instructions()[ 6 ] ) );
+
+    // operands refer to the defining instructions
+    EXPECT_EQ( stmt->instructions()[ 4 ]->operand( 0 ), stmt->instructions()[ 1 ] );
+    EXPECT_EQ( stmt->instructions()[ 4 ]->operand( 1 ), stmt->instructions()[ 3 ] );
+}
+
+TEST( libcjel_ir__parser, qualified_names_match_longest )
+{
+    const auto module = parse( R"***(
+struct Int { u32 value, u1 isdef }
+
+function casmrt.inc( u32 x ) -> ( u32 r )
+{| [ y = addu x, 1 : u32 ; store y, r ] |}
+
+function casmrt.inc.twice( u32 x ) -> ( u32 r )
+{| [ y = call casmrt.inc, x ; z = call casmrt.inc, y ; store z, r ] |}
+
+function f( Int casmrt ) -> ( u32 r )
+{| [ a = call casmrt.inc.twice, 1 : u32 ; v = load casmrt.value ; b = addu a, v ; store b, r ] |}
+)***" );
+
+    const auto& twice = lookup( module, "casmrt.inc.twice" );
+    const auto& f = lookup( module, "f" );
+
+    const auto& calls = static_cast< const Statement& >( **twice.context()->blocks().begin() );
+    EXPECT_EQ( calls.instructions()[ 0 ]->operand( 0 ).get(), &lookup( module, "casmrt.inc" ) );
+
+    const auto& statement = static_cast< const Statement& >( **f.context()->blocks().begin() );
+    const auto& instructions = statement.instructions();
+    ASSERT_EQ( instructions.size(), 5 );
+    EXPECT_EQ( instructions[ 0 ]->operand( 0 ).get(), &twice );
+    EXPECT_TRUE( isa< ExtractInstruction >( instructions[ 1 ] ) );
+
+    Interpreter interpreter;
+    EXPECT_EQ( interpreter.run( f, { BitConstant( 32, 40 ), BitConstant( 1, 1 ) } )[ 0 ]
+                   .value()
+                   .value(),
+        43 );
+
+    try
+    {
+        parse( "function casmrt.inc( u32 x ) -> ( u32 r )\n"
+               "{| [ y = call casmrt.inc.once, x ; store y, r ] |}" );
+        ADD_FAILURE() << "no error for 'casmrt.inc.once'";
+    }
+    catch( const std::domain_error& e )
+    {
+        EXPECT_EQ( std::string( e.what() ), "line 2: unknown symbol 'casmrt.inc.once'" );
+    }
+}
+
+TEST( libcjel_ir__parser, stream_chunks_match_string )
+{
+    const auto expected = dump( parse( SOURCE, "parser" ) );
+
+    for( std::size_t chunksize : { 1, 2, 3, 7, 64, 4096 } )
+    {
+        auto module = libstdhl::Memory::make< Module >( "parser" );
+        Parser parser( module, chunksize );
+
+        std::istringstream input( SOURCE );
+        parser.parse( input );
+
+        EXPECT_EQ( dump( module ), expected ) << "chunk size " << chunksize;
+    }
+}
+
+TEST( libcjel_ir__parser, error_reports_line )
+{
+    const std::vector< std::pair< std::string, std::string > > cases = {
+        { "struct S { u8 a }\nstruct S { u8 b }", "line 2: type 'S' is already defined" },
+        { "variable v : u8 = 1\n\nvariable w : Foo = 1", "line 3: unknown type 'Foo'" },
+        { "function f() -> ( u8 r )\n{|\n[ frob r ]\n|}", "line 3: unknown instruction 'frob'" },
+        { "function f() -> ( u8 r )\n{| [ load x ] |}", "line 2: unknown symbol 'x'" },
+        { "function f() -> ( u8 r )\n{| [ store 1 : u16, r ] |}",
+            "line 2: operand types 'u16' and 'u8' of instruction 'store' do not match" },
+        { "memory m : u8 -> 99999999999999999999", "line 1: number '99999999999999999999' "
+                                                   "exceeds 64 bits" },
+        { "function f() -> ( u8 r )\n{| [ nop ]", "line 2: unterminated scope" },
+        { "variable v : u8 = 1 $", "line 1: unexpected character '$'" },
+    };
+
+    for( const auto& c : cases )
+    {
+        try
+        {
+            parse( c.first );
+            ADD_FAILURE() << "no error for: " << c.first;
+        }
+        catch( const std::domain_error& e )
+        {
+            EXPECT_EQ( std::string( e.what() ), c.second );
+        }
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,361 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+using namespace libcjel_ir;
+
+TEST( libcjel_ir__thread_pool, parallel_runs_all_indices )
+{
+    ThreadPool pool( 4 );
+    EXPECT_EQ( pool.workers(), 4 );
+
+    std::vector< std::atomic< u32 > > counts( 1000 );
+    for( auto& count : counts )
+    {
+        count = 0;
+    }
+
+    pool.parallel( counts.size(), [&counts]( u32 index ) { counts[ index ]++; } );
+
+    for( const auto& count : counts )
+    {
+        EXPECT_EQ( count, 1 );
+    }
+}
+
+TEST( libcjel_ir__thread_pool, jobs_are_stolen )
+{
+    ThreadPool pool( 1 );
+
+    // index 0 runs on the calling thread and waits for index 1
+    std::atomic< u1 > done( false );
+    pool.parallel( 2, [&done]( u32 index ) {
+        if( index == 1 )
+        {
+            done = true;
+            return;
+        }
+
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds( 10 );
+        while( not done and std::chrono::steady_clock::now() < timeout )
+        {
+            std::this_thread::yield();
+        }
+    } );
+
+    EXPECT_TRUE( done );
+}
+
+TEST( libcjel_ir__thread_pool, nested_parallel )
+{
+    ThreadPool pool( 3 );
+
+    std::atomic< u32 > count( 0 );
+    pool.parallel( 8, [&pool, &count]( u32 ) {
+        pool.parallel( 8, [&count]( u32 ) { count++; } );
+    } );
+
+    EXPECT_EQ( count, 64 );
+}
+
+TEST( libcjel_ir__thread_pool, shared_pool_is_reused )
+{
+    auto& pool = ThreadPool::shared();
+    EXPECT_EQ( &ThreadPool::shared(), &pool );
+    EXPECT_EQ( pool.workers(), ThreadPool::defaultWorkers() );
+
+    std::atomic< u32 > count( 0 );
+    pool.parallel( 8, [&count]( u32 ) { count++; } );
+    EXPECT_EQ( count, 8 );
+}
+
+TEST( libcjel_ir__thread_pool, lowest_exception_is_rethrown )
+{
+    for( u32 workers : { 0, 4 } )
+    {
+        ThreadPool pool( workers );
+
+        try
+        {
+            pool.parallel( 16, []( u32 index ) {
+                if( index == 3 or index == 11 )
+                {
+                    throw std::domain_error( std::to_string( index ) );
+                }
+            } );
+            ADD_FAILURE();
+        }
+        catch( const std::domain_error& e )
+        {
+            EXPECT_STREQ( e.what(), "3" );
+        }
+    }
+}
+
+static Statement::Ptr statement( u32 instructions )
+{
+    auto result = libstdhl::Memory::make< TrivialStatement >();
+    for( u32 c = 0; c < instructions; c++ )
+    {
+        result->add( libstdhl::Memory::make< NopInstruction >() );
+    }
+    return result;
+}
+
+TEST( libcjel_ir__scheduler, sequential_order_is_kept )
+{
+    // seq { par { 8 x seq { 4 x stmt } }, stmt, par { 8 x stmt } }
+    auto root = libstdhl::Memory::make< SequentialScope >();
+    std::vector< std::vector< Statement::Ptr > > sequences;
+
+    auto first = libstdhl::Memory::make< ParallelScope >();
+    root->add( first );
+    for( u32 c = 0; c < 8; c++ )
+    {
+        auto sequence = libstdhl::Memory::make< SequentialScope >();
+        first->add( sequence );
+
+        sequences.emplace_back();
+        for( u32 i = 0; i < 4; i++ )
+        {
+            sequences.back().emplace_back( statement( 8 ) );
+            sequence->add( sequences.back().back() );
+        }
+    }
+
+    auto middle = statement( 1 );
+    root->add( middle );
+
+    auto last = libstdhl::Memory::make< ParallelScope >();
+    root->add( last );
+    std::vector< Statement::Ptr > tail;
+    for( u32 c = 0; c < 8; c++ )
+    {
+        tail.emplace_back( statement( 16 ) );
+        last->add( tail.back() );
+    }
+
+    ThreadPool pool( 4 );
+
+    for( u64 grainsize : { (u64)0, (u64)16, Scheduler::GrainSize, (u64)1 << 20 } )
+    {
+        Scheduler scheduler( pool, grainsize );
+
+        std::atomic< u32 > clock( 0 );
+        std::unordered_map< const Statement*, u32 > ticks;
+        std::mutex lock;
+
+        scheduler.run( *root, [&]( const Statement& statement ) {
+            const auto tick = clock++;
+            std::lock_guard< std::mutex > guard( lock );
+            EXPECT_TRUE( ticks.emplace( &statement, tick ).second );
+        } );
+
+        EXPECT_EQ( ticks.size(), 8 * 4 + 1 + 8 );
+
+        for( const auto& sequence : sequences )
+        {
+            for( u32 i = 1; i < sequence.size(); i++ )
+            {
+                EXPECT_LT( ticks[ sequence[ i - 1 ].get() ], ticks[ sequence[ i ].get() ] );
+            }
+            EXPECT_LT( ticks[ sequence.back().get() ], ticks[ middle.get() ] );
+        }
+
+        for( const auto& statement : tail )
+        {
+            EXPECT_GT( ticks[ statement.get() ], ticks[ middle.get() ] );
+        }
+    }
+}
+
+TEST( libcjel_ir__scheduler, small_scopes_run_inline )
+{
+    auto root = libstdhl::Memory::make< ParallelScope >();
+    for( u32 c = 0; c < 16; c++ )
+    {
+        root->add( statement( 2 ) );
+    }
+
+    ThreadPool pool( 4 );
+    Scheduler scheduler( pool, 32 );
+
+    const auto caller = std::this_thread::get_id();
+    std::atomic< u32 > foreign( 0 );
+
+    scheduler.run( *root, [&]( const Statement& ) {
+        if( std::this_thread::get_id() != caller )
+        {
+            foreign++;
+        }
+    } );
+
+    EXPECT_EQ( foreign, 0 );
+    EXPECT_TRUE( root->isParallel() );
+}
+
+static const std::string MODULE = R"***(
+struct Int { u32 value, u1 isdef }
+
+variable counter : u32 = 5
+memory heap : u32 -> 4
+
+function a( u8 x ) -> ( u8 r )
+{|
+    [ y = addu x, 1 : u8 ; store y, r ]
+|}
+
+function b( u8 x ) -> ( u8 r )
+{|
+    branch [ e = equ x, x ]
+    {| [ store 1 : u8, r ] |}
+|}
+
+function c( u8 x ) -> ( u8 r )
+{|
+    [ store x, r ]
+|}
+)***";
+
+class NameContext : public Context
+{
+  public:
+    std::string names;
+    std::thread::id thread;
+};
+
+TEST( libcjel_ir__module_scheduler, global_first_and_ordered_merge )
+{
+    auto module = libstdhl::Memory::make< Module >( "scheduler" );
+    Parser parser( module );
+    parser.parse( MODULE );
+
+    ThreadPool pool( 3 );
+    ModuleScheduler< NameContext > scheduler( pool );
+
+    std::string global;
+    std::atomic< u32 > started( 0 );
+    std::string merged;
+
+    scheduler.run( *module,
+        [&]( Value& value, NameContext& cxt ) {
+            EXPECT_EQ( started, 0 );
+            cxt.names += value.name() + " ";
+            global = cxt.names;
+        },
+        [&]( CallableUnit& callable, NameContext& cxt ) {
+            started++;
+            EXPECT_TRUE( cxt.names.empty() );
+            callable.iterate( Traversal::PREORDER, [&cxt]( Value& value ) {
+                cxt.names += isa< Instruction >( value ) ? "i" : "";
+            } );
+            cxt.names = callable.name() + ":" + cxt.names + " ";
+        },
+        [&]( CallableUnit&, NameContext& cxt ) { merged += cxt.names; } );
+
+    EXPECT_STREQ( global.c_str(), "Int counter heap " );
+    EXPECT_STREQ( merged.c_str(), "a:ii b:ii c:i " );
+}
+
+TEST( libcjel_ir__module_scheduler, first_exception_is_rethrown )
+{
+    auto module = libstdhl::Memory::make< Module >( "scheduler" );
+    Parser parser( module );
+    parser.parse( MODULE );
+
+    ThreadPool pool( 3 );
+    ModuleScheduler<> scheduler( pool );
+
+    u32 merges = 0;
+    try
+    {
+        scheduler.run( *module,
+            []( Value&, Context& ) {},
+            []( CallableUnit& callable, Context& ) {
+                if( callable.name() != "a" )
+                {
+                    throw std::domain_error( callable.name() );
+                }
+            },
+            [&merges]( CallableUnit&, Context& ) { merges++; } );
+        FAIL();
+    }
+    catch( const std::domain_error& e )
+    {
+        EXPECT_STREQ( e.what(), "b" );
+    }
+
+    EXPECT_EQ( merges, 0 );
+}
+
+TEST( libcjel_ir__module_scheduler, parallel_dump_is_deterministic )
+{
+    auto module = libstdhl::Memory::make< Module >( "scheduler" );
+    Parser parser( module );
+    parser.parse( MODULE );
+
+    CjelIRDumpPass pass;
+    ThreadPool sequential( 0 );
+    ThreadPool concurrent( 3 );
+
+    const auto dump = pass.dump( *module, sequential );
+    EXPECT_EQ( pass.dump( *module, concurrent ), dump );
+
+    u32 nodes = 0;
+    module->iterate( Traversal::PREORDER, [&nodes]( Value& ) { nodes++; } );
+    EXPECT_EQ( std::count( dump.begin(), dump.end(), '\n' ), nodes );
+    EXPECT_EQ( dump.find( "visit_prolog" ), 0 );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,122 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static const std::string SOURCE = R"***(
+function f( u8 x ) -> ( u8 r )
+{|
+    branch [ e = equ x, x ]
+    {| [ store 1 : u8, r ] [ store 1 : u8, r ] |}
+|}
+)***";
+
+TEST( libcjel_ir__statistics, live_counts_follow_lifetime )
+{
+    const auto before = Statistics::live()[ Value::NOT_INSTRUCTION ];
+
+    {
+        auto x = libstdhl::Memory::make< BitConstant >( 8, 1 );
+        auto a = libstdhl::Memory::make< NotInstruction >( x );
+        auto b = libstdhl::Memory::make< NotInstruction >( x );
+
+        const auto during = Statistics::live()[ Value::NOT_INSTRUCTION ];
+        EXPECT_EQ( during.count, before.count + 2 );
+        EXPECT_GE( during.peak, before.count + 2 );
+        EXPECT_EQ( during.bytes, during.count * sizeof( NotInstruction ) );
+    }
+
+    const auto after = Statistics::live()[ Value::NOT_INSTRUCTION ];
+    EXPECT_EQ( after.count, before.count );
+    EXPECT_GE( after.peak, before.count + 2 );
+}
+
+TEST( libcjel_ir__statistics, collect_module )
+{
+    const auto module = parse( SOURCE );
+    const auto entries = Statistics::collect( *module );
+
+    EXPECT_EQ( entries[ Value::MODULE ].count, 1 );
+    EXPECT_EQ( entries[ Value::FUNCTION ].count, 1 );
+    EXPECT_EQ( entries[ Value::REFERENCE ].count, 2 );
+    EXPECT_EQ( entries[ Value::SEQUENTIAL_SCOPE ].count, 2 );
+    EXPECT_EQ( entries[ Value::BRANCH_STATEMENT ].count, 1 );
+    EXPECT_EQ( entries[ Value::TRIVIAL_STATEMENT ].count, 2 );
+    EXPECT_EQ( entries[ Value::EQU_INSTRUCTION ].count, 1 );
+    EXPECT_EQ( entries[ Value::STORE_INSTRUCTION ].count, 2 );
+
+    // the shared constant is counted once
+    EXPECT_EQ( entries[ Value::BIT_CONSTANT ].count, 1 );
+
+    const auto& store = entries[ Value::STORE_INSTRUCTION ];
+    EXPECT_EQ( store.peak, store.count );
+    EXPECT_GE( store.bytes, store.count * sizeof( StoreInstruction ) );
+}
+
+TEST( libcjel_ir__statistics, caches_and_report )
+{
+    const auto module = parse( SOURCE );
+
+    const auto caches = Statistics::caches();
+    ASSERT_EQ( caches.size(), 3 );
+    EXPECT_GT( caches[ 0 ].entries, 0 );
+    EXPECT_GT( caches[ 0 ].bytes, 0 );
+
+    const auto report = Statistics::report( module.get() );
+    EXPECT_NE( report.find( "StoreInstruction" ), std::string::npos );
+    EXPECT_NE( report.find( "live" ), std::string::npos );
+    EXPECT_NE( report.find( "Type::s_cache" ), std::string::npos );
+
+    EXPECT_EQ( Statistics::name( Value::ADDU_INSTRUCTION ), "AddUnsignedInstruction" );
+    EXPECT_EQ( Statistics::size( Value::ADDU_INSTRUCTION ), sizeof( AddUnsignedInstruction ) );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
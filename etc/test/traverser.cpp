@@ -0,0 +1,159 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static char kind( const Value& value )
+{
+    if( isa< Module >( value ) )
+    {
+        return 'M';
+    }
+    if( isa< Function >( value ) )
+    {
+        return 'F';
+    }
+    if( isa< Reference >( value ) )
+    {
+        return 'R';
+    }
+    if( isa< Scope >( value ) )
+    {
+        return 'S';
+    }
+    if( isa< Statement >( value ) )
+    {
+        return 'T';
+    }
+    if( isa< Instruction >( value ) )
+    {
+        return 'I';
+    }
+    return '?';
+}
+
+static const std::string SOURCE = R"***(
+function f( u8 a ) -> ( u8 r )
+{|
+    branch [ e = equ a, a ]
+    {| [ store 1 : u8, r ] |}
+|}
+)***";
+
+TEST( libcjel_ir__traverser, order )
+{
+    const auto module = parse( SOURCE );
+
+    std::string preorder;
+    Traverser::iterate(
+        *module, Traversal::PREORDER, [&preorder]( Value& value ) { preorder += kind( value ); } );
+    EXPECT_STREQ( preorder.c_str(), "MFRRSTISTI" );
+
+    std::string postorder;
+    module->iterate(
+        Traversal::POSTORDER, [&postorder]( Value& value ) { postorder += kind( value ); } );
+    EXPECT_STREQ( postorder.c_str(), "RRIITSTSFM" );
+}
+
+TEST( libcjel_ir__traverser, deep_nesting )
+{
+    const u32 depth = 100000;
+
+    auto module = libstdhl::Memory::make< Module >( "deep" );
+    std::vector< Scope::Ptr > scopes;
+    scopes.emplace_back( module->make< SequentialScope >() );
+
+    for( u32 c = 1; c < depth; c++ )
+    {
+        auto scope = module->make< SequentialScope >();
+        scopes.back()->add( scope );
+        scopes.emplace_back( scope );
+    }
+
+    u64 count = 0;
+    Traverser::iterate( *scopes.front(), Traversal::POSTORDER, [&count]( Value& ) { count++; } );
+    EXPECT_EQ( count, depth );
+}
+
+TEST( libcjel_ir__traverser, nested_and_interrupted )
+{
+    const auto module = parse( SOURCE );
+
+    u64 outer = 0;
+    u64 inner = 0;
+    Traverser::iterate( *module, Traversal::PREORDER, [&]( Value& value ) {
+        outer++;
+        if( isa< Statement >( value ) )
+        {
+            Traverser::iterate( value, Traversal::PREORDER, [&inner]( Value& ) { inner++; } );
+        }
+    } );
+    EXPECT_EQ( outer, 10 );
+    EXPECT_EQ( inner, 5 + 2 );
+
+    u64 visited = 0;
+    EXPECT_THROW( Traverser::iterate( *module, Traversal::PREORDER,
+                      [&visited]( Value& value ) {
+                          if( isa< Instruction >( value ) )
+                          {
+                              throw std::domain_error( "interrupted" );
+                          }
+                          visited++;
+                      } ),
+        std::domain_error );
+    EXPECT_EQ( visited, 6 );
+
+    u64 count = 0;
+    Traverser::iterate( *module, Traversal::PREORDER, [&count]( Value& ) { count++; } );
+    EXPECT_EQ( count, 10 );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
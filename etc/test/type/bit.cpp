@@ -77,6 +77,28 @@ TEST( libcjel_ir__type_bit, from_one_to_SizeMax )
     }
 }
 
+TEST( libcjel_ir__type_bit, get_is_pre_seeded_and_interned )
+{
+    EXPECT_THROW( { BitType::get( 0 ); }, std::domain_error );
+    EXPECT_THROW( { BitType::get( BitType::SizeMax + 1 ); }, std::domain_error );
+
+    for( u16 c = 1; c <= BitType::SizeMax; c++ )
+    {
+        const auto& type = BitType::get( c );
+
+        ASSERT_TRUE( type != nullptr );
+        EXPECT_EQ( type->bitsize(), c );
+        EXPECT_EQ( type->uid(), c );
+        EXPECT_TRUE( type == BitType::get( c ) );
+        EXPECT_TRUE( type == libstdhl::Memory::get< BitType >( c ) );
+        EXPECT_TRUE( *type == BitType( c ) );
+    }
+
+    EXPECT_FALSE( *BitType::get( 1 ) == *BitType::get( 2 ) );
+    EXPECT_FALSE( *BitType::get( 1 ) == LabelType() );
+    EXPECT_NE( VoidType().uid(), StringType().uid() );
+}
+
 //
 //  Local variables:
 //  mode: c++
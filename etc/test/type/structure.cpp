@@ -51,6 +51,37 @@ TEST( libcjel_ir__type_structure, example )
             { libstdhl::Memory::make< BitType >( 10 ), "field" } } ) );
 }
 
+TEST( libcjel_ir__type_structure, equal_types_share_uid )
+{
+    auto s0 = libstdhl::Memory::make< Structure >(
+        "s0",
+        std::initializer_list< StructureElement >{ { BitType::get( 10 ), "field" } } );
+
+    auto s1 = libstdhl::Memory::make< Structure >(
+        "s1",
+        std::initializer_list< StructureElement >{ { BitType::get( 10 ), "field" },
+            { BitType::get( 1 ), "flag" } } );
+
+    auto a = libstdhl::Memory::make< StructureType >( s0 );
+    auto b = libstdhl::Memory::make< StructureType >( s0 );
+    auto c = libstdhl::Memory::make< StructureType >( s1 );
+
+    EXPECT_TRUE( a != b );
+    EXPECT_EQ( a->uid(), b->uid() );
+    EXPECT_TRUE( *a == *b );
+    EXPECT_EQ( a->hash(), b->hash() );
+
+    EXPECT_NE( a->uid(), c->uid() );
+    EXPECT_FALSE( *a == *c );
+
+    auto v0 = VectorType( BitType::get( 8 ), 4 );
+    auto v1 = VectorType( BitType::get( 8 ), 4 );
+    auto v2 = VectorType( BitType::get( 8 ), 5 );
+
+    EXPECT_TRUE( v0 == v1 );
+    EXPECT_FALSE( v0 == v2 );
+}
+
 //
 //  Local variables:
 //  mode: c++
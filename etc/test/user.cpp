@@ -0,0 +1,174 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir;
+
+TEST( libcjel_ir__user, constructor_registers_uses )
+{
+    auto a = std::make_shared< BitConstant >( 8, 1 );
+    auto b = std::make_shared< BitConstant >( 8, 2 );
+
+    EXPECT_TRUE( a->uses().empty() );
+
+    {
+        auto i = libstdhl::Memory::make< AddUnsignedInstruction >( a, b );
+
+        ASSERT_TRUE( a->hasOneUse() );
+        ASSERT_TRUE( b->hasOneUse() );
+        EXPECT_EQ( a->users()[ 0 ], i.get() );
+        EXPECT_EQ( a->uses()[ 0 ].operand, 0 );
+        EXPECT_EQ( b->uses()[ 0 ].operand, 1 );
+
+        auto j = libstdhl::Memory::make< AndInstruction >( i, i );
+
+        EXPECT_EQ( i->uses().size(), 2 );
+        EXPECT_FALSE( i->hasOneUse() );
+    }
+
+    EXPECT_TRUE( a->uses().empty() );
+    EXPECT_TRUE( b->uses().empty() );
+}
+
+TEST( libcjel_ir__user, add_and_copy_registers_uses )
+{
+    auto a = std::make_shared< BitConstant >( 8, 1 );
+
+    auto i = libstdhl::Memory::make< Instruction >(
+        "test", BitType::get( 8 ), std::vector< Value::Ptr >{ a } );
+    i->add( a );
+    i->add( a );
+
+    EXPECT_EQ( a->uses().size(), 3 );
+
+    {
+        auto copy = *i;
+        EXPECT_EQ( a->uses().size(), 6 );
+    }
+
+    EXPECT_EQ( a->uses().size(), 3 );
+}
+
+TEST( libcjel_ir__user, operands_are_viewed_in_place )
+{
+    auto a = std::make_shared< BitConstant >( 8, 1 );
+    auto b = std::make_shared< BitConstant >( 8, 2 );
+
+    auto i = libstdhl::Memory::make< AddUnsignedInstruction >( a, b );
+
+    const auto operands = i->operands();
+    ASSERT_EQ( operands.size(), 2 );
+    EXPECT_EQ( &operands[ 0 ], &i->operand( 0 ) );
+    EXPECT_EQ( &i->operand( 1 ), &BinaryInstruction( i.get() ).rhs() );
+
+    // viewing the operands does not take references
+    EXPECT_EQ( a.use_count(), 2 );
+
+    // more operands than the inline capacity move to the heap
+    auto j = libstdhl::Memory::make< Instruction >(
+        "test", BitType::get( 8 ), std::vector< Value::Ptr >{ a, b } );
+    for( u32 c = 0; c < 2 * User::INLINE; c++ )
+    {
+        j->add( j->operand( c ) );
+    }
+
+    ASSERT_EQ( j->arity(), 2 + 2 * User::INLINE );
+    u32 position = 0;
+    for( const auto& operand : j->operands() )
+    {
+        EXPECT_EQ( operand, position % 2 ? b : a );
+        position++;
+    }
+
+    EXPECT_EQ( a->uses().size(), 1 + 1 + User::INLINE );
+    j.reset();
+    EXPECT_EQ( a->uses().size(), 1 );
+}
+
+TEST( libcjel_ir__user, replace_all_uses_with )
+{
+    auto a = std::make_shared< BitConstant >( 8, 1 );
+    auto b = std::make_shared< BitConstant >( 8, 2 );
+    auto c = std::make_shared< BitConstant >( 8, 3 );
+
+    auto i = libstdhl::Memory::make< AddUnsignedInstruction >( a, b );
+    auto j = libstdhl::Memory::make< AddUnsignedInstruction >( a, a );
+
+    a->replaceAllUsesWith( c );
+
+    EXPECT_TRUE( a->uses().empty() );
+    EXPECT_EQ( c->uses().size(), 3 );
+    EXPECT_EQ( i->operand( 0 ), c );
+    EXPECT_EQ( j->operand( 0 ), c );
+    EXPECT_EQ( j->operand( 1 ), c );
+
+    j.reset();
+    ASSERT_TRUE( c->hasOneUse() );
+    EXPECT_EQ( c->users()[ 0 ], i.get() );
+
+    i->setOperand( 1, c );
+    EXPECT_TRUE( b->uses().empty() );
+    EXPECT_EQ( c->uses().size(), 2 );
+}
+
+TEST( libcjel_ir__user, replace_all_uses_with_releases_last_reference )
+{
+    auto c = std::make_shared< BitConstant >( 8, 3 );
+
+    auto i = libstdhl::Memory::make< AddUnsignedInstruction >(
+        std::make_shared< BitConstant >( 8, 1 ), std::make_shared< BitConstant >( 8, 2 ) );
+
+    i->operand( 0 )->replaceAllUsesWith( c );
+
+    EXPECT_EQ( i->operand( 0 ), c );
+    EXPECT_TRUE( c->hasOneUse() );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,170 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "main.h"
+
+using namespace libcjel_ir_test;
+
+static const std::string SOURCE = R"***(
+function f( u8 a ) -> ( u8 r )
+{|
+    branch [ e = equ a, a ]
+    {| [ store 1 : u8, r ] |}
+|}
+)***";
+
+class Tracer final : public StaticVisitor< Tracer >
+{
+  public:
+    void visit_prolog( Value& value, Context& )
+    {
+        trace += kind( value );
+    }
+
+    void visit_interlog( Function&, Context& )
+    {
+        trace += '|';
+    }
+
+    void visit_interlog( BranchStatement&, Context& )
+    {
+        trace += '|';
+    }
+
+    void visit_epilog( Value& value, Context& )
+    {
+        trace += kind( value ) - 'A' + 'a';
+    }
+
+    std::string trace;
+
+  private:
+    static char kind( const Value& value )
+    {
+        if( isa< Module >( value ) )
+        {
+            return 'M';
+        }
+        if( isa< Function >( value ) )
+        {
+            return 'F';
+        }
+        if( isa< Reference >( value ) )
+        {
+            return 'R';
+        }
+        if( isa< Scope >( value ) )
+        {
+            return 'S';
+        }
+        if( isa< Statement >( value ) )
+        {
+            return 'T';
+        }
+        return 'I';
+    }
+};
+
+class Counter final : public StaticVisitor< Counter >
+{
+  public:
+    void visit_prolog( Instruction&, Context& )
+    {
+        instructions++;
+    }
+
+    void visit_epilog( StoreInstruction&, Context& )
+    {
+        stores++;
+    }
+
+    u64 instructions = 0;
+    u64 stores = 0;
+    u64 references = 0;
+
+  private:
+    friend class StaticVisitor< Counter >;
+
+    void visit_prolog( Reference&, Context& )
+    {
+        references++;
+    }
+};
+
+TEST( libcjel_ir__visitor, stages )
+{
+    const auto module = parse( SOURCE );
+    Context context;
+
+    Tracer preorder;
+    preorder.iterate( *module, Traversal::PREORDER, context );
+    EXPECT_STREQ( preorder.trace.c_str(), "MFRrRr|STIi|STIitstsfm" );
+
+    Tracer postorder;
+    Traverser::iterate( *module, Traversal::POSTORDER, &postorder, context, []( Value& ) {} );
+    EXPECT_STREQ( postorder.trace.c_str(), preorder.trace.c_str() );
+}
+
+TEST( libcjel_ir__visitor, selected_hooks )
+{
+    const auto module = parse( SOURCE );
+    Context context;
+
+    Counter counter;
+    u64 values = 0;
+    Traverser::iterate(
+        *module, Traversal::PREORDER, &counter, context, [&values]( Value& ) { values++; } );
+
+    EXPECT_EQ( values, 10 );
+    EXPECT_EQ( counter.instructions, 2 );
+    EXPECT_EQ( counter.stores, 1 );
+    EXPECT_EQ( counter.references, 2 );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
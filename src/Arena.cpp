@@ -0,0 +1,150 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Arena.h"
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+using namespace libcjel_ir;
+
+Arena::Arena( std::size_t slabsize )
+: m_slabs()
+, m_slabsize( slabsize )
+, m_owner( std::this_thread::get_id() )
+, m_local{ nullptr, nullptr, { 0 } }
+, m_shared{ nullptr, nullptr, { 0 } }
+{
+    if( m_slabsize == 0 )
+    {
+        throw std::domain_error( "slab size of 'Arena' cannot be '0'" );
+    }
+}
+
+Arena::~Arena( void )
+{
+    for( auto slab : m_slabs )
+    {
+        ::operator delete( slab );
+    }
+}
+
+void* Arena::allocate( std::size_t size, std::size_t alignment )
+{
+    assert( alignment > 0 and ( alignment & ( alignment - 1 ) ) == 0 );
+
+    if( std::this_thread::get_id() == m_owner )
+    {
+        return allocate( m_local, size, alignment );
+    }
+
+    std::lock_guard< std::mutex > guard( m_lock );
+    return allocate( m_shared, size, alignment );
+}
+
+std::size_t Arena::slabs( void ) const
+{
+    std::lock_guard< std::mutex > guard( m_lock );
+    return m_slabs.size();
+}
+
+std::size_t Arena::bytes( void ) const
+{
+    return m_local.bytes.load( std::memory_order_relaxed ) +
+           m_shared.bytes.load( std::memory_order_relaxed );
+}
+
+void* Arena::allocate( Region& region, std::size_t size, std::size_t alignment )
+{
+    auto address = reinterpret_cast< std::uintptr_t >( region.head );
+    auto aligned = ( address + alignment - 1 ) & ~( alignment - 1 );
+
+    // only one thread at a time updates the byte count of a region
+    region.bytes.store(
+        region.bytes.load( std::memory_order_relaxed ) + size, std::memory_order_relaxed );
+
+    if( region.head == nullptr or
+        aligned + size > reinterpret_cast< std::uintptr_t >( region.tail ) )
+    {
+        if( size + alignment > m_slabsize )
+        {
+            // oversized requests get a dedicated slab and keep the current one
+            auto storage = reinterpret_cast< std::uintptr_t >( slab( size + alignment ) );
+            return reinterpret_cast< void* >( ( storage + alignment - 1 ) & ~( alignment - 1 ) );
+        }
+
+        region.head = slab( m_slabsize );
+        region.tail = region.head + m_slabsize;
+
+        address = reinterpret_cast< std::uintptr_t >( region.head );
+        aligned = ( address + alignment - 1 ) & ~( alignment - 1 );
+    }
+
+    region.head = reinterpret_cast< u8* >( aligned + size );
+
+    return reinterpret_cast< void* >( aligned );
+}
+
+u8* Arena::slab( std::size_t size )
+{
+    auto storage = static_cast< u8* >( ::operator new( size ) );
+
+    // the owner registers its slabs under the lock of the other threads
+    std::unique_lock< std::mutex > guard( m_lock, std::defer_lock );
+    if( std::this_thread::get_id() == m_owner )
+    {
+        guard.lock();
+    }
+
+    m_slabs.push_back( storage );
+    return storage;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
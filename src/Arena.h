@@ -0,0 +1,182 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_ARENA_H_
+#define _LIBCJEL_IR_ARENA_H_
+
+#include <libcjel-ir/CjelIR>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    bump-pointer allocation arena
+
+       Hands out storage from large slabs by advancing a pointer. Single
+       allocations are never given back, all slabs are released at once when
+       the arena is destroyed.
+
+       The thread which creates the arena allocates without synchronization,
+       all other threads allocate from separate slabs under a lock. An arena
+       can therefore be shared by concurrent builders, but it is fastest if
+       it is created by the thread which fills it.
+    */
+
+    class Arena final
+    {
+      public:
+        using Ptr = std::shared_ptr< Arena >;
+
+        static constexpr std::size_t SlabSize = 1 << 20;
+
+        Arena( std::size_t slabsize = SlabSize );
+
+        ~Arena( void );
+
+        Arena( const Arena& ) = delete;
+
+        Arena& operator=( const Arena& ) = delete;
+
+        void* allocate( std::size_t size, std::size_t alignment );
+
+        std::size_t slabs( void ) const;
+
+        std::size_t bytes( void ) const;
+
+        /**
+           standard allocator adapter which can be used together with
+           'std::allocate_shared', the allocator keeps the arena alive as long
+           as one object (and its control block) of the arena exists
+        */
+
+        template < typename T >
+        class Allocator
+        {
+          public:
+            using value_type = T;
+
+            Allocator( const Arena::Ptr& arena )
+            : m_arena( arena )
+            {
+            }
+
+            template < typename U >
+            Allocator( const Allocator< U >& other )
+            : m_arena( other.arena() )
+            {
+            }
+
+            T* allocate( std::size_t n )
+            {
+                return static_cast< T* >( m_arena->allocate( n * sizeof( T ), alignof( T ) ) );
+            }
+
+            void deallocate( T*, std::size_t )
+            {
+                // memory is released together with the arena
+            }
+
+            const Arena::Ptr& arena( void ) const
+            {
+                return m_arena;
+            }
+
+            template < typename U >
+            u1 operator==( const Allocator< U >& rhs ) const
+            {
+                return m_arena == rhs.arena();
+            }
+
+            template < typename U >
+            u1 operator!=( const Allocator< U >& rhs ) const
+            {
+                return m_arena != rhs.arena();
+            }
+
+          private:
+            Arena::Ptr m_arena;
+        };
+
+      private:
+        struct Region
+        {
+            u8* head;
+            u8* tail;
+
+            // written by one thread at a time, read by 'bytes'
+            std::atomic< std::size_t > bytes;
+        };
+
+        void* allocate( Region& region, std::size_t size, std::size_t alignment );
+
+        u8* slab( std::size_t size );
+
+        std::vector< u8* > m_slabs;
+
+        std::size_t m_slabsize;
+
+        const std::thread::id m_owner;
+
+        // region of the owner thread
+        Region m_local;
+
+        // region of all other threads, guarded by 'm_lock'
+        Region m_shared;
+
+        mutable std::mutex m_lock;
+    };
+}
+
+#endif  // _LIBCJEL_IR_ARENA_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
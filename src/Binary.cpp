@@ -0,0 +1,860 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Binary.h"
+
+#include <libcjel-ir/CallableUnit>
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Variable>
+
+#include <libstdhl/Memory>
+
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace libcjel_ir;
+
+static_assert( sizeof( Binary::Header ) == 128, "unexpected 'Binary::Header' layout" );
+static_assert( sizeof( Binary::String ) == 8, "unexpected 'Binary::String' layout" );
+static_assert( sizeof( Binary::TypeRecord ) == 16, "unexpected 'Binary::TypeRecord' layout" );
+static_assert( sizeof( Binary::ValueRecord ) == 32, "unexpected 'Binary::ValueRecord' layout" );
+static_assert(
+    sizeof( Binary::FunctionRecord ) == 16, "unexpected 'Binary::FunctionRecord' layout" );
+
+constexpr u32 Binary::Version;
+constexpr u32 Binary::None;
+constexpr u32 Binary::Endian;
+
+const char Binary::Magic[ 8 ] = { '\x7f', 'C', 'J', 'E', 'L', 'I', 'R', '\0' };
+
+Binary::Ptr Binary::open( const std::string& filename )
+{
+    const auto fd = ::open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+    {
+        throw std::domain_error( "unable to open binary module '" + filename + "'" );
+    }
+
+    struct stat info;
+    if( ::fstat( fd, &info ) != 0 or info.st_size <= 0 )
+    {
+        ::close( fd );
+        throw std::domain_error( "unable to read binary module '" + filename + "'" );
+    }
+
+    const auto size = static_cast< std::size_t >( info.st_size );
+    const auto data = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+
+    if( data == MAP_FAILED )
+    {
+        throw std::domain_error( "unable to map binary module '" + filename + "'" );
+    }
+
+    try
+    {
+        return Binary::Ptr( new Binary( static_cast< const u8* >( data ), size, true ) );
+    }
+    catch( ... )
+    {
+        ::munmap( data, size );
+        throw;
+    }
+}
+
+Binary::Binary( const u8* data, std::size_t size )
+: Binary( data, size, false )
+{
+}
+
+Binary::Binary( const u8* data, std::size_t size, u1 mapped )
+: m_data( data )
+, m_size( size )
+, m_mapped( mapped )
+, m_strings( nullptr )
+, m_types( nullptr )
+, m_values( nullptr )
+, m_functions( nullptr )
+, m_operands( nullptr )
+, m_contents( nullptr )
+{
+    if( m_data == nullptr or m_size < sizeof( Header ) or
+        ( reinterpret_cast< std::uintptr_t >( m_data ) % alignof( Header ) ) != 0 )
+    {
+        throw std::domain_error( "invalid binary module buffer" );
+    }
+
+    const auto& h = header();
+
+    if( std::memcmp( h.magic, Magic, sizeof( Magic ) ) != 0 )
+    {
+        throw std::domain_error( "invalid binary module magic" );
+    }
+
+    if( h.endian != Endian )
+    {
+        throw std::domain_error( "unsupported binary module byte order" );
+    }
+
+    if( h.version != Version )
+    {
+        throw std::domain_error(
+            "unsupported binary module version '" + std::to_string( h.version ) + "'" );
+    }
+
+    if( h.size != m_size )
+    {
+        throw std::domain_error( "truncated binary module" );
+    }
+
+    // validate all section bounds once, the accessors only check the index
+    m_strings = section< String >( h.strings );
+    m_types = section< TypeRecord >( h.types );
+    m_values = section< ValueRecord >( h.values );
+    m_functions = section< FunctionRecord >( h.functions );
+    m_operands = section< u32 >( h.operands );
+    m_contents = section< u32 >( h.contents );
+
+    name();
+}
+
+Binary::~Binary( void )
+{
+    if( m_mapped )
+    {
+        ::munmap( const_cast< u8* >( m_data ), m_size );
+    }
+}
+
+const Binary::Header& Binary::header( void ) const
+{
+    return *reinterpret_cast< const Header* >( m_data );
+}
+
+std::size_t Binary::size( void ) const
+{
+    return m_size;
+}
+
+const char* Binary::name( void ) const
+{
+    return string( header().name );
+}
+
+u32 Binary::strings( void ) const
+{
+    return header().strings.count;
+}
+
+const char* Binary::string( u32 index ) const
+{
+    const auto& table = header().strings;
+
+    if( index >= table.count )
+    {
+        throw std::domain_error( "invalid binary module string '" + std::to_string( index ) + "'" );
+    }
+
+    const auto& entry = m_strings[ index ];
+    const auto offset = table.offset + table.count * sizeof( String ) + entry.offset;
+
+    if( offset + entry.length >= m_size or m_data[ offset + entry.length ] != '\0' )
+    {
+        throw std::domain_error( "invalid binary module string '" + std::to_string( index ) + "'" );
+    }
+
+    return reinterpret_cast< const char* >( m_data + offset );
+}
+
+u32 Binary::types( void ) const
+{
+    return header().types.count;
+}
+
+const Binary::TypeRecord& Binary::type( u32 index ) const
+{
+    if( index >= types() )
+    {
+        throw std::domain_error( "invalid binary module type '" + std::to_string( index ) + "'" );
+    }
+
+    return m_types[ index ];
+}
+
+u32 Binary::values( void ) const
+{
+    return header().values.count;
+}
+
+const Binary::ValueRecord& Binary::value( u32 index ) const
+{
+    if( index >= values() )
+    {
+        throw std::domain_error( "invalid binary module value '" + std::to_string( index ) + "'" );
+    }
+
+    return m_values[ index ];
+}
+
+u32 Binary::functions( void ) const
+{
+    return header().functions.count;
+}
+
+const Binary::FunctionRecord& Binary::function( u32 index ) const
+{
+    if( index >= functions() )
+    {
+        throw std::domain_error(
+            "invalid binary module function '" + std::to_string( index ) + "'" );
+    }
+
+    return m_functions[ index ];
+}
+
+const u32* Binary::operands( u32 first, u32 count ) const
+{
+    if( static_cast< u64 >( first ) + count > header().operands.count )
+    {
+        throw std::domain_error( "invalid binary module operand list" );
+    }
+
+    return m_operands + first;
+}
+
+u32 Binary::contents( void ) const
+{
+    return header().contents.count;
+}
+
+const u32* Binary::content( void ) const
+{
+    return m_contents;
+}
+
+template < typename T >
+const T* Binary::section( const Section& section ) const
+{
+    if( section.offset % alignof( u64 ) != 0 or section.offset > m_size or
+        section.count > ( m_size - section.offset ) / sizeof( T ) )
+    {
+        throw std::domain_error( "invalid binary module section" );
+    }
+
+    return reinterpret_cast< const T* >( m_data + section.offset );
+}
+
+void Binary::attach( Instruction& instruction, const Statement::Ptr& statement )
+{
+    // the statement relation was established (and checked) when the binary
+    // was written, 'setStatement' would re-add operands to the statement
+    instruction.m_statement = statement;
+}
+
+//
+//
+// Binary::Reader
+//
+
+class Binary::Reader
+{
+  public:
+    Reader( const Binary& binary, u8 options )
+    : m_binary( binary )
+    , m_module( libstdhl::Memory::make< Module >( binary.name(), options ) )
+    , m_types( binary.types() )
+    , m_values( binary.values() )
+    , m_typing( binary.types() )
+    , m_valuing( binary.values() )
+    {
+    }
+
+    Module::Ptr read( void )
+    {
+        for( u32 c = 0; c < m_values.size(); c++ )
+        {
+            value( c );
+        }
+
+        for( u32 c = 0; c < m_values.size(); c++ )
+        {
+            link( c );
+        }
+
+        const auto content = m_binary.content();
+        for( u32 c = 0; c < m_binary.contents(); c++ )
+        {
+            m_module->add( value( content[ c ] ) );
+        }
+
+        return m_module;
+    }
+
+  private:
+    Type::Ptr type( u32 index )
+    {
+        if( index == Binary::None )
+        {
+            return nullptr;
+        }
+
+        const auto& record = m_binary.type( index );
+        auto& type = m_types[ index ];
+        if( type )
+        {
+            return type;
+        }
+
+        // a record which refers to itself (directly or through other records)
+        // would recurse until the stack is exhausted
+        if( m_typing[ index ] )
+        {
+            throw std::domain_error(
+                "binary module type '" + std::to_string( index ) + "' refers to itself" );
+        }
+        m_typing[ index ] = true;
+
+        switch( record.id )
+        {
+            case Type::LABEL:
+            {
+                type = libstdhl::Memory::get< LabelType >();
+                break;
+            }
+            case Type::VOID:
+            {
+                type = libstdhl::Memory::get< VoidType >();
+                break;
+            }
+            case Type::BIT:
+            {
+                type = BitType::get( record.length );
+                break;
+            }
+            case Type::STRING:
+            {
+                type = libstdhl::Memory::get< StringType >();
+                break;
+            }
+            case Type::INTERCONNECT:
+            {
+                type = libstdhl::Memory::get< InterconnectType >();
+                break;
+            }
+            case Type::VECTOR:
+            {
+                type = libstdhl::Memory::get< VectorType >(
+                    this->type( record.first ), record.length );
+                break;
+            }
+            case Type::STRUCTURE:
+            {
+                // the type cache could return a type of an equal structure
+                // of another module, therefore the type refers to this one
+                type = libstdhl::Memory::make< StructureType >(
+                    object< Structure >( record.first ) );
+                break;
+            }
+            case Type::RELATION:
+            {
+                const auto list =
+                    operands( record.first, static_cast< u64 >( record.count ) + record.extra );
+
+                std::vector< Type::Ptr > results;
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    results.emplace_back( this->type( list[ c ] ) );
+                }
+
+                std::vector< Type::Ptr > arguments;
+                for( u32 c = record.count; c < record.count + record.extra; c++ )
+                {
+                    arguments.emplace_back( this->type( list[ c ] ) );
+                }
+
+                type = libstdhl::Memory::get< RelationType >( results, arguments );
+                break;
+            }
+            default:
+            {
+                throw std::domain_error(
+                    "unsupported binary module type kind '" + std::to_string( record.id ) + "'" );
+            }
+        }
+
+        m_typing[ index ] = false;
+        return type;
+    }
+
+    template < typename T >
+    typename T::Ptr object( u32 index )
+    {
+        const auto result = value( index );
+        if( not isa< T >( result ) )
+        {
+            throw std::domain_error(
+                "binary module value '" + std::to_string( index ) + "' has an unexpected kind" );
+        }
+
+        return std::static_pointer_cast< T >( result );
+    }
+
+    const u32* operands( u64 first, u64 count ) const
+    {
+        // record fields are combined in 64-bit, a list which does not fit
+        // into the 32-bit operand section range is invalid anyway
+        if( first > std::numeric_limits< u32 >::max() or
+            count > std::numeric_limits< u32 >::max() )
+        {
+            throw std::domain_error( "invalid binary module operand list" );
+        }
+
+        return m_binary.operands( first, count );
+    }
+
+    u32 payload( const ValueRecord& record ) const
+    {
+        // used as a value index or a count, not as a bit constant value
+        if( record.payload > std::numeric_limits< u32 >::max() )
+        {
+            throw std::domain_error( "invalid binary module value payload" );
+        }
+
+        return record.payload;
+    }
+
+    Value::Ptr operand( const ValueRecord& record, u32 position )
+    {
+        if( position >= record.count )
+        {
+            throw std::domain_error( "binary module value has too few operands" );
+        }
+
+        return value( m_binary.operands( record.first, record.count )[ position ] );
+    }
+
+    Value::Ptr value( u32 index )
+    {
+        if( index == Binary::None )
+        {
+            return nullptr;
+        }
+
+        const auto& record = m_binary.value( index );
+        auto& value = m_values[ index ];
+        if( value )
+        {
+            return value;
+        }
+
+        if( m_valuing[ index ] )
+        {
+            throw std::domain_error(
+                "binary module value '" + std::to_string( index ) + "' refers to itself" );
+        }
+        m_valuing[ index ] = true;
+
+        const auto& m = *m_module;
+        const std::string name = m_binary.string( record.name );
+
+        switch( record.id )
+        {
+            case Value::VOID_CONSTANT:
+            {
+                value = m.make< VoidConstant >();
+                break;
+            }
+            case Value::BIT_CONSTANT:
+            {
+                value = m.make< BitConstant >( type( record.type ), record.payload );
+                break;
+            }
+            case Value::STRING_CONSTANT:
+            {
+                value = m.make< StringConstant >( name );
+                break;
+            }
+            case Value::IDENTIFIER:
+            {
+                value = m.make< Identifier >( type( record.type ), name );
+                break;
+            }
+            case Value::STRUCTURE_CONSTANT:
+            {
+                std::vector< Constant > elements;
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    elements.emplace_back( *object< Constant >(
+                        m_binary.operands( record.first, record.count )[ c ] ) );
+                }
+
+                value = m.make< StructureConstant >( type( record.type ), elements );
+                break;
+            }
+            case Value::STRUCTURE:
+            {
+                const auto list = operands( record.first, static_cast< u64 >( record.count ) * 2 );
+
+                std::vector< StructureElement > elements;
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    elements.emplace_back(
+                        type( list[ c * 2 ] ), m_binary.string( list[ c * 2 + 1 ] ) );
+                }
+
+                value = m.make< Structure >( name, elements );
+                break;
+            }
+            case Value::VARIABLE:
+            {
+                value = m.make< Variable >( type( record.type ), operand( record, 0 ), name );
+                break;
+            }
+            case Value::MEMORY:
+            {
+                const auto& vector = m_binary.type( record.type );
+                value = m.make< Memory >( name, type( vector.first ), record.payload );
+                break;
+            }
+            case Value::INTERCONNECT:
+            {
+                value = m.make< Interconnect >( name );
+                break;
+            }
+            case Value::INTRINSIC:
+            {
+                value = m.make< Intrinsic >( name, type( record.type ) );
+                break;
+            }
+            case Value::FUNCTION:
+            {
+                value = m.make< Function >(
+                    name, std::static_pointer_cast< RelationType >( type( record.type ) ) );
+                break;
+            }
+            case Value::REFERENCE:
+            {
+                value = m.make< Reference >(
+                    name, type( record.type ), static_cast< Reference::Kind >( record.flags ) );
+                break;
+            }
+            case Value::SEQUENTIAL_SCOPE:
+            {
+                value = m.make< SequentialScope >();
+                break;
+            }
+            case Value::PARALLEL_SCOPE:
+            {
+                value = m.make< ParallelScope >();
+                break;
+            }
+            case Value::TRIVIAL_STATEMENT:
+            {
+                value = m.make< TrivialStatement >();
+                break;
+            }
+            case Value::BRANCH_STATEMENT:
+            {
+                value = m.make< BranchStatement >();
+                break;
+            }
+            case Value::LOOP_STATEMENT:
+            {
+                value = m.make< LoopStatement >();
+                break;
+            }
+            default:
+            {
+                value = instruction( record );
+                break;
+            }
+        }
+
+        m_valuing[ index ] = false;
+        return value;
+    }
+
+    Instruction::Ptr instruction( const ValueRecord& record )
+    {
+        const auto& m = *m_module;
+
+        switch( record.id )
+        {
+            case Value::NOP_INSTRUCTION:
+            {
+                return m.make< NopInstruction >();
+            }
+            case Value::ALLOC_INSTRUCTION:
+            {
+                return m.make< AllocInstruction >( type( record.type ) );
+            }
+            case Value::ID_INSTRUCTION:
+            {
+                return m.make< IdInstruction >( operand( record, 0 ) );
+            }
+            case Value::LOAD_INSTRUCTION:
+            {
+                return m.make< LoadInstruction >( operand( record, 0 ) );
+            }
+            case Value::ZEXT_INSTRUCTION:
+            {
+                return m.make< ZeroExtendInstruction >( operand( record, 0 ), type( record.type ) );
+            }
+            case Value::TRUNC_INSTRUCTION:
+            {
+                return m.make< TruncationInstruction >( operand( record, 0 ), type( record.type ) );
+            }
+            case Value::NOT_INSTRUCTION:
+            {
+                return m.make< NotInstruction >( operand( record, 0 ) );
+            }
+            case Value::LNOT_INSTRUCTION:
+            {
+                return m.make< LnotInstruction >( operand( record, 0 ) );
+            }
+            case Value::CAST_INSTRUCTION:
+            {
+                return m.make< CastInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::EXTRACT_INSTRUCTION:
+            {
+                return m.make< ExtractInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::STORE_INSTRUCTION:
+            {
+                return m.make< StoreInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::ID_CALL_INSTRUCTION:
+            {
+                return m.make< IdCallInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::AND_INSTRUCTION:
+            {
+                return m.make< AndInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::OR_INSTRUCTION:
+            {
+                return m.make< OrInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::XOR_INSTRUCTION:
+            {
+                return m.make< XorInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::ADDS_INSTRUCTION:
+            {
+                return m.make< AddSignedInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::ADDU_INSTRUCTION:
+            {
+                return m.make< AddUnsignedInstruction >(
+                    operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::DIVS_INSTRUCTION:
+            {
+                return m.make< DivSignedInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::MODU_INSTRUCTION:
+            {
+                return m.make< ModUnsignedInstruction >(
+                    operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::EQU_INSTRUCTION:
+            {
+                return m.make< EquInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::NEQ_INSTRUCTION:
+            {
+                return m.make< NeqInstruction >( operand( record, 0 ), operand( record, 1 ) );
+            }
+            case Value::CALL_INSTRUCTION:
+            {
+                std::vector< Value::Ptr > arguments;
+                for( u32 c = 1; c < record.count; c++ )
+                {
+                    arguments.emplace_back( operand( record, c ) );
+                }
+
+                return m.make< CallInstruction >( operand( record, 0 ), arguments );
+            }
+            case Value::STREAM_INSTRUCTION:
+            {
+                auto instr = m.make< StreamInstruction >(
+                    static_cast< StreamInstruction::Channel >( record.flags ) );
+
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    instr->add( operand( record, c ) );
+                }
+
+                return instr;
+            }
+            default:
+            {
+                throw std::domain_error(
+                    "unsupported binary module value kind '" + std::to_string( record.id ) + "'" );
+            }
+        }
+    }
+
+    void link( u32 index )
+    {
+        const auto& record = m_binary.value( index );
+        const auto& value = m_values[ index ];
+        const auto list = m_binary.operands( record.first, record.count );
+
+        if( isa< CallableUnit >( value ) )
+        {
+            auto callable = std::static_pointer_cast< CallableUnit >( value );
+
+            for( u32 c = 0; c < record.count; c++ )
+            {
+                callable->add( object< Reference >( list[ c ] ) );
+            }
+
+            if( record.payload != Binary::None )
+            {
+                callable->setContext( object< Scope >( payload( record ) ) );
+            }
+        }
+        else if( isa< Reference >( value ) )
+        {
+            if( record.parent != Binary::None )
+            {
+                std::static_pointer_cast< Reference >( value )->setCallable(
+                    object< CallableUnit >( record.parent ) );
+            }
+        }
+        else if( isa< Interconnect >( value ) )
+        {
+            auto interconnect = std::static_pointer_cast< Interconnect >( value );
+
+            for( u32 c = 0; c < record.count; c++ )
+            {
+                interconnect->add( this->value( list[ c ] ) );
+            }
+        }
+        else if( isa< Block >( value ) )
+        {
+            if( record.parent != Binary::None )
+            {
+                std::static_pointer_cast< Block >( value )->setParent(
+                    object< Block >( record.parent ) );
+            }
+
+            if( isa< Scope >( value ) )
+            {
+                auto scope = std::static_pointer_cast< Scope >( value );
+
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    scope->add( object< Block >( list[ c ] ) );
+                }
+            }
+            else
+            {
+                auto statement = std::static_pointer_cast< Statement >( value );
+                const u32 count = payload( record );
+                const auto scopes =
+                    operands( static_cast< u64 >( record.first ) + record.count, count );
+
+                for( u32 c = 0; c < record.count; c++ )
+                {
+                    statement->add( object< Instruction >( list[ c ] ) );
+                }
+
+                for( u32 c = 0; c < count; c++ )
+                {
+                    statement->add( object< Scope >( scopes[ c ] ) );
+                }
+            }
+        }
+        else if( isa< Instruction >( value ) )
+        {
+            if( record.parent != Binary::None )
+            {
+                Binary::attach(
+                    static_cast< Instruction& >( *value ), object< Statement >( record.parent ) );
+            }
+        }
+    }
+
+    const Binary& m_binary;
+
+    Module::Ptr m_module;
+
+    std::vector< Type::Ptr > m_types;
+
+    std::vector< Value::Ptr > m_values;
+
+    std::vector< u1 > m_typing;
+
+    std::vector< u1 > m_valuing;
+};
+
+Module::Ptr Binary::module( u8 options ) const
+{
+    Reader reader( *this, options );
+    return reader.read();
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
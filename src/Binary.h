@@ -0,0 +1,260 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_BINARY_H_
+#define _LIBCJEL_IR_BINARY_H_
+
+#include <libcjel-ir/Module>
+
+namespace libcjel_ir
+{
+    class Instruction;
+    class Statement;
+
+    /**
+       @brief    memory-mappable binary module format
+
+       A binary module consists of a fixed header followed by a string, type,
+       value, function and operand section. Sections only contain fixed-size
+       records which refer to each other by table index, all offsets are
+       relative to the beginning of the file. Therefore an opened binary can be
+       inspected in place (names, constants and operand indices) without any
+       per-record parsing, a 'Module' is only materialized on request.
+
+       Layout (version 1, host byte order, all sections are 8-byte aligned):
+
+       header    | 'Header'
+       strings   | 'String' x count, followed by the NUL-terminated bytes
+       types     | 'TypeRecord' x count
+       values    | 'ValueRecord' x count
+       functions | 'FunctionRecord' x count
+       operands  | u32 x count, operand lists of the type and value records
+       contents  | u32 x count, value indices of the module contents
+    */
+
+    class Binary final
+    {
+      public:
+        using Ptr = std::shared_ptr< Binary >;
+
+        static constexpr u32 Version = 1;
+
+        static constexpr u32 None = 0xffffffff;
+
+        static constexpr u32 Endian = 0x01020304;
+
+        static const char Magic[ 8 ];
+
+        struct Section
+        {
+            u64 offset;
+            u64 count;
+        };
+
+        struct Header
+        {
+            char magic[ 8 ];
+            u32 version;
+            u32 endian;
+            u64 size;
+            u32 name;
+            u32 reserved;
+            Section strings;
+            Section types;
+            Section values;
+            Section functions;
+            Section operands;
+            Section contents;
+        };
+
+        struct String
+        {
+            u32 offset;  // relative to the end of the string table
+            u32 length;
+        };
+
+        /**
+           bit: 'length' is the bit size, vector: 'first' is the element type
+           and 'length' the element count, structure: 'first' is the value
+           index of the structure, relation: 'first' is the operand offset of
+           'count' result types followed by 'extra' argument types
+        */
+
+        struct TypeRecord
+        {
+            u8 id;
+            u8 reserved;
+            u16 length;
+            u32 first;
+            u32 count;
+            u32 extra;
+        };
+
+        /**
+           'first' and 'count' select the operand list of the value (operands,
+           elements, blocks, references, ...), 'parent' is the statement of an
+           instruction, the parent block of a block or the callable of a
+           reference, 'payload' holds the bit constant value, the memory length,
+           the context scope of a callable or the scope count of a statement
+        */
+
+        struct ValueRecord
+        {
+            u8 id;
+            u8 flags;
+            u16 reserved;
+            u32 name;
+            u32 type;
+            u32 parent;
+            u32 first;
+            u32 count;
+            u64 payload;
+        };
+
+        /**
+           all values of a function body are stored consecutively in the value
+           section starting at 'first'
+        */
+
+        struct FunctionRecord
+        {
+            u32 value;
+            u32 context;
+            u32 first;
+            u32 count;
+        };
+
+        /**
+           maps 'filename' read-only into memory and validates its header
+        */
+
+        static Binary::Ptr open( const std::string& filename );
+
+        /**
+           uses an existing buffer, the buffer has to outlive the binary
+        */
+
+        Binary( const u8* data, std::size_t size );
+
+        ~Binary( void );
+
+        Binary( const Binary& ) = delete;
+
+        Binary& operator=( const Binary& ) = delete;
+
+        const Header& header( void ) const;
+
+        std::size_t size( void ) const;
+
+        const char* name( void ) const;
+
+        u32 strings( void ) const;
+
+        const char* string( u32 index ) const;
+
+        u32 types( void ) const;
+
+        const TypeRecord& type( u32 index ) const;
+
+        u32 values( void ) const;
+
+        const ValueRecord& value( u32 index ) const;
+
+        u32 functions( void ) const;
+
+        const FunctionRecord& function( u32 index ) const;
+
+        const u32* operands( u32 first, u32 count ) const;
+
+        u32 contents( void ) const;
+
+        const u32* content( void ) const;
+
+        /**
+           creates a module with all contents of the binary, the module
+           options control how the objects are allocated
+        */
+
+        Module::Ptr module( u8 options = Module::NONE ) const;
+
+      private:
+        class Reader;
+
+        Binary( const u8* data, std::size_t size, u1 mapped );
+
+        template < typename T >
+        const T* section( const Section& section ) const;
+
+        static void attach(
+            Instruction& instruction, const std::shared_ptr< Statement >& statement );
+
+        const u8* m_data;
+
+        std::size_t m_size;
+
+        u1 m_mapped;
+
+        // validated once by the constructor
+        const String* m_strings;
+
+        const TypeRecord* m_types;
+
+        const ValueRecord* m_values;
+
+        const FunctionRecord* m_functions;
+
+        const u32* m_operands;
+
+        const u32* m_contents;
+    };
+}
+
+#endif  // _LIBCJEL_IR_BINARY_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,536 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "BitValue.h"
+
+#include <algorithm>
+
+using namespace libcjel_ir;
+
+constexpr u32 BitValue::LimbBits;
+constexpr u32 BitValue::Limbs;
+
+static inline void check( u16 bitsize )
+{
+    if( bitsize < 1 or bitsize > BitType::SizeMax )
+    {
+        throw std::domain_error(
+            "bit size '" + std::to_string( bitsize ) + "' of 'BitValue' is out of range" );
+    }
+}
+
+static inline u64 bit( const u64* limbs, u32 index )
+{
+    return ( limbs[ index / BitValue::LimbBits ] >> ( index % BitValue::LimbBits ) ) & 1;
+}
+
+static inline u64 mask( u16 bitsize )
+{
+    return bitsize >= 64 ? ~( (u64)0 ) : ( ( (u64)1 << bitsize ) - 1 );
+}
+
+BitValue::BitValue( u16 bitsize, u64 value )
+: m_limbs{}
+, m_bitsize( bitsize )
+{
+    check( bitsize );
+    m_limbs[ 0 ] = value & mask( bitsize );
+}
+
+BitValue::BitValue( u16 bitsize, std::initializer_list< u64 > limbs )
+: m_limbs{}
+, m_bitsize( bitsize )
+{
+    check( bitsize );
+
+    u32 index = 0;
+    for( const auto limb : limbs )
+    {
+        if( index == size() )
+        {
+            break;
+        }
+        m_limbs[ index++ ] = limb;
+    }
+
+    clear();
+}
+
+BitValue::BitValue( const BitConstant& constant )
+: BitValue( constant.type().bitsize(), constant.value().value() )
+{
+}
+
+u1 BitValue::fits( void ) const
+{
+    u64 high = 0;
+    for( u32 c = 1; c < Limbs; c++ )
+    {
+        high |= m_limbs[ c ];
+    }
+    return high == 0;
+}
+
+u1 BitValue::sign( void ) const
+{
+    const u32 bit = m_bitsize - 1;
+    return ( m_limbs[ bit / LimbBits ] >> ( bit % LimbBits ) ) & 1;
+}
+
+u1 BitValue::isZero( void ) const
+{
+    u64 bits = 0;
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        bits |= m_limbs[ c ];
+    }
+    return bits == 0;
+}
+
+BitValue BitValue::addu( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+    BitValue result( m_bitsize, Unchecked() );
+
+    if( m_bitsize <= LimbBits )
+    {
+        result.m_limbs[ 0 ] = ( m_limbs[ 0 ] + rhs.m_limbs[ 0 ] ) & mask( m_bitsize );
+        return result;
+    }
+
+    u64 carry = 0;
+    for( u32 c = 0; c < size(); c++ )
+    {
+        const u64 sum = m_limbs[ c ] + rhs.m_limbs[ c ];
+        const u64 total = sum + carry;
+        carry = ( sum < m_limbs[ c ] ) | ( total < sum );
+        result.m_limbs[ c ] = total;
+    }
+
+    result.clear();
+    return result;
+}
+
+BitValue BitValue::adds( const BitValue& rhs ) const
+{
+    // equal to the unsigned addition in two's complement
+    return addu( rhs );
+}
+
+BitValue BitValue::divs( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+
+    if( rhs.isZero() )
+    {
+        throw std::domain_error( "division by zero" );
+    }
+
+    if( m_bitsize <= LimbBits )
+    {
+        const u64 sign = (u64)1 << ( m_bitsize - 1 );
+        const i64 lhs = (i64)( ( m_limbs[ 0 ] ^ sign ) - sign );
+        const i64 rhs_ = (i64)( ( rhs.m_limbs[ 0 ] ^ sign ) - sign );
+
+        // avoid the overflow trap of the minimum value divided by '-1'
+        const u64 quotient = rhs_ == -1 ? ( 0 - (u64)lhs ) : (u64)( lhs / rhs_ );
+        return BitValue( m_bitsize, quotient );
+    }
+
+    const u1 negative = sign() != rhs.sign();
+
+    BitValue quotient( m_bitsize, Unchecked() );
+    divide( sign() ? negate() : *this, rhs.sign() ? rhs.negate() : rhs, &quotient, nullptr );
+
+    return negative ? quotient.negate() : quotient;
+}
+
+BitValue BitValue::modu( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+
+    if( rhs.isZero() )
+    {
+        throw std::domain_error( "division by zero" );
+    }
+
+    BitValue remainder( m_bitsize, Unchecked() );
+
+    if( m_bitsize <= LimbBits )
+    {
+        remainder.m_limbs[ 0 ] = m_limbs[ 0 ] % rhs.m_limbs[ 0 ];
+        return remainder;
+    }
+
+    divide( *this, rhs, nullptr, &remainder );
+    return remainder;
+}
+
+BitValue BitValue::operator&( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+    BitValue result( m_bitsize, Unchecked() );
+
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        result.m_limbs[ c ] = m_limbs[ c ] & rhs.m_limbs[ c ];
+    }
+    return result;
+}
+
+BitValue BitValue::operator|( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+    BitValue result( m_bitsize, Unchecked() );
+
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        result.m_limbs[ c ] = m_limbs[ c ] | rhs.m_limbs[ c ];
+    }
+    return result;
+}
+
+BitValue BitValue::operator^( const BitValue& rhs ) const
+{
+    assert( m_bitsize == rhs.m_bitsize );
+    BitValue result( m_bitsize, Unchecked() );
+
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        result.m_limbs[ c ] = m_limbs[ c ] ^ rhs.m_limbs[ c ];
+    }
+    return result;
+}
+
+BitValue BitValue::operator~( void ) const
+{
+    BitValue result( m_bitsize, Unchecked() );
+
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        result.m_limbs[ c ] = m_limbs[ c ] ^ ones( m_bitsize, c );
+    }
+    return result;
+}
+
+BitValue BitValue::lnot( void ) const
+{
+    BitValue result( 1, Unchecked() );
+    result.m_limbs[ 0 ] = isZero();
+    return result;
+}
+
+BitValue BitValue::equ( const BitValue& rhs ) const
+{
+    BitValue result( 1, Unchecked() );
+    result.m_limbs[ 0 ] = ( *this ^ rhs ).isZero();
+    return result;
+}
+
+BitValue BitValue::neq( const BitValue& rhs ) const
+{
+    BitValue result( 1, Unchecked() );
+    result.m_limbs[ 0 ] = not( *this ^ rhs ).isZero();
+    return result;
+}
+
+BitValue BitValue::zext( u16 bitsize ) const
+{
+    check( bitsize );
+
+    if( bitsize < m_bitsize )
+    {
+        throw std::domain_error( "cannot zero extend a '" + std::to_string( m_bitsize ) +
+                                 "' bit value to '" + std::to_string( bitsize ) + "' bits" );
+    }
+
+    BitValue result( *this );
+    result.m_bitsize = bitsize;
+    return result;
+}
+
+BitValue BitValue::trunc( u16 bitsize ) const
+{
+    check( bitsize );
+
+    if( bitsize > m_bitsize )
+    {
+        throw std::domain_error( "cannot truncate a '" + std::to_string( m_bitsize ) +
+                                 "' bit value to '" + std::to_string( bitsize ) + "' bits" );
+    }
+
+    BitValue result( *this );
+    result.m_bitsize = bitsize;
+    result.clear();
+    return result;
+}
+
+u1 BitValue::operator==( const BitValue& rhs ) const
+{
+    u64 diff = m_bitsize ^ rhs.m_bitsize;
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        diff |= m_limbs[ c ] ^ rhs.m_limbs[ c ];
+    }
+    return diff == 0;
+}
+
+u1 BitValue::operator!=( const BitValue& rhs ) const
+{
+    return not operator==( rhs );
+}
+
+std::string BitValue::to_string( libstdhl::Type::Radix radix ) const
+{
+    static const char DIGITS[] = "0123456789abcdef";
+
+    if( radix < 2 or radix > 16 )
+    {
+        throw std::domain_error( "radix '" + std::to_string( radix ) + "' is not supported" );
+    }
+
+    std::string result;
+    BitValue value( *this );
+
+    // repeated short division by the radix, least significant digit first
+    do
+    {
+        u64 remainder = 0;
+        for( u32 c = value.size(); c-- > 0; )
+        {
+            const u64 limb = value.m_limbs[ c ];
+
+            u64 current = ( remainder << 32 ) | ( limb >> 32 );
+            const u64 high = current / radix;
+            remainder = current % radix;
+
+            current = ( remainder << 32 ) | ( limb & 0xffffffff );
+            const u64 low = current / radix;
+            remainder = current % radix;
+
+            value.m_limbs[ c ] = ( high << 32 ) | low;
+        }
+
+        result += DIGITS[ remainder ];
+    } while( not value.isZero() );
+
+    std::reverse( result.begin(), result.end() );
+    return result;
+}
+
+void BitValue::clear( void )
+{
+    for( u32 c = 0; c < Limbs; c++ )
+    {
+        m_limbs[ c ] &= ones( m_bitsize, c );
+    }
+}
+
+BitValue BitValue::negate( void ) const
+{
+    return ( ~*this ).addu( BitValue( m_bitsize, 1 ) );
+}
+
+void BitValue::divide(
+    const BitValue& dividend, const BitValue& divisor, BitValue* quotient, BitValue* remainder )
+{
+    const u32 size = dividend.size();
+
+    BitValue q( dividend.m_bitsize, Unchecked() );
+    BitValue r( dividend.m_bitsize, Unchecked() );
+
+    if( divisor.m_limbs[ 0 ] <= 0xffffffff and divisor.fits() )
+    {
+        // short division in 32-bit digits, the remainder is below the divisor
+        const u64 d = divisor.m_limbs[ 0 ];
+        u64 rest = 0;
+
+        for( u32 c = size; c-- > 0; )
+        {
+            const u64 limb = dividend.m_limbs[ c ];
+
+            u64 current = ( rest << 32 ) | ( limb >> 32 );
+            const u64 high = current / d;
+            rest = current % d;
+
+            current = ( rest << 32 ) | ( limb & 0xffffffff );
+            const u64 low = current / d;
+            rest = current % d;
+
+            q.m_limbs[ c ] = ( high << 32 ) | low;
+        }
+
+        r.m_limbs[ 0 ] = rest;
+    }
+    else
+    {
+        // Knuth's algorithm D (TAOCP vol. 2, 4.3.1) in 32-bit digits, the
+        // divisor has at least two digits here
+        static constexpr u32 Digits = 2 * Limbs;
+        static constexpr u64 Base = (u64)1 << 32;
+
+        u32 u[ Digits + 1 ] = {};
+        u32 v[ Digits ] = {};
+        u32 w[ Digits ] = {};
+
+        u32 m = 0;
+        u32 n = 0;
+        for( u32 c = 0; c < 2 * size; c++ )
+        {
+            u[ c ] = dividend.m_limbs[ c / 2 ] >> ( 32 * ( c % 2 ) );
+            v[ c ] = divisor.m_limbs[ c / 2 ] >> ( 32 * ( c % 2 ) );
+            m = u[ c ] ? c + 1 : m;
+            n = v[ c ] ? c + 1 : n;
+        }
+        assert( n >= 2 );
+
+        if( m < n )
+        {
+            r = dividend;
+        }
+        else
+        {
+            // normalize, the top digit of the divisor gets its highest bit set
+            u32 shift = 0;
+            while( not( ( v[ n - 1 ] << shift ) & 0x80000000 ) )
+            {
+                shift++;
+            }
+
+            for( u32 c = n; c-- > 0; )
+            {
+                const u64 low = c ? (u64)v[ c - 1 ] >> ( 32 - shift ) : 0;
+                v[ c ] = ( (u64)v[ c ] << shift ) | low;
+            }
+            for( u32 c = m + 1; c-- > 0; )
+            {
+                const u64 low = c ? (u64)u[ c - 1 ] >> ( 32 - shift ) : 0;
+                u[ c ] = ( c < m ? (u64)u[ c ] << shift : 0 ) | low;
+            }
+
+            for( u32 j = m - n + 1; j-- > 0; )
+            {
+                // estimate the quotient digit, it is at most two too large
+                const u64 top = ( (u64)u[ j + n ] << 32 ) | u[ j + n - 1 ];
+                u64 estimate = top / v[ n - 1 ];
+                u64 rest = top % v[ n - 1 ];
+
+                while( estimate >= Base or
+                       estimate * v[ n - 2 ] > ( ( rest << 32 ) | u[ j + n - 2 ] ) )
+                {
+                    estimate--;
+                    rest += v[ n - 1 ];
+                    if( rest >= Base )
+                    {
+                        break;
+                    }
+                }
+
+                // multiply and subtract, add back if the estimate was one too large
+                i64 borrow = 0;
+                u64 carry = 0;
+                for( u32 c = 0; c < n; c++ )
+                {
+                    const u64 product = estimate * v[ c ] + carry;
+                    carry = product >> 32;
+
+                    const i64 difference = (i64)u[ c + j ] - (i64)( product & 0xffffffff ) + borrow;
+                    u[ c + j ] = difference;
+                    borrow = difference >> 32;
+                }
+                const i64 difference = (i64)u[ j + n ] - (i64)carry + borrow;
+                u[ j + n ] = difference;
+
+                if( difference < 0 )
+                {
+                    estimate--;
+
+                    u64 sum = 0;
+                    for( u32 c = 0; c < n; c++ )
+                    {
+                        sum = (u64)u[ c + j ] + v[ c ] + ( sum >> 32 );
+                        u[ c + j ] = sum;
+                    }
+                    u[ j + n ] += sum >> 32;
+                }
+
+                w[ j ] = estimate;
+            }
+
+            // denormalize the remainder
+            for( u32 c = 0; c < n; c++ )
+            {
+                const u64 low = (u64)u[ c ] >> shift;
+                const u64 high = shift ? (u64)u[ c + 1 ] << ( 32 - shift ) : 0;
+                u[ c ] = low | high;
+            }
+            for( u32 c = n; c < Digits; c++ )
+            {
+                u[ c ] = 0;
+            }
+
+            for( u32 c = 0; c < size; c++ )
+            {
+                q.m_limbs[ c ] = ( (u64)w[ 2 * c + 1 ] << 32 ) | w[ 2 * c ];
+                r.m_limbs[ c ] = ( (u64)u[ 2 * c + 1 ] << 32 ) | u[ 2 * c ];
+            }
+        }
+    }
+
+    if( quotient )
+    {
+        *quotient = q;
+    }
+    if( remainder )
+    {
+        *remainder = r;
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,215 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_BIT_VALUE_H_
+#define _LIBCJEL_IR_BIT_VALUE_H_
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Type>
+
+#include <cassert>
+#include <initializer_list>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    fixed-capacity integer value of a bit type
+
+       Holds a value of 1 to 'BitType::SizeMax' bits in 'Limbs' inline 64-bit
+       limbs (least significant limb first) and never allocates. All bits
+       above the bit size are always zero, therefore the bitwise operators
+       and the comparisons run over all limbs without branches and can be
+       vectorized by the compiler. The arithmetic kernels have a fast path
+       for up to 64 bits and otherwise carry through the used limbs only.
+
+       The operators implement the semantics of the 'Interpreter': results
+       wrap at the bit size, 'adds' equals 'addu' in two's complement, 'divs'
+       truncates towards zero and the minimum value divided by '-1' is the
+       minimum value again. Both operands of a binary operator must have the
+       same bit size, a division by zero throws 'std::domain_error'.
+    */
+
+    class BitValue final
+    {
+      public:
+        static constexpr u32 LimbBits = 64;
+
+        static constexpr u32 Limbs = BitType::SizeMax / LimbBits;
+
+        BitValue( u16 bitsize = 1, u64 value = 0 );
+
+        /**
+           value of the given limbs (least significant limb first), bits
+           above the bit size are cut off
+        */
+
+        BitValue( u16 bitsize, std::initializer_list< u64 > limbs );
+
+        explicit BitValue( const BitConstant& constant );
+
+        inline u16 bitsize( void ) const
+        {
+            return m_bitsize;
+        }
+
+        /**
+           number of limbs used by the bit size
+        */
+
+        inline u32 size( void ) const
+        {
+            return ( m_bitsize + LimbBits - 1 ) / LimbBits;
+        }
+
+        inline u64 limb( u32 index ) const
+        {
+            assert( index < Limbs );
+            return m_limbs[ index ];
+        }
+
+        /**
+           least significant limb
+        */
+
+        inline u64 value( void ) const
+        {
+            return m_limbs[ 0 ];
+        }
+
+        /**
+           true if the value fits into the 64-bit payload of a 'BitConstant'
+        */
+
+        u1 fits( void ) const;
+
+        u1 sign( void ) const;
+
+        u1 isZero( void ) const;
+
+        BitValue addu( const BitValue& rhs ) const;
+
+        BitValue adds( const BitValue& rhs ) const;
+
+        BitValue divs( const BitValue& rhs ) const;
+
+        BitValue modu( const BitValue& rhs ) const;
+
+        BitValue operator&( const BitValue& rhs ) const;
+
+        BitValue operator|( const BitValue& rhs ) const;
+
+        BitValue operator^( const BitValue& rhs ) const;
+
+        BitValue operator~( void ) const;
+
+        /**
+           1-bit results of 'lnot', 'equ' and 'neq'
+        */
+
+        BitValue lnot( void ) const;
+
+        BitValue equ( const BitValue& rhs ) const;
+
+        BitValue neq( const BitValue& rhs ) const;
+
+        BitValue zext( u16 bitsize ) const;
+
+        BitValue trunc( u16 bitsize ) const;
+
+        /**
+           equal bit size and value
+        */
+
+        u1 operator==( const BitValue& rhs ) const;
+
+        u1 operator!=( const BitValue& rhs ) const;
+
+        std::string to_string( libstdhl::Type::Radix radix = libstdhl::Type::DECIMAL ) const;
+
+      private:
+        struct Unchecked
+        {
+        };
+
+        inline BitValue( u16 bitsize, Unchecked )
+        : m_limbs{}
+        , m_bitsize( bitsize )
+        {
+        }
+
+        /**
+           all ones in the limb 'index' of a 'bitsize' value
+        */
+
+        static inline u64 ones( u16 bitsize, u32 index )
+        {
+            const i32 rest = (i32)bitsize - (i32)( index * LimbBits );
+            return rest >= (i32)LimbBits ? ~( (u64)0 )
+                                         : rest <= 0 ? 0 : ( ( (u64)1 << rest ) - 1 );
+        }
+
+        void clear( void );
+
+        BitValue negate( void ) const;
+
+        static void divide(
+            const BitValue& dividend,
+            const BitValue& divisor,
+            BitValue* quotient,
+            BitValue* remainder );
+
+        u64 m_limbs[ Limbs ];
+
+        u16 m_bitsize;
+    };
+}
+
+#endif  // _LIBCJEL_IR_BIT_VALUE_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -44,6 +44,7 @@
 #include <libcjel-ir/Constant>
 #include <libcjel-ir/Function>
 #include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Module>
 #include <libcjel-ir/Scope>
 
 #include <libstdhl/Hash>
@@ -53,19 +54,17 @@
 
 using namespace libcjel_ir;
 
-u64 CallableUnit::m_allocation_cnt = 0;
+std::atomic< u64 > CallableUnit::m_allocation_cnt( 0 );
 
 CallableUnit::CallableUnit( const std::string& name, const Type::Ptr& type, Value::ID id )
 : User( name, type, id )
-, m_allocation_id( libstdhl::Memory::make< BitConstant >( 64, m_allocation_cnt ) )
+, m_allocation_id( m_allocation_cnt++ )
 {
     if( not type->isRelation() )
     {
         throw std::domain_error(
             "invalid type '" + type->name() + "' for intrinsic, requires 'RelationType'" );
     }
-
-    m_allocation_cnt++;
 }
 
 void CallableUnit::setContext( const Scope::Ptr& scope )
@@ -82,7 +81,7 @@ Scope::Ptr CallableUnit::context( void ) const
 
 BitConstant::Ptr CallableUnit::allocId( void ) const
 {
-    return m_allocation_id;
+    return libstdhl::Memory::make< BitConstant >( 64, m_allocation_id );
 }
 
 void CallableUnit::add( const Reference::Ptr& reference )
@@ -107,21 +106,42 @@ void CallableUnit::add( const Reference::Ptr& reference )
 
 Reference::Ptr CallableUnit::in( const std::string& name, const Type::Ptr& type )
 {
-    auto ref = libstdhl::Memory::make< Reference >( name, type, Reference::INPUT );
-    add( ref );
-    return ref;
+    return make( nullptr, name, type, Reference::INPUT );
 }
 
 Reference::Ptr CallableUnit::out( const std::string& name, const Type::Ptr& type )
 {
-    auto ref = libstdhl::Memory::make< Reference >( name, type, Reference::OUTPUT );
-    add( ref );
-    return ref;
+    return make( nullptr, name, type, Reference::OUTPUT );
 }
 
 Reference::Ptr CallableUnit::link( const std::string& name, const Type::Ptr& type )
 {
-    auto ref = libstdhl::Memory::make< Reference >( name, type, Reference::LINKAGE );
+    return make( nullptr, name, type, Reference::LINKAGE );
+}
+
+Reference::Ptr CallableUnit::in(
+    const Module& module, const std::string& name, const Type::Ptr& type )
+{
+    return make( &module, name, type, Reference::INPUT );
+}
+
+Reference::Ptr CallableUnit::out(
+    const Module& module, const std::string& name, const Type::Ptr& type )
+{
+    return make( &module, name, type, Reference::OUTPUT );
+}
+
+Reference::Ptr CallableUnit::link(
+    const Module& module, const std::string& name, const Type::Ptr& type )
+{
+    return make( &module, name, type, Reference::LINKAGE );
+}
+
+Reference::Ptr CallableUnit::make(
+    const Module* module, const std::string& name, const Type::Ptr& type, Reference::Kind kind )
+{
+    auto ref = module ? module->make< Reference >( name, type, kind )
+                      : libstdhl::Memory::make< Reference >( name, type, kind );
     add( ref );
     return ref;
 }
@@ -46,9 +46,12 @@
 
 #include <libcjel-ir/Reference>
 
+#include <atomic>
+
 namespace libcjel_ir
 {
     class BitConstant;
+    class Module;
     class Scope;
 
     class CallableUnit : public User
@@ -62,16 +65,33 @@ namespace libcjel_ir
 
         std::shared_ptr< Scope > context( void ) const;
 
+        /**
+           returns a new 64-bit constant of the allocation number, the
+           number is drawn at construction time
+        */
+
         std::shared_ptr< BitConstant > allocId( void ) const;
 
         void add( const Reference::Ptr& reference );
 
+        /**
+           creates and adds a reference, the overloads with a module create
+           it through 'Module::make', the others on the heap
+        */
+
         Reference::Ptr in( const std::string& name, const Type::Ptr& type );
 
         Reference::Ptr out( const std::string& name, const Type::Ptr& type );
 
         Reference::Ptr link( const std::string& name, const Type::Ptr& type );
 
+        Reference::Ptr in( const Module& module, const std::string& name, const Type::Ptr& type );
+
+        Reference::Ptr out( const Module& module, const std::string& name, const Type::Ptr& type );
+
+        Reference::Ptr link(
+            const Module& module, const std::string& name, const Type::Ptr& type );
+
         const std::vector< Reference::Ptr >& inputs( void ) const;
         const std::vector< Reference::Ptr >& outputs( void ) const;
         const std::vector< Reference::Ptr >& linkage( void ) const;
@@ -94,11 +114,16 @@ namespace libcjel_ir
         static bool classof( Value const* obj );
 
       private:
-        static u64 m_allocation_cnt;
+        Reference::Ptr make( const Module* module,
+            const std::string& name,
+            const Type::Ptr& type,
+            Reference::Kind kind );
+
+        static std::atomic< u64 > m_allocation_cnt;
 
         std::shared_ptr< Scope > m_context;
 
-        std::shared_ptr< BitConstant > m_allocation_id;
+        u64 m_allocation_id;
 
         std::vector< Reference::Ptr > m_references[ Reference::Kind::_SIZE_ ];
 
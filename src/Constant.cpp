@@ -42,8 +42,10 @@
 #include "Constant.h"
 
 #include <cassert>
+#include <libcjel-ir/Module>
 #include <libcjel-ir/Structure>
 #include <libcjel-ir/Type>
+#include <libstdhl/Hash>
 #include <libstdhl/Memory>
 #include <libstdhl/data/type/Integer>
 
@@ -70,23 +72,30 @@ Constant::Constant(
 
 std::size_t Constant::hash( void ) const
 {
+    // PPA: constants are stored by value inside of structure constants, the
+    // derived hash functions have to be called non-virtually to avoid a
+    // recursion on sliced objects
     switch( id() )
     {
         case Value::VOID_CONSTANT:
         {
-            return static_cast< const VoidConstant* >( this )->hash();
+            return static_cast< const VoidConstant* >( this )->VoidConstant::hash();
         }
         case Value::BIT_CONSTANT:
         {
-            return static_cast< const BitConstant* >( this )->hash();
+            return static_cast< const BitConstant* >( this )->BitConstant::hash();
         }
         case Value::STRING_CONSTANT:
         {
-            return static_cast< const StringConstant* >( this )->hash();
+            return static_cast< const StringConstant* >( this )->StringConstant::hash();
         }
         case Value::STRUCTURE_CONSTANT:
         {
-            return static_cast< const StructureConstant* >( this )->hash();
+            return static_cast< const StructureConstant* >( this )->StructureConstant::hash();
+        }
+        case Value::IDENTIFIER:
+        {
+            return static_cast< const Identifier* >( this )->Identifier::hash();
         }
         default:
         {
@@ -96,6 +105,30 @@ std::size_t Constant::hash( void ) const
     }
 }
 
+u1 Constant::equals( const Constant& rhs ) const
+{
+    if( this == &rhs )
+    {
+        return true;
+    }
+
+    if( id() != rhs.id() or type() != rhs.type() or m_data.value() != rhs.m_data.value() or
+        m_name != rhs.m_name or m_constants.size() != rhs.m_constants.size() )
+    {
+        return false;
+    }
+
+    for( std::size_t i = 0; i < m_constants.size(); i++ )
+    {
+        if( not m_constants[ i ].equals( rhs.m_constants[ i ] ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool Constant::classof( Value const* obj )
 {
     return obj->id() == classid() or VoidConstant::classof( obj ) or BitConstant::classof( obj ) or
@@ -144,7 +177,7 @@ BitConstant::BitConstant( const Type::Ptr& type, u64 value )
 }
 
 BitConstant::BitConstant( u16 bitsize, u64 value )
-: BitConstant( libstdhl::Memory::get< BitType >( bitsize ), value )
+: BitConstant( BitType::get( bitsize ), value )
 {
 }
 
@@ -160,8 +193,8 @@ const libstdhl::Type::Data& BitConstant::value( void ) const
 
 std::size_t BitConstant::hash( void ) const
 {
-    const auto h = ( (std::size_t)classid() ) << 1;
-    return h;
+    const auto h = libstdhl::Hash::combine( classid(), type().bitsize() );
+    return libstdhl::Hash::combine( h, std::hash< u64 >()( m_data.value() ) );
 }
 
 bool BitConstant::classof( Value const* obj )
@@ -185,8 +218,7 @@ std::string StringConstant::value( void ) const
 
 std::size_t StringConstant::hash( void ) const
 {
-    const auto h = ( (std::size_t)classid() ) << 1;
-    return h;
+    return libstdhl::Hash::combine( classid(), std::hash< std::string >()( m_name ) );
 }
 
 bool StringConstant::classof( Value const* obj )
@@ -231,14 +263,20 @@ StructureConstant::StructureConstant(
 {
 }
 
-std::vector< Constant > StructureConstant::value( void ) const
+const std::vector< Constant >& StructureConstant::value( void ) const
 {
     return m_constants;
 }
 
 std::size_t StructureConstant::hash( void ) const
 {
-    const auto h = ( (std::size_t)classid() ) << 1;
+    auto h = libstdhl::Hash::combine( classid(), type().hash() );
+
+    for( const auto& element : m_constants )
+    {
+        h = libstdhl::Hash::combine( h, element.hash() );
+    }
+
     return h;
 }
 
@@ -258,8 +296,8 @@ Identifier::Identifier( const Type::Ptr& type, const std::string& value )
 
 std::size_t Identifier::hash( void ) const
 {
-    const auto h = ( (std::size_t)classid() ) << 1;
-    return h;
+    const auto h = libstdhl::Hash::combine( classid(), type().hash() );
+    return libstdhl::Hash::combine( h, std::hash< std::string >()( m_name ) );
 }
 
 bool Identifier::classof( Value const* obj )
@@ -267,6 +305,128 @@ bool Identifier::classof( Value const* obj )
     return obj->id() == classid();
 }
 
+//
+// Constant Pool
+//
+
+ConstantPool::ConstantPool( const Module* module )
+: m_module( module )
+{
+}
+
+template < typename T, typename... Args >
+std::shared_ptr< T > ConstantPool::make( Args&&... args ) const
+{
+    if( m_module )
+    {
+        return m_module->make< T >( std::forward< Args >( args )... );
+    }
+
+    return libstdhl::Memory::make< T >( std::forward< Args >( args )... );
+}
+
+BitConstant::Ptr ConstantPool::bit( const Type::Ptr& type, u64 value )
+{
+    if( not type->isBit() )
+    {
+        throw std::domain_error( "invalid type '" + type->name() + "' for a bit constant" );
+    }
+
+    const BitKey key{ static_cast< u16 >( type->bitsize() ), value };
+
+    std::lock_guard< std::mutex > guard( m_lock );
+
+    auto result = m_bits.find( key );
+    if( result != m_bits.end() )
+    {
+        return result->second;
+    }
+
+    auto constant = make< BitConstant >( type, value );
+    m_bits.emplace( key, constant );
+    return constant;
+}
+
+BitConstant::Ptr ConstantPool::bit( u16 bitsize, u64 value )
+{
+    const BitKey key{ bitsize, value };
+
+    {
+        std::lock_guard< std::mutex > guard( m_lock );
+
+        auto result = m_bits.find( key );
+        if( result != m_bits.end() )
+        {
+            return result->second;
+        }
+    }
+
+    return bit( BitType::get( bitsize ), value );
+}
+
+StringConstant::Ptr ConstantPool::string( const std::string& value )
+{
+    std::lock_guard< std::mutex > guard( m_lock );
+
+    auto result = m_strings.find( value );
+    if( result != m_strings.end() )
+    {
+        return result->second;
+    }
+
+    auto constant = make< StringConstant >( value );
+    m_strings.emplace( value, constant );
+    return constant;
+}
+
+StructureConstant::Ptr ConstantPool::structure(
+    const Type::Ptr& type, const std::vector< Constant >& values )
+{
+    return std::static_pointer_cast< StructureConstant >(
+        intern( make< StructureConstant >( type, values ) ) );
+}
+
+Identifier::Ptr ConstantPool::identifier( const Type::Ptr& type, const std::string& value )
+{
+    return std::static_pointer_cast< Identifier >(
+        intern( make< Identifier >( type, value ) ) );
+}
+
+Constant::Ptr ConstantPool::get( const Constant::Ptr& constant )
+{
+    assert( constant );
+
+    if( isa< BitConstant >( constant ) )
+    {
+        const auto bc = std::static_pointer_cast< BitConstant >( constant );
+        const BitKey key{ static_cast< u16 >( bc->type().bitsize() ), bc->value().value() };
+
+        std::lock_guard< std::mutex > guard( m_lock );
+        return m_bits.emplace( key, bc ).first->second;
+    }
+    else if( isa< StringConstant >( constant ) )
+    {
+        const auto sc = std::static_pointer_cast< StringConstant >( constant );
+
+        std::lock_guard< std::mutex > guard( m_lock );
+        return m_strings.emplace( sc->value(), sc ).first->second;
+    }
+
+    return intern( constant );
+}
+
+std::size_t ConstantPool::size( void ) const
+{
+    std::lock_guard< std::mutex > guard( m_lock );
+    return m_bits.size() + m_strings.size() + m_constants.size();
+}
+
+Constant::Ptr ConstantPool::intern( const Constant::Ptr& constant )
+{
+    std::lock_guard< std::mutex > guard( m_lock );
+    return *m_constants.emplace( constant ).first;
+}
+
 //
 //  Local variables:
 //  mode: c++
@@ -45,8 +45,11 @@
 #include <libcjel-ir/Value>
 #include <libstdhl/data/type/Data>
 
+#include <mutex>
+
 namespace libcjel_ir
 {
+    class Module;
     class Structure;
 
     class Constant : public Value
@@ -63,6 +66,14 @@ namespace libcjel_ir
 
         std::size_t hash( void ) const override;
 
+        /**
+           structural equality of kind, type and payload (data words, string
+           bytes and element list), in contrast to 'operator==' which only
+           compares the hash and the type
+        */
+
+        u1 equals( const Constant& rhs ) const;
+
         static inline Value::ID classid( void )
         {
             return Value::CONSTANT;
@@ -76,7 +87,7 @@ namespace libcjel_ir
         std::vector< Constant > m_constants;
 
       public:
-        std::unordered_map< std::size_t, Constant::Ptr >& cache( void )
+        static std::unordered_map< std::size_t, Constant::Ptr >& cache( void )
         {
             static std::unordered_map< std::size_t, Constant::Ptr > s_cache;
             return s_cache;
@@ -152,7 +163,7 @@ namespace libcjel_ir
         StructureConstant(
             const std::shared_ptr< Structure >& kind, const std::vector< Constant >& values );
 
-        std::vector< Constant > value( void ) const;
+        const std::vector< Constant >& value( void ) const;
 
         std::size_t hash( void ) const override;
 
@@ -180,6 +191,95 @@ namespace libcjel_ir
 
         static bool classof( Value const* obj );
     };
+
+    /**
+       @brief    hash-consing pool for constants
+
+       Every structurally distinct constant exists exactly once per pool,
+       therefore two constants obtained from the same pool are equal if and
+       only if their pointers are equal. Bit and string constants are looked
+       up directly by their payload, all other constants by their structural
+       hash. The lookups of a pool are locked, but the use lists of its
+       constants are not, so threads which add or remove uses of pooled
+       constants concurrently need a pool each.
+
+       A pool bound to a module creates its constants through 'Module::make',
+       e.g. in the module arena. The module shall outlive the pool.
+    */
+
+    class ConstantPool
+    {
+      public:
+        using Ptr = std::shared_ptr< ConstantPool >;
+
+        explicit ConstantPool( const Module* module = nullptr );
+
+        BitConstant::Ptr bit( const Type::Ptr& type, u64 value );
+
+        BitConstant::Ptr bit( u16 bitsize, u64 value );
+
+        StringConstant::Ptr string( const std::string& value );
+
+        StructureConstant::Ptr structure(
+            const Type::Ptr& type, const std::vector< Constant >& values );
+
+        Identifier::Ptr identifier( const Type::Ptr& type, const std::string& value );
+
+        Constant::Ptr get( const Constant::Ptr& constant );
+
+        std::size_t size( void ) const;
+
+      private:
+        template < typename T, typename... Args >
+        std::shared_ptr< T > make( Args&&... args ) const;
+
+        Constant::Ptr intern( const Constant::Ptr& constant );
+
+        struct BitKey
+        {
+            u16 bitsize;
+            u64 value;
+
+            inline u1 operator==( const BitKey& rhs ) const
+            {
+                return bitsize == rhs.bitsize and value == rhs.value;
+            }
+        };
+
+        struct BitKeyHash
+        {
+            inline std::size_t operator()( const BitKey& key ) const
+            {
+                return std::hash< u64 >()( key.value ) ^ ( (std::size_t)key.bitsize << 48 );
+            }
+        };
+
+        struct ConstantHash
+        {
+            inline std::size_t operator()( const Constant::Ptr& constant ) const
+            {
+                return constant->hash();
+            }
+        };
+
+        struct ConstantEqual
+        {
+            inline u1 operator()( const Constant::Ptr& lhs, const Constant::Ptr& rhs ) const
+            {
+                return lhs->equals( *rhs );
+            }
+        };
+
+        const Module* m_module;
+
+        mutable std::mutex m_lock;
+
+        std::unordered_map< BitKey, BitConstant::Ptr, BitKeyHash > m_bits;
+
+        std::unordered_map< std::string, StringConstant::Ptr > m_strings;
+
+        std::unordered_set< Constant::Ptr, ConstantHash, ConstantEqual > m_constants;
+    };
 }
 
 #endif  // _LIBCJEL_IR_CONSTANT_H_
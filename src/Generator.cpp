@@ -0,0 +1,989 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Generator.h"
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Type>
+#include <libcjel-ir/Variable>
+
+#include <libstdhl/Memory>
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <unordered_map>
+
+using namespace libcjel_ir;
+
+namespace
+{
+    /**
+       xorshift64* generator, unlike the standard distributions its results
+       are the same on every platform
+    */
+
+    class Random
+    {
+      public:
+        explicit Random( u64 seed )
+        : m_state( ( seed ^ 0x9e3779b97f4a7c15 ) * 0xbf58476d1ce4e5b9 )
+        {
+            if( m_state == 0 )
+            {
+                m_state = 0x9e3779b97f4a7c15;
+            }
+        }
+
+        u64 next( void )
+        {
+            m_state ^= m_state >> 12;
+            m_state ^= m_state << 25;
+            m_state ^= m_state >> 27;
+            return m_state * 0x2545f4914f6cdd1d;
+        }
+
+        u64 below( u64 bound )
+        {
+            assert( bound > 0 );
+            return next() % bound;
+        }
+
+        u1 chance( double probability )
+        {
+            return ( next() >> 11 ) * ( 1.0 / 9007199254740992.0 ) < probability;
+        }
+
+      private:
+        u64 m_state;
+    };
+
+    template < typename T >
+    class Weighted
+    {
+      public:
+        explicit Weighted( const std::vector< std::pair< T, u32 > >& weights )
+        : m_total( 0 )
+        {
+            for( const auto& weight : weights )
+            {
+                if( weight.second == 0 )
+                {
+                    continue;
+                }
+
+                m_total += weight.second;
+                m_values.emplace_back( weight.first, m_total );
+            }
+        }
+
+        T pick( Random& random ) const
+        {
+            const auto mark = random.below( m_total );
+
+            for( const auto& value : m_values )
+            {
+                if( mark < value.second )
+                {
+                    return value.first;
+                }
+            }
+
+            return m_values.back().first;
+        }
+
+      private:
+        std::vector< std::pair< T, u64 > > m_values;
+        u64 m_total;
+    };
+
+    static u64 mask( u16 bitsize )
+    {
+        return bitsize >= 64 ? ~( (u64)0 ) : ( ( (u64)1 << bitsize ) - 1 );
+    }
+}
+
+//
+//
+// Builder
+//
+
+class Generator::Builder
+{
+  public:
+    Builder( const Options& options )
+    : m_options( options )
+    , m_random( options.seed )
+    , m_mix( options.mix )
+    , m_widths( options.widths )
+    , m_module( libstdhl::Memory::make< Module >( "generated", options.module ) )
+    , m_constants( m_module.get() )
+    {
+    }
+
+    Module::Ptr run( void )
+    {
+        for( u32 c = 0; c < m_options.structures; c++ )
+        {
+            structure( c );
+        }
+
+        for( u32 c = 0; c < m_options.functions; c++ )
+        {
+            const u64 budget = m_options.instructions / m_options.functions +
+                               ( c < m_options.instructions % m_options.functions ? 1 : 0 );
+            function( c, budget );
+        }
+
+        return m_module;
+    }
+
+  private:
+    /**
+       globals and leaf functions of one width
+    */
+
+    struct Globals
+    {
+        std::vector< Value::Ptr > variables;
+        std::vector< Value::Ptr > memories;
+        std::vector< Value::Ptr > leaves;
+    };
+
+    /**
+       locations a block may access besides the bit inputs and the
+       allocations of its statements, the blocks of a parallel scope own
+       disjoint locations and calls require all globals of the width
+    */
+
+    struct Owned
+    {
+        std::vector< Value::Ptr > scalars;
+        std::vector< Value::Ptr > memories;
+        std::vector< u64 > elements;
+        u1 calls;
+    };
+
+    /**
+       state of the function and the statement under construction
+    */
+
+    struct Frame
+    {
+        Type::Ptr type;
+        u16 bitsize;
+        u1 leaf;
+        Globals* globals;
+        std::vector< Value::Ptr > inputs;
+        Value::Ptr output;
+        Value::Ptr structure;
+
+        const Owned* owned;
+        Statement* statement;
+        u64 budget;
+        std::vector< Value::Ptr > values;
+        std::vector< Value::Ptr > allocations;
+    };
+
+    void structure( u32 index )
+    {
+        std::vector< StructureElement > elements;
+
+        const auto size = 2 + m_random.below( 3 );
+        for( u32 c = 0; c < size; c++ )
+        {
+            elements.emplace_back( BitType::get( m_widths.pick( m_random ) ),
+                "e" + std::to_string( c ) );
+        }
+
+        auto kind = m_module->make< Structure >( "S" + std::to_string( index ), elements );
+        m_structures.emplace_back( libstdhl::Memory::make< StructureType >( kind ) );
+        m_module->add( kind );
+    }
+
+    Globals& globals( u16 bitsize )
+    {
+        auto result = m_globals.find( bitsize );
+        if( result != m_globals.end() )
+        {
+            return result->second;
+        }
+
+        auto& globals = m_globals[ bitsize ];
+        const auto& type = BitType::get( bitsize );
+        const auto suffix = std::to_string( bitsize ) + "_";
+
+        for( u32 c = 0; c < m_options.variables; c++ )
+        {
+            auto variable = m_module->make< Variable >(
+                type, constant( type ), "v" + suffix + std::to_string( c ) );
+            globals.variables.emplace_back( variable );
+            m_module->add( variable );
+        }
+
+        for( u32 c = 0; c < m_options.memories; c++ )
+        {
+            auto memory = m_module->make< Memory >(
+                "m" + suffix + std::to_string( c ), type, m_options.length );
+            globals.memories.emplace_back( memory );
+            m_module->add( memory );
+        }
+
+        return globals;
+    }
+
+    void function( u32 index, u64 budget )
+    {
+        Frame frame;
+        frame.bitsize = m_widths.pick( m_random );
+        frame.type = BitType::get( frame.bitsize );
+        frame.leaf = m_random.chance( m_options.leaves );
+        frame.globals = &globals( frame.bitsize );
+        frame.owned = nullptr;
+        frame.statement = nullptr;
+        frame.budget = 0;
+
+        std::vector< StructureElement > inputs = { { frame.type, "a" }, { frame.type, "b" } };
+        if( not frame.leaf and not m_structures.empty() )
+        {
+            inputs.emplace_back( m_structures[ m_random.below( m_structures.size() ) ], "s" );
+        }
+
+        std::vector< Type::Ptr > arguments;
+        for( const auto& input : inputs )
+        {
+            arguments.emplace_back( std::get< 0 >( input ) );
+        }
+
+        const auto relation = libstdhl::Memory::make< RelationType >(
+            std::vector< Type::Ptr >{ frame.type }, arguments );
+
+        std::shared_ptr< Function > object =
+            m_module->make< Function >( "f" + std::to_string( index ), relation );
+
+        for( const auto& input : inputs )
+        {
+            auto reference = m_module->make< Reference >(
+                std::get< 1 >( input ), std::get< 0 >( input ), Reference::INPUT );
+            reference->setCallable( object );
+            object->add( reference );
+
+            if( reference->type().isStructure() )
+            {
+                frame.structure = reference;
+            }
+            else
+            {
+                frame.inputs.emplace_back( reference );
+            }
+        }
+
+        auto output = m_module->make< Reference >( "r", frame.type, Reference::OUTPUT );
+        output->setCallable( object );
+        object->add( output );
+        frame.output = output;
+
+        Owned owned;
+        owned.scalars.emplace_back( output );
+        owned.scalars.insert( owned.scalars.end(), frame.globals->variables.begin(),
+            frame.globals->variables.end() );
+        owned.memories = frame.globals->memories;
+        if( frame.structure )
+        {
+            for( u64 c = 0; c < frame.structure->type().results().size(); c++ )
+            {
+                owned.elements.emplace_back( c );
+            }
+        }
+        owned.calls = true;
+
+        auto context = m_module->make< SequentialScope >();
+        scope( frame, context, 0, budget, owned );
+        object->setContext( context );
+
+        if( frame.leaf )
+        {
+            frame.globals->leaves.emplace_back( object );
+        }
+
+        m_module->add( object );
+    }
+
+    /**
+       fills a scope with 'budget' instructions, inner scopes are split into
+       'blocks' nested scopes and the innermost scopes hold the statements,
+       the blocks of a parallel scope split the 'owned' locations
+    */
+
+    void scope(
+        Frame& frame, const Scope::Ptr& scope, u32 depth, u64 budget, const Owned& owned )
+    {
+        const u1 parallel = isa< ParallelScope >( scope );
+
+        if( depth < m_options.depth and budget > m_options.statement )
+        {
+            const u64 part = ( budget + m_options.blocks - 1 ) / m_options.blocks;
+            const auto shares = split( owned, parallel ? ( budget + part - 1 ) / part : 1 );
+
+            for( u32 c = 0; budget > 0; c++ )
+            {
+                const auto size = std::min( part, budget );
+                budget -= size;
+
+                Scope::Ptr child;
+                if( m_random.chance( m_options.parallel ) )
+                {
+                    child = m_module->make< ParallelScope >();
+                }
+                else
+                {
+                    child = m_module->make< SequentialScope >();
+                }
+
+                this->scope( frame, child, depth + 1, size, shares[ parallel ? c : 0 ] );
+                child->setParent( scope );
+                scope->add( child );
+            }
+            return;
+        }
+
+        std::vector< u64 > sizes;
+        while( budget > 0 )
+        {
+            sizes.emplace_back(
+                std::min( 1 + m_random.below( 2 * m_options.statement - 1 ), budget ) );
+            budget -= sizes.back();
+        }
+
+        const auto shares = split( owned, parallel ? sizes.size() : 1 );
+
+        for( u32 c = 0; c < sizes.size(); c++ )
+        {
+            auto child = m_module->make< TrivialStatement >();
+            statement( frame, *child, sizes[ c ], shares[ parallel ? c : 0 ] );
+            child->setParent( scope );
+            scope->add( child );
+        }
+    }
+
+    /**
+       deals the locations of 'owned' round-robin to 'count' blocks, only a
+       single block keeps the calls
+    */
+
+    static std::vector< Owned > split( const Owned& owned, u64 count )
+    {
+        if( count <= 1 )
+        {
+            return { owned };
+        }
+
+        std::vector< Owned > result( count );
+        u64 next = 0;
+        for( const auto& scalar : owned.scalars )
+        {
+            result[ next++ % count ].scalars.emplace_back( scalar );
+        }
+        for( const auto& memory : owned.memories )
+        {
+            result[ next++ % count ].memories.emplace_back( memory );
+        }
+        for( const auto element : owned.elements )
+        {
+            result[ next++ % count ].elements.emplace_back( element );
+        }
+        for( auto& share : result )
+        {
+            share.calls = false;
+        }
+        return result;
+    }
+
+    /**
+       emits exactly 'budget' instructions, the last one stores a value or
+       is a 'nop' if there is no location to store to
+    */
+
+    void statement( Frame& frame, Statement& statement, u64 budget, const Owned& owned )
+    {
+        frame.owned = &owned;
+        frame.statement = &statement;
+        frame.budget = budget;
+        frame.values.clear();
+        frame.allocations.clear();
+
+        // without an own scalar the statement stores to an allocation
+        if( owned.scalars.empty() )
+        {
+            if( budget == 1 )
+            {
+                add( frame, m_module->make< NopInstruction >() );
+                return;
+            }
+            frame.allocations.emplace_back(
+                add( frame, m_module->make< AllocInstruction >( frame.type ) ) );
+        }
+
+        while( frame.budget > 1 )
+        {
+            instruction( frame, m_mix.pick( m_random ) );
+        }
+
+        add( frame, m_module->make< StoreInstruction >( operand( frame ), writable( frame ) ) );
+    }
+
+    void instruction( Frame& frame, Value::ID kind )
+    {
+        // one instruction is reserved for the final store
+        const auto available = frame.budget - 1;
+        const auto& t = frame.type;
+
+        switch( kind )
+        {
+            case Value::NOP_INSTRUCTION:
+            {
+                add( frame, m_module->make< NopInstruction >() );
+                break;
+            }
+            case Value::ALLOC_INSTRUCTION:
+            {
+                frame.allocations.emplace_back(
+                    add( frame, m_module->make< AllocInstruction >( t ) ) );
+                break;
+            }
+            case Value::STORE_INSTRUCTION:
+            {
+                add( frame,
+                    m_module->make< StoreInstruction >( operand( frame ), writable( frame ) ) );
+                break;
+            }
+            case Value::EXTRACT_INSTRUCTION:
+            {
+                extract( frame, available );
+                break;
+            }
+            case Value::CALL_INSTRUCTION:
+            {
+                const auto& leaves = frame.globals->leaves;
+                if( frame.leaf or leaves.empty() or not frame.owned->calls )
+                {
+                    load( frame );
+                    break;
+                }
+
+                const auto& callee = leaves[ m_random.below( leaves.size() ) ];
+                std::vector< Value::Ptr > arguments;
+                for( u32 c = 0; c < callee->type().arguments().size(); c++ )
+                {
+                    arguments.emplace_back( operand( frame ) );
+                }
+
+                frame.values.emplace_back(
+                    add( frame, m_module->make< CallInstruction >( callee, arguments ) ) );
+                break;
+            }
+            case Value::ZEXT_INSTRUCTION:  // fall-through
+            case Value::TRUNC_INSTRUCTION:
+            {
+                if( frame.bitsize == 1 or available < 2 )
+                {
+                    unary< NotInstruction >( frame );
+                    break;
+                }
+
+                const auto& narrow = BitType::get( 1 + m_random.below( frame.bitsize - 1 ) );
+                auto truncation = add(
+                    frame, m_module->make< TruncationInstruction >( operand( frame ), narrow ) );
+                frame.values.emplace_back(
+                    add( frame, m_module->make< ZeroExtendInstruction >( truncation, t ) ) );
+                break;
+            }
+            case Value::NOT_INSTRUCTION:
+            {
+                unary< NotInstruction >( frame );
+                break;
+            }
+            case Value::LNOT_INSTRUCTION:
+            {
+                if( frame.bitsize == 1 )
+                {
+                    unary< LnotInstruction >( frame );
+                    break;
+                }
+
+                if( available < 3 )
+                {
+                    unary< NotInstruction >( frame );
+                    break;
+                }
+
+                auto condition = add(
+                    frame, m_module->make< EquInstruction >( operand( frame ), operand( frame ) ) );
+                auto negation = add( frame, m_module->make< LnotInstruction >( condition ) );
+                frame.values.emplace_back(
+                    add( frame, m_module->make< ZeroExtendInstruction >( negation, t ) ) );
+                break;
+            }
+            case Value::AND_INSTRUCTION:
+            {
+                binary< AndInstruction >( frame, operand( frame ) );
+                break;
+            }
+            case Value::OR_INSTRUCTION:
+            {
+                binary< OrInstruction >( frame, operand( frame ) );
+                break;
+            }
+            case Value::XOR_INSTRUCTION:
+            {
+                binary< XorInstruction >( frame, operand( frame ) );
+                break;
+            }
+            case Value::ADDU_INSTRUCTION:
+            {
+                binary< AddUnsignedInstruction >( frame, operand( frame ) );
+                break;
+            }
+            case Value::ADDS_INSTRUCTION:
+            {
+                binary< AddSignedInstruction >( frame, operand( frame ) );
+                break;
+            }
+            case Value::DIVS_INSTRUCTION:
+            {
+                binary< DivSignedInstruction >( frame, divisor( frame, available ) );
+                break;
+            }
+            case Value::MODU_INSTRUCTION:
+            {
+                binary< ModUnsignedInstruction >( frame, divisor( frame, available ) );
+                break;
+            }
+            case Value::EQU_INSTRUCTION:
+            {
+                compare< EquInstruction >( frame, available );
+                break;
+            }
+            case Value::NEQ_INSTRUCTION:
+            {
+                compare< NeqInstruction >( frame, available );
+                break;
+            }
+            default:
+            {
+                load( frame );
+                break;
+            }
+        }
+    }
+
+    void load( Frame& frame )
+    {
+        frame.values.emplace_back(
+            add( frame, m_module->make< LoadInstruction >( readable( frame ) ) ) );
+    }
+
+    template < typename T >
+    void unary( Frame& frame )
+    {
+        frame.values.emplace_back( add( frame, m_module->make< T >( operand( frame ) ) ) );
+    }
+
+    template < typename T >
+    void binary( Frame& frame, const Value::Ptr& rhs )
+    {
+        frame.values.emplace_back( add( frame, m_module->make< T >( operand( frame ), rhs ) ) );
+    }
+
+    template < typename T >
+    void compare( Frame& frame, u64 available )
+    {
+        if( frame.bitsize > 1 and available < 2 )
+        {
+            binary< XorInstruction >( frame, operand( frame ) );
+            return;
+        }
+
+        auto condition = add( frame, m_module->make< T >( operand( frame ), operand( frame ) ) );
+
+        if( frame.bitsize > 1 )
+        {
+            condition =
+                add( frame, m_module->make< ZeroExtendInstruction >( condition, frame.type ) );
+        }
+
+        frame.values.emplace_back( condition );
+    }
+
+    /**
+       returns a non-zero constant or a value with its lowest bit set
+    */
+
+    Value::Ptr divisor( Frame& frame, u64 available )
+    {
+        if( available < 2 or frame.values.empty() or m_random.chance( 0.5 ) )
+        {
+            const auto limit =
+                frame.bitsize > 1 ? mask( std::min< u16 >( frame.bitsize - 1, 16 ) ) : 1;
+            return m_constants.bit( frame.type, 1 + m_random.below( limit ) );
+        }
+
+        return add( frame, m_module->make< OrInstruction >( pick( frame.values ),
+                               m_constants.bit( frame.type, 1 ) ) );
+    }
+
+    /**
+       loads from or stores to a memory element or a structure element, the
+       width of a structure element is adapted to the function width
+    */
+
+    void extract( Frame& frame, u64 available )
+    {
+        const auto& memories = frame.owned->memories;
+        const auto& elements = frame.owned->elements;
+        const u1 memory = not memories.empty() and ( elements.empty() or m_random.chance( 0.5 ) );
+
+        if( available < 2 or not( memory or not elements.empty() ) )
+        {
+            load( frame );
+            return;
+        }
+
+        const u1 store = m_random.chance( 0.5 );
+
+        if( memory )
+        {
+            const auto& object = pick( memories );
+            const u1 dynamic = available >= 3 and not frame.values.empty() and
+                               frame.bitsize <= 64 and m_options.length <= mask( frame.bitsize ) and
+                               m_random.chance( 0.5 );
+
+            Value::Ptr index;
+            if( dynamic )
+            {
+                index = add( frame, m_module->make< ModUnsignedInstruction >( pick( frame.values ),
+                                        m_constants.bit( frame.type, m_options.length ) ) );
+            }
+            else
+            {
+                index = m_constants.bit( 64, m_random.below( m_options.length ) );
+            }
+
+            auto element = add( frame, m_module->make< ExtractInstruction >( object, index ) );
+
+            if( store )
+            {
+                add( frame, m_module->make< StoreInstruction >( operand( frame ), element ) );
+            }
+            else
+            {
+                frame.values.emplace_back(
+                    add( frame, m_module->make< LoadInstruction >( element ) ) );
+            }
+            return;
+        }
+
+        const auto index = elements[ m_random.below( elements.size() ) ];
+        const auto& type = frame.structure->type().results()[ index ];
+        const auto bitsize = type->bitsize();
+
+        if( bitsize != frame.bitsize and available < 3 )
+        {
+            load( frame );
+            return;
+        }
+
+        auto element = add( frame,
+            m_module->make< ExtractInstruction >( frame.structure, m_constants.bit( 64, index ) ) );
+
+        if( store )
+        {
+            Value::Ptr value = operand( frame );
+            if( bitsize < frame.bitsize )
+            {
+                value = add( frame, m_module->make< TruncationInstruction >( value, type ) );
+            }
+            else if( bitsize > frame.bitsize )
+            {
+                value = add( frame, m_module->make< ZeroExtendInstruction >( value, type ) );
+            }
+
+            add( frame, m_module->make< StoreInstruction >( value, element ) );
+            return;
+        }
+
+        Value::Ptr value = add( frame, m_module->make< LoadInstruction >( element ) );
+        if( bitsize < frame.bitsize )
+        {
+            value = add( frame, m_module->make< ZeroExtendInstruction >( value, frame.type ) );
+        }
+        else if( bitsize > frame.bitsize )
+        {
+            value = add( frame, m_module->make< TruncationInstruction >( value, frame.type ) );
+        }
+
+        frame.values.emplace_back( value );
+    }
+
+    /**
+       returns a value of the statement or a constant of the function width
+    */
+
+    Value::Ptr operand( Frame& frame )
+    {
+        if( not frame.values.empty() and m_random.chance( 0.75 ) )
+        {
+            return pick( frame.values );
+        }
+
+        return constant( frame.type );
+    }
+
+    Value::Ptr readable( Frame& frame )
+    {
+        const auto& scalars = frame.owned->scalars;
+        auto index =
+            m_random.below( frame.inputs.size() + scalars.size() + frame.allocations.size() );
+
+        if( index < frame.inputs.size() )
+        {
+            return frame.inputs[ index ];
+        }
+        index -= frame.inputs.size();
+
+        if( index < scalars.size() )
+        {
+            return scalars[ index ];
+        }
+        index -= scalars.size();
+
+        return frame.allocations[ index ];
+    }
+
+    Value::Ptr writable( Frame& frame )
+    {
+        const auto& scalars = frame.owned->scalars;
+        auto index = m_random.below( scalars.size() + frame.allocations.size() );
+
+        if( index < scalars.size() )
+        {
+            return scalars[ index ];
+        }
+        index -= scalars.size();
+
+        return frame.allocations[ index ];
+    }
+
+    /**
+       mostly small constants like in generated code, they are shared by the
+       constant pool
+    */
+
+    Value::Ptr constant( const Type::Ptr& type )
+    {
+        const auto bitsize = type->bitsize();
+
+        if( m_random.chance( 0.125 ) )
+        {
+            return m_constants.bit( type, m_random.next() & mask( bitsize ) );
+        }
+
+        const auto value = m_random.below( SMALL ) & mask( bitsize );
+
+        auto& small = m_small[ bitsize ];
+        if( small.empty() )
+        {
+            small.resize( SMALL );
+        }
+
+        if( not small[ value ] )
+        {
+            small[ value ] = m_constants.bit( type, value );
+        }
+
+        return small[ value ];
+    }
+
+    const Value::Ptr& pick( const std::vector< Value::Ptr >& values )
+    {
+        return values[ m_random.below( values.size() ) ];
+    }
+
+    Value::Ptr add( Frame& frame, const Instruction::Ptr& instruction )
+    {
+        assert( frame.budget > 0 );
+        frame.statement->add( instruction );
+        frame.budget--;
+        return instruction;
+    }
+
+    const Options& m_options;
+
+    Random m_random;
+
+    Weighted< Value::ID > m_mix;
+
+    Weighted< u16 > m_widths;
+
+    Module::Ptr m_module;
+
+    ConstantPool m_constants;
+
+    std::vector< Type::Ptr > m_structures;
+
+    std::map< u16, Globals > m_globals;
+
+    // constants below 'SMALL' per bit size, saves the pool lookups
+    static constexpr u64 SMALL = 256;
+    std::unordered_map< u16, std::vector< Value::Ptr > > m_small;
+};
+
+constexpr u64 Generator::Builder::SMALL;
+
+//
+//
+// Generator
+//
+
+Generator::Generator( const Options& options )
+: m_options( options )
+{
+    if( options.instructions > 0 and options.functions == 0 )
+    {
+        throw std::domain_error( "generator requires at least one function" );
+    }
+
+    if( options.blocks == 0 or options.statement == 0 or options.length == 0 )
+    {
+        throw std::domain_error( "generator requires non-zero blocks, statement and length" );
+    }
+
+    if( options.parallel < 0.0 or options.parallel > 1.0 or options.leaves < 0.0 or
+        options.leaves > 1.0 )
+    {
+        throw std::domain_error( "generator shares have to be in the range [0, 1]" );
+    }
+
+    u64 total = 0;
+    for( const auto& weight : options.mix )
+    {
+        switch( weight.first )
+        {
+            case Value::NOP_INSTRUCTION:  // fall-through
+            case Value::ALLOC_INSTRUCTION:
+            case Value::LOAD_INSTRUCTION:
+            case Value::STORE_INSTRUCTION:
+            case Value::EXTRACT_INSTRUCTION:
+            case Value::CALL_INSTRUCTION:
+            case Value::ZEXT_INSTRUCTION:
+            case Value::TRUNC_INSTRUCTION:
+            case Value::NOT_INSTRUCTION:
+            case Value::LNOT_INSTRUCTION:
+            case Value::AND_INSTRUCTION:
+            case Value::OR_INSTRUCTION:
+            case Value::XOR_INSTRUCTION:
+            case Value::ADDU_INSTRUCTION:
+            case Value::ADDS_INSTRUCTION:
+            case Value::DIVS_INSTRUCTION:
+            case Value::MODU_INSTRUCTION:
+            case Value::EQU_INSTRUCTION:
+            case Value::NEQ_INSTRUCTION:
+            {
+                total += weight.second;
+                break;
+            }
+            default:
+            {
+                throw std::domain_error( "generator does not support value kind '" +
+                                         std::to_string( weight.first ) + "'" );
+            }
+        }
+    }
+
+    if( total == 0 )
+    {
+        throw std::domain_error( "generator requires an instruction mix" );
+    }
+
+    total = 0;
+    for( const auto& weight : options.widths )
+    {
+        if( weight.first < 1 or weight.first > BitType::SizeMax )
+        {
+            throw std::domain_error(
+                "invalid bit size '" + std::to_string( weight.first ) + "' for the generator" );
+        }
+        total += weight.second;
+    }
+
+    if( total == 0 )
+    {
+        throw std::domain_error( "generator requires a width distribution" );
+    }
+}
+
+Module::Ptr Generator::generate( void ) const
+{
+    Builder builder( m_options );
+    return builder.run();
+}
+
+const Generator::Options& Generator::options( void ) const
+{
+    return m_options;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,178 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_GENERATOR_H_
+#define _LIBCJEL_IR_GENERATOR_H_
+
+#include <libcjel-ir/Module>
+
+#include <utility>
+#include <vector>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    seeded generator of synthetic modules
+
+       Builds a module with exactly 'instructions' instructions spread evenly
+       over 'functions' functions, the same options (seed included) always
+       produce the same module on every platform. A function of width 'N'
+       has the signature '( uN a, uN b [, S s ] ) -> ( uN r )', its context
+       is a sequential scope with nested sequential and parallel scopes up to
+       'depth' levels below it and every nested scope holds up to 'blocks'
+       blocks. Statements are trivial statements of about 'statement'
+       instructions which load from the inputs, variables, memories and
+       structure elements, compute with the instruction 'mix' and store to
+       the output, variables, memories or allocations.
+
+       The generated module is valid by construction:
+
+       - every operand is defined earlier in the same statement and the
+         operands of binary instructions have the same type
+       - calls only target leaf functions (no calls, bit inputs only)
+         generated before of the same width, therefore the call graph is
+         acyclic and the work of a call is bounded
+       - memory indices are constants or 'modu' results within the length
+       - the divisor of 'divs' and 'modu' is never zero
+       - the blocks of a parallel scope are independent, the output, the
+         variables, the memories and the structure elements are dealt
+         round-robin to the blocks and a block only accesses the bit inputs,
+         its own locations and the allocations of its statements, a block
+         without an own scalar stores to an allocation
+       - calls are only generated outside of parallel scopes, a leaf
+         function accesses the variables and memories of its width
+
+       With widths of up to 64 bits the module is accepted by the
+       'Interpreter' and all backends, 'divs' and 'modu' of wider types are
+       not supported by the C11 backend. The result of a function does not
+       depend on the order of the blocks of its parallel scopes.
+    */
+
+    class Generator final
+    {
+      public:
+        struct Options
+        {
+            u64 seed = 0;
+
+            u64 instructions = 1000;
+
+            u32 functions = 1;
+
+            // nesting depth of scopes below the function scope
+            u32 depth = 2;
+
+            // blocks per nested scope
+            u32 blocks = 4;
+
+            // average instructions per statement
+            u32 statement = 4;
+
+            // share of parallel scopes of all nested scopes
+            double parallel = 0.5;
+
+            // instruction kinds and their relative weights, supported are
+            // nop, alloc, load, store, extract, call, zext, trunc, not,
+            // lnot, and, or, xor, addu, adds, divs, modu, equ and neq
+            std::vector< std::pair< Value::ID, u32 > > mix = {
+                { Value::LOAD_INSTRUCTION, 4 },
+                { Value::STORE_INSTRUCTION, 2 },
+                { Value::EXTRACT_INSTRUCTION, 2 },
+                { Value::ALLOC_INSTRUCTION, 1 },
+                { Value::CALL_INSTRUCTION, 1 },
+                { Value::ZEXT_INSTRUCTION, 1 },
+                { Value::TRUNC_INSTRUCTION, 1 },
+                { Value::NOT_INSTRUCTION, 1 },
+                { Value::AND_INSTRUCTION, 1 },
+                { Value::OR_INSTRUCTION, 1 },
+                { Value::XOR_INSTRUCTION, 1 },
+                { Value::ADDU_INSTRUCTION, 4 },
+                { Value::ADDS_INSTRUCTION, 1 },
+                { Value::DIVS_INSTRUCTION, 1 },
+                { Value::MODU_INSTRUCTION, 1 },
+                { Value::EQU_INSTRUCTION, 1 },
+                { Value::NEQ_INSTRUCTION, 1 },
+            };
+
+            // bit sizes of the functions and their relative weights
+            std::vector< std::pair< u16, u32 > > widths = {
+                { 8, 1 }, { 16, 1 }, { 32, 4 }, { 64, 2 },
+            };
+
+            // variables and memories per used width
+            u32 variables = 2;
+            u32 memories = 1;
+            u32 length = 16;
+
+            // structure types, non-leaf functions have a structure input
+            u32 structures = 2;
+
+            // share of leaf functions
+            double leaves = 0.25;
+
+            // options of the generated module
+            u8 module = Module::ARENA;
+        };
+
+        explicit Generator( const Options& options );
+
+        Module::Ptr generate( void ) const;
+
+        const Options& options( void ) const;
+
+      private:
+        class Builder;
+
+        Options m_options;
+    };
+}
+
+#endif  // _LIBCJEL_IR_GENERATOR_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
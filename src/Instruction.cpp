@@ -43,6 +43,7 @@
 
 #include <libcjel-ir/Constant>
 #include <libcjel-ir/Function>
+#include <libcjel-ir/Memory>
 #include <libcjel-ir/Reference>
 #include <libcjel-ir/Statement>
 #include <libcjel-ir/Structure>
@@ -55,13 +56,28 @@
 
 using namespace libcjel_ir;
 
+// the void type of the operand-only instructions is looked up once
+static const Type::Ptr& voidType( void )
+{
+    static const Type::Ptr obj = libstdhl::Memory::get< VoidType >();
+    return obj;
+}
+
 Instruction::Instruction(
     const std::string& name,
     const Type::Ptr& type,
     const std::vector< Value::Ptr >& operands,
     Value::ID id )
-: User( name, type, id )
-, m_operands( operands )
+: User( name, type, operands, id )
+{
+}
+
+Instruction::Instruction(
+    const std::string& name,
+    const Type::Ptr& type,
+    std::initializer_list< Value::Ptr > operands,
+    Value::ID id )
+: User( name, type, operands, id )
 {
 }
 
@@ -69,7 +85,7 @@ void Instruction::setStatement( const Statement::Ptr& statement )
 {
     m_statement = statement;
 
-    for( auto operand : operands() )
+    for( const auto& operand : operands() )
     {
         if( not isa< Instruction >( operand ) )
         {
@@ -103,35 +119,146 @@ void Instruction::add( const Value::Ptr& value )
 
     if( isa< UnaryInstruction >( this ) )
     {
-        assert( m_operands.size() < 1 );
+        assert( operands().size() < 1 );
     }
     else if( isa< BinaryInstruction >( this ) )
     {
-        assert( m_operands.size() < 2 );
+        assert( operands().size() < 2 );
     }
 
-    m_operands.add( value );
+    User::add( value );
 }
 
-Value::Ptr Instruction::operand( u8 position ) const
+static std::size_t identity( const Value& value )
 {
-    if( position >= m_operands.size() )
+    if( isa< Constant >( value ) )
     {
-        throw std::domain_error(
-            "operand position '" + std::to_string( position ) + "' does not exist!" );
+        return value.hash();
     }
-
-    return m_operands[ position ];
+    return std::hash< const Value* >()( &value );
 }
 
-Values Instruction::operands( void ) const
+static u1 identical( const Value& lhs, const Value& rhs )
 {
-    return m_operands;
+    if( &lhs == &rhs )
+    {
+        return true;
+    }
+    return isa< Constant >( lhs ) and isa< Constant >( rhs ) and
+           static_cast< const Constant& >( lhs ).equals( static_cast< const Constant& >( rhs ) );
 }
 
 std::size_t Instruction::hash( void ) const
 {
-    return libstdhl::Hash::combine( classid(), std::hash< std::string >()( name() ) );
+    const auto& type = ptr_type();
+    auto h = libstdhl::Hash::combine( id(), type ? type->hash() : 0 );
+
+    const auto& values = operands();
+    if( values.size() == 2 and commutative() )
+    {
+        // symmetric in the operands, 'addu a, b' and 'addu b, a' collide
+        return libstdhl::Hash::combine( h, identity( *values[ 0 ] ) + identity( *values[ 1 ] ) );
+    }
+
+    for( const auto& value : values )
+    {
+        h = libstdhl::Hash::combine( h, identity( *value ) );
+    }
+    return h;
+}
+
+u1 Instruction::congruent( const Instruction& other ) const
+{
+    if( this == &other )
+    {
+        return true;
+    }
+
+    const auto& lhs = operands();
+    const auto& rhs = other.operands();
+
+    if( id() != other.id() or lhs.size() != rhs.size() )
+    {
+        return false;
+    }
+
+    const auto& type = ptr_type();
+    const auto& other_type = other.ptr_type();
+    if( type != other_type and ( not type or not other_type or *type != *other_type ) )
+    {
+        return false;
+    }
+
+    u1 result = true;
+    for( u32 c = 0; c < lhs.size() and result; c++ )
+    {
+        result = identical( *lhs[ c ], *rhs[ c ] );
+    }
+
+    if( not result and lhs.size() == 2 and commutative() )
+    {
+        result = identical( *lhs[ 0 ], *rhs[ 1 ] ) and identical( *lhs[ 1 ], *rhs[ 0 ] );
+    }
+
+    return result;
+}
+
+u1 Instruction::commutative( void ) const
+{
+    switch( id() )
+    {
+        case Value::AND_INSTRUCTION:  // fall-through
+        case Value::OR_INSTRUCTION:   // fall-through
+        case Value::XOR_INSTRUCTION:  // fall-through
+        case Value::ADDU_INSTRUCTION: // fall-through
+        case Value::ADDS_INSTRUCTION: // fall-through
+        case Value::EQU_INSTRUCTION:  // fall-through
+        case Value::NEQ_INSTRUCTION:
+        {
+            return true;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+u1 Instruction::mayFault( void ) const
+{
+    switch( id() )
+    {
+        case Value::DIVS_INSTRUCTION:  // fall-through
+        case Value::MODU_INSTRUCTION:
+        {
+            const auto& divisor = *operand( 1 );
+            return not isa< BitConstant >( divisor ) or
+                   static_cast< const BitConstant& >( divisor ).value().value() == 0;
+        }
+        case Value::EXTRACT_INSTRUCTION:
+        {
+            const auto& src = *operand( 0 );
+            const auto& index = *operand( 1 );
+            if( not isa< Memory >( src ) )
+            {
+                return false;
+            }
+            return not isa< BitConstant >( index ) or
+                   static_cast< const BitConstant& >( index ).value().value() >=
+                       static_cast< const Memory& >( src ).length();
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+u1 Instruction::storage( const Value& value )
+{
+    return isa< Reference >( value ) or isa< Variable >( value ) or isa< Memory >( value ) or
+           isa< AllocInstruction >( value ) or isa< CallInstruction >( value ) or
+           isa< ExtractInstruction >( value );
 }
 
 u1 Instruction::classof( Value const* obj )
@@ -148,7 +275,7 @@ UnaryInstruction::UnaryInstruction( Instruction* self )
 {
 }
 
-Value::Ptr UnaryInstruction::get( void ) const
+const Value::Ptr& UnaryInstruction::get( void ) const
 {
     assert( m_self.operands().size() == 1 );
     return m_self.operand( 0 );
@@ -166,13 +293,13 @@ BinaryInstruction::BinaryInstruction( Instruction* self )
 {
 }
 
-Value::Ptr BinaryInstruction::lhs( void ) const
+const Value::Ptr& BinaryInstruction::lhs( void ) const
 {
     assert( m_self.operands().size() == 2 );
     return m_self.operand( 0 );
 }
 
-Value::Ptr BinaryInstruction::rhs( void ) const
+const Value::Ptr& BinaryInstruction::rhs( void ) const
 {
     assert( m_self.operands().size() == 2 );
     return m_self.operand( 1 );
@@ -192,7 +319,7 @@ u1 BinaryInstruction::classof( Value const* obj )
 OperatorInstruction::OperatorInstruction(
     const std::string& name,
     const Type::Ptr& type,
-    const std::vector< Value::Ptr >& values,
+    std::initializer_list< Value::Ptr > values,
     Value::ID id )
 : Instruction( name, type, values, id )
 {
@@ -209,9 +336,12 @@ u1 OperatorInstruction::classof( Value const* obj )
 }
 
 ArithmeticInstruction::ArithmeticInstruction(
-    const std::string& name, const std::vector< Value::Ptr >& values, Value::ID id )
+    const std::string& name, std::initializer_list< Value::Ptr > values, Value::ID id )
 : OperatorInstruction(
-      name, ( values.size() > 0 and values[ 0 ] ) ? values[ 0 ]->ptr_type() : nullptr, values, id )
+      name,
+      ( values.size() > 0 and *values.begin() ) ? ( *values.begin() )->ptr_type() : nullptr,
+      values,
+      id )
 {
 }
 
@@ -225,8 +355,8 @@ u1 ArithmeticInstruction::classof( Value const* obj )
 }
 
 LogicalInstruction::LogicalInstruction(
-    const std::string& name, const std::vector< Value::Ptr >& values, Value::ID id )
-: OperatorInstruction( name, libstdhl::Memory::get< BitType >( 1 ), values, id )
+    const std::string& name, std::initializer_list< Value::Ptr > values, Value::ID id )
+: OperatorInstruction( name, BitType::get( 1 ), values, id )
 {
 }
 
@@ -236,8 +366,8 @@ u1 LogicalInstruction::classof( Value const* obj )
 }
 
 CompareInstruction::CompareInstruction(
-    const std::string& name, const std::vector< Value::Ptr >& values, Value::ID id )
-: OperatorInstruction( name, libstdhl::Memory::get< BitType >( 1 ), values, id )
+    const std::string& name, std::initializer_list< Value::Ptr > values, Value::ID id )
+: OperatorInstruction( name, BitType::get( 1 ), values, id )
 {
 }
 
@@ -252,7 +382,7 @@ u1 CompareInstruction::classof( Value const* obj )
 // -----------------------------------------------------------------------------
 
 NopInstruction::NopInstruction( void )
-: Instruction( "nop", libstdhl::Memory::get< VoidType >(), {}, classid() )
+: Instruction( "nop", voidType(), {}, classid() )
 {
 }
 
@@ -282,13 +412,13 @@ CallInstruction::CallInstruction(
         assert( !" unimplemented call instruction result type behavior! " );
     }
 
-    for( auto operand : operands )
+    for( const auto& operand : operands )
     {
         add( operand );
     }
 }
 
-Value::Ptr CallInstruction::callee( void ) const
+const Value::Ptr& CallInstruction::callee( void ) const
 {
     return operand( 0 );
 }
@@ -304,7 +434,7 @@ IdCallInstruction::IdCallInstruction( const Value::Ptr& kind, const Value::Ptr&
     assert( kind );
     assert( symbol );
 
-    assert( symbol->type() == *libstdhl::Memory::get< BitType >( 64 ) );
+    assert( symbol->type() == *BitType::get( 64 ) );
 }
 
 u1 IdCallInstruction::classof( Value const* obj )
@@ -333,7 +463,7 @@ u1 StreamInstruction::classof( Value const* obj )
 // -----------------------------------------------------------------------------
 
 IdInstruction::IdInstruction( const Value::Ptr& src )
-: Instruction( "id", libstdhl::Memory::get< BitType >( 64 ), { src }, classid() )
+: Instruction( "id", BitType::get( 64 ), { src }, classid() )
 , UnaryInstruction( this )
 {
     assert( src );
@@ -383,7 +513,7 @@ u1 TruncationInstruction::classof( Value const* obj )
 // -----------------------------------------------------------------------------
 
 StoreInstruction::StoreInstruction( const Value::Ptr& src, const Value::Ptr& dst )
-: Instruction( "store", libstdhl::Memory::get< VoidType >(), { src, dst }, classid() )
+: Instruction( "store", voidType(), { src, dst }, classid() )
 , BinaryInstruction( this )
 {
     assert( src->type() == dst->type() );
@@ -395,17 +525,31 @@ u1 StoreInstruction::classof( Value const* obj )
     return obj->id() == classid();
 }
 
+static Type::Ptr extractType( const Value::Ptr& src, const Value::Ptr& dst )
+{
+    if( not src or not dst )
+    {
+        return nullptr;
+    }
+
+    if( isa< Memory >( src ) )
+    {
+        // memory elements are selected by a (possibly dynamic) index
+        return src->type().ptr_results()[ 0 ];
+    }
+
+    if( isa< Reference >( src ) and src->type().isStructure() and isa< BitConstant >( dst ) )
+    {
+        return src->type().ptr_results()[ std::static_pointer_cast< BitConstant >( dst )
+                                              ->value()
+                                              .value() ];
+    }
+
+    return nullptr;
+}
+
 ExtractInstruction::ExtractInstruction( const Value::Ptr& src, const Value::Ptr& dst )
-: Instruction(
-      "extract",
-      ( src and dst
-            ? ( isa< Reference >( src ) and src->type().isStructure() and isa< BitConstant >( dst )
-                    ? src->type().ptr_results()
-                          [ std::static_pointer_cast< BitConstant >( dst )->value().value() ]
-                    : nullptr )
-            : nullptr ),
-      { src, dst },
-      classid() )
+: Instruction( "extract", extractType( src, dst ), { src, dst }, classid() )
 , BinaryInstruction( this )
 {
     // TODO: IDEA: FIXME: PPA: possible check to implement if 'dst' is inside
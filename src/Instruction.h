@@ -59,20 +59,55 @@ namespace libcjel_ir
             const std::vector< Value::Ptr >& operands,
             Value::ID id = classid() );
 
-        void add( const Value::Ptr& operand );
-
-        Value::Ptr operand( u8 position ) const;
-
-        Values operands( void ) const;
+        Instruction(
+            const std::string& name,
+            const Type::Ptr& type,
+            std::initializer_list< Value::Ptr > operands,
+            Value::ID id = classid() );
 
-        // void replace(...) // TODO: PPA:
+        void add( const Value::Ptr& operand );
 
         void setStatement( const std::shared_ptr< Statement >& statement );
 
         std::shared_ptr< Statement > statement( void ) const;
 
+        /**
+           structural hash over the opcode, the result type and the operand
+           identities, constant operands are hashed by value and the operands
+           of commutative operators in any order
+        */
+
         std::size_t hash( void ) const override;
 
+        /**
+           same opcode, result type and operands as 'other', the structural
+           equality of 'hash'
+        */
+
+        u1 congruent( const Instruction& other ) const;
+
+        /**
+           'and', 'or', 'xor', 'addu', 'adds', 'equ' and 'neq'
+        */
+
+        u1 commutative( void ) const;
+
+        /**
+           may raise a fault at runtime, a 'divs' or 'modu' without a non-zero
+           constant divisor and a memory 'extract' without an in-range
+           constant index
+        */
+
+        u1 mayFault( void ) const;
+
+        /**
+           a reference, variable or memory, an 'alloc', a 'call' result or an
+           'extract', storage is read implicitly when used as an operand and
+           can change between two uses
+        */
+
+        static u1 storage( const Value& value );
+
         static inline Value::ID classid( void )
         {
             return Value::INSTRUCTION;
@@ -81,9 +116,9 @@ namespace libcjel_ir
         static bool classof( Value const* obj );
 
       private:
-        Values m_operands;
-
         std::weak_ptr< Statement > m_statement;
+
+        friend class Binary;
     };
 
     using Instructions = libstdhl::List< Instruction >;
@@ -93,7 +128,7 @@ namespace libcjel_ir
       public:
         UnaryInstruction( Instruction* self );
 
-        Value::Ptr get( void ) const;
+        const Value::Ptr& get( void ) const;
 
         static inline Value::ID classid( void )
         {
@@ -111,8 +146,8 @@ namespace libcjel_ir
       public:
         BinaryInstruction( Instruction* self );
 
-        Value::Ptr lhs( void ) const;
-        Value::Ptr rhs( void ) const;
+        const Value::Ptr& lhs( void ) const;
+        const Value::Ptr& rhs( void ) const;
 
         static inline Value::ID classid( void )
         {
@@ -133,7 +168,7 @@ namespace libcjel_ir
         OperatorInstruction(
             const std::string& name,
             const Type::Ptr& type,
-            const std::vector< Value::Ptr >& values,
+            std::initializer_list< Value::Ptr > values,
             Value::ID id = classid() );
 
         static inline Value::ID classid( void )
@@ -151,7 +186,7 @@ namespace libcjel_ir
 
         ArithmeticInstruction(
             const std::string& name,
-            const std::vector< Value::Ptr >& values,
+            std::initializer_list< Value::Ptr > values,
             Value::ID id = classid() );
 
         static inline Value::ID classid( void )
@@ -169,7 +204,7 @@ namespace libcjel_ir
 
         CompareInstruction(
             const std::string& name,
-            const std::vector< Value::Ptr >& values,
+            std::initializer_list< Value::Ptr > values,
             Value::ID id = classid() );
 
         static inline Value::ID classid( void )
@@ -187,7 +222,7 @@ namespace libcjel_ir
 
         LogicalInstruction(
             const std::string& name,
-            const std::vector< Value::Ptr >& values,
+            std::initializer_list< Value::Ptr > values,
             Value::ID id = classid() );
 
         static inline Value::ID classid( void )
@@ -354,7 +389,7 @@ namespace libcjel_ir
 
         CallInstruction( const Value::Ptr& symbol, const std::vector< Value::Ptr >& operands = {} );
 
-        Value::Ptr callee( void ) const;
+        const Value::Ptr& callee( void ) const;
 
         static inline Value::ID classid( void )
         {
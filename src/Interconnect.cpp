@@ -67,7 +67,7 @@ void Interconnect::add( const Value::Ptr& value )
     m_bs_max = std::max( m_bs_max, value->type().bitsize() );
 }
 
-Values Interconnect::objects( void ) const
+const Values& Interconnect::objects( void ) const
 {
     return m_objects;
 }
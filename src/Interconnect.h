@@ -53,7 +53,7 @@ namespace libcjel_ir
 
         void add( const Value::Ptr& object );
 
-        Values objects( void ) const;
+        const Values& objects( void ) const;
 
         u64 bitsizeMax( void ) const;
 
@@ -0,0 +1,945 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Interpreter.h"
+
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Variable>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace libcjel_ir;
+
+static constexpr u32 CALL_DEPTH_MAX = 1 << 12;
+
+static u64 mask( u16 bits )
+{
+    return bits >= 64 ? ~( (u64)0 ) : ( ( (u64)1 << bits ) - 1 );
+}
+
+static u16 bits( const Type& type )
+{
+    if( not type.isBit() or type.bitsize() > 64 )
+    {
+        throw std::domain_error(
+            "interpreter supports bit types up to 64 bits only, found '" + type.name() + "'" );
+    }
+
+    return type.bitsize();
+}
+
+static void flatten( const Type::Ptr& type, std::vector< Type::Ptr >& result )
+{
+    if( type->isStructure() or type->isVector() )
+    {
+        for( const auto& element : type->results() )
+        {
+            flatten( element, result );
+        }
+        return;
+    }
+
+    bits( *type );
+    result.emplace_back( type );
+}
+
+static u32 size( const Type& type )
+{
+    if( type.isStructure() or type.isVector() )
+    {
+        u32 result = 0;
+        for( const auto& element : type.results() )
+        {
+            result += size( *element );
+        }
+        return result;
+    }
+
+    bits( type );
+    return 1;
+}
+
+//
+//
+// Decoder
+//
+
+class Interpreter::Decoder
+{
+  public:
+    Decoder( Interpreter& interpreter, Program& program )
+    : m_interpreter( interpreter )
+    , m_program( program )
+    {
+    }
+
+    void function( const Function& function )
+    {
+        for( const auto& reference : function.inputs() )
+        {
+            const auto slot = allocate( size( reference->type() ) );
+            m_locations.emplace( reference.get(), Location{ FRAME, slot } );
+            flatten( reference->ptr_type(), m_program.inputs );
+        }
+
+        for( const auto& reference : function.outputs() )
+        {
+            const auto slot = allocate( size( reference->type() ) );
+            m_locations.emplace( reference.get(), Location{ FRAME, slot } );
+            flatten( reference->ptr_type(), m_program.outputs );
+        }
+
+        for( const auto& reference : function.linkage() )
+        {
+            const auto slot = allocate( size( reference->type() ) );
+            m_locations.emplace( reference.get(), Location{ FRAME, slot } );
+        }
+
+        scope( *function.context() );
+
+        emit( Code::RETURN );
+    }
+
+  private:
+    enum Space : u8
+    {
+        FRAME,
+        GLOBAL,
+        INDIRECT  // frame slot holding a global slot
+    };
+
+    struct Location
+    {
+        Space space;
+        u32 slot;
+    };
+
+    u32 allocate( u32 count )
+    {
+        const u32 slot = m_program.frame.size();
+        m_program.frame.resize( slot + count, 0 );
+        return slot;
+    }
+
+    u32 emit( Code code, u32 dst = 0, u32 lhs = 0, u32 rhs = 0, u64 imm = 0, u16 bits = 0 )
+    {
+        m_program.code.emplace_back( Op{ code, 0, bits, dst, lhs, rhs, imm } );
+        return m_program.code.size() - 1;
+    }
+
+    void patch( u32 position )
+    {
+        m_program.code[ position ].imm = m_program.code.size();
+    }
+
+    Location location( const Value& value )
+    {
+        const auto result = m_locations.find( &value );
+        if( result != m_locations.end() )
+        {
+            return result->second;
+        }
+
+        Location location;
+
+        if( isa< BitConstant >( value ) )
+        {
+            const auto& constant = static_cast< const BitConstant& >( value );
+            location = Location{ FRAME, allocate( 1 ) };
+            m_program.frame[ location.slot ] =
+                constant.value().value() & mask( bits( constant.type() ) );
+        }
+        else if( isa< Variable >( value ) )
+        {
+            location = Location{ GLOBAL, m_interpreter.global( value, size( value.type() ) ) };
+        }
+        else if( isa< Memory >( value ) )
+        {
+            const auto& memory = static_cast< const Memory& >( value );
+            bits( *memory.type().results()[ 0 ] );
+            location = Location{ GLOBAL, m_interpreter.global( value, memory.length() ) };
+        }
+        else
+        {
+            throw std::domain_error(
+                "value '" + value.name() + "' is used before its definition" );
+        }
+
+        m_locations.emplace( &value, location );
+        return location;
+    }
+
+    u32 value( const Value& value )
+    {
+        const auto result = location( value );
+        if( result.space != FRAME )
+        {
+            throw std::domain_error(
+                "value '" + value.name() + "' has to be loaded before its use" );
+        }
+
+        return result.slot;
+    }
+
+    u32 define( const Instruction& instruction )
+    {
+        bits( instruction.type() );
+        const auto slot = allocate( 1 );
+        m_locations.emplace( &instruction, Location{ FRAME, slot } );
+        return slot;
+    }
+
+    void scope( const Scope& scope )
+    {
+        for( const auto& child : scope.blocks() )
+        {
+            if( isa< Scope >( child ) )
+            {
+                this->scope( static_cast< const Scope& >( *child ) );
+            }
+            else
+            {
+                statement( static_cast< const Statement& >( *child ) );
+            }
+        }
+    }
+
+    void statement( const Statement& statement )
+    {
+        const u32 head = m_program.code.size();
+
+        const auto& instructions = statement.instructions();
+        if( instructions.size() == 0 )
+        {
+            throw std::domain_error( "a statement must contain at least one instruction" );
+        }
+
+        for( const auto& instr : instructions )
+        {
+            instruction( *instr );
+        }
+
+        if( isa< TrivialStatement >( statement ) )
+        {
+            return;
+        }
+
+        const auto& scopes = statement.scopes();
+        const auto& last = instructions[ instructions.size() - 1 ];
+        if( m_locations.count( last.get() ) == 0 )
+        {
+            throw std::domain_error( "last instruction of statement '" + statement.name() +
+                                     "' does not produce a condition" );
+        }
+        const auto condition = value( *last );
+
+        if( scopes.size() == 0 )
+        {
+            throw std::domain_error( "statement '" + statement.name() + "' has no scope" );
+        }
+
+        if( isa< LoopStatement >( statement ) )
+        {
+            const auto exit = emit( Code::JZ, 0, condition );
+            scope( *scopes[ 0 ] );
+            emit( Code::JUMP, 0, 0, 0, head );
+            patch( exit );
+        }
+        else if( scopes.size() <= 2 )
+        {
+            const auto skip = emit( Code::JZ, 0, condition );
+            scope( *scopes[ 0 ] );
+
+            if( scopes.size() == 2 )
+            {
+                const auto exit = emit( Code::JUMP );
+                patch( skip );
+                scope( *scopes[ 1 ] );
+                patch( exit );
+            }
+            else
+            {
+                patch( skip );
+            }
+        }
+        else
+        {
+            std::vector< u32 > exits;
+            for( u32 c = 0; c < scopes.size(); c++ )
+            {
+                const auto skip = emit( Code::JNE, 0, condition, c );
+                scope( *scopes[ c ] );
+                exits.emplace_back( emit( Code::JUMP ) );
+                patch( skip );
+            }
+
+            for( const auto exit : exits )
+            {
+                patch( exit );
+            }
+        }
+    }
+
+    void instruction( const Instruction& instr )
+    {
+        switch( instr.id() )
+        {
+            case Value::NOP_INSTRUCTION:
+            {
+                break;
+            }
+            case Value::ALLOC_INSTRUCTION:
+            {
+                emit( Code::ZERO, define( instr ) );
+                break;
+            }
+            case Value::LOAD_INSTRUCTION:
+            {
+                const auto src = location( *instr.operand( 0 ) );
+                const auto dst = define( instr );
+
+                if( src.space == FRAME )
+                {
+                    emit( Code::MOVE, dst, src.slot );
+                }
+                else if( src.space == GLOBAL )
+                {
+                    emit( Code::LOADG, dst, 0, 0, src.slot );
+                }
+                else
+                {
+                    emit( Code::LOADI, dst, src.slot );
+                }
+                break;
+            }
+            case Value::STORE_INSTRUCTION:
+            {
+                const auto src = value( *instr.operand( 0 ) );
+                const auto dst = location( *instr.operand( 1 ) );
+
+                if( dst.space == FRAME )
+                {
+                    emit( Code::MOVE, dst.slot, src );
+                }
+                else if( dst.space == GLOBAL )
+                {
+                    emit( Code::STOREG, 0, src, 0, dst.slot );
+                }
+                else
+                {
+                    emit( Code::STOREI, 0, src, dst.slot );
+                }
+                break;
+            }
+            case Value::EXTRACT_INSTRUCTION:
+            {
+                extract( instr );
+                break;
+            }
+            case Value::CALL_INSTRUCTION:
+            {
+                call( instr );
+                break;
+            }
+            case Value::ZEXT_INSTRUCTION:
+            {
+                const auto src = value( *instr.operand( 0 ) );
+                emit( Code::MOVE, define( instr ), src );
+                break;
+            }
+            case Value::TRUNC_INSTRUCTION:
+            {
+                const auto src = value( *instr.operand( 0 ) );
+                emit( Code::MASK, define( instr ), src, 0, mask( bits( instr.type() ) ) );
+                break;
+            }
+            case Value::NOT_INSTRUCTION:
+            {
+                const auto src = value( *instr.operand( 0 ) );
+                emit( Code::NOT, define( instr ), src, 0, mask( bits( instr.type() ) ) );
+                break;
+            }
+            case Value::LNOT_INSTRUCTION:
+            {
+                const auto src = value( *instr.operand( 0 ) );
+                emit( Code::LNOT, define( instr ), src );
+                break;
+            }
+            case Value::AND_INSTRUCTION:
+            {
+                binary( Code::AND, instr );
+                break;
+            }
+            case Value::OR_INSTRUCTION:
+            {
+                binary( Code::OR, instr );
+                break;
+            }
+            case Value::XOR_INSTRUCTION:
+            {
+                binary( Code::XOR, instr );
+                break;
+            }
+            case Value::ADDS_INSTRUCTION:  // fall-through, equal in two's complement
+            case Value::ADDU_INSTRUCTION:
+            {
+                binary( Code::ADD, instr );
+                break;
+            }
+            case Value::DIVS_INSTRUCTION:
+            {
+                binary( Code::DIVS, instr );
+                break;
+            }
+            case Value::MODU_INSTRUCTION:
+            {
+                binary( Code::MODU, instr );
+                break;
+            }
+            case Value::EQU_INSTRUCTION:
+            {
+                binary( Code::EQU, instr );
+                break;
+            }
+            case Value::NEQ_INSTRUCTION:
+            {
+                binary( Code::NEQ, instr );
+                break;
+            }
+            default:
+            {
+                throw std::domain_error(
+                    "interpreter does not support instruction '" + instr.name() + "'" );
+            }
+        }
+    }
+
+    void binary( Code code, const Instruction& instr )
+    {
+        const auto lhs = value( *instr.operand( 0 ) );
+        const auto rhs = value( *instr.operand( 1 ) );
+        const auto operand = bits( instr.operand( 0 )->type() );
+
+        emit( code, define( instr ), lhs, rhs, mask( operand ), operand );
+    }
+
+    void extract( const Instruction& instr )
+    {
+        const auto& src = *instr.operand( 0 );
+        const auto& index = *instr.operand( 1 );
+        const auto base = location( src );
+
+        if( isa< Memory >( src ) )
+        {
+            const auto length = static_cast< const Memory& >( src ).length();
+
+            if( not isa< BitConstant >( index ) )
+            {
+                const auto slot = allocate( 1 );
+                emit( Code::ADDRESS, slot, value( index ), length, base.slot );
+                m_locations.emplace( &instr, Location{ INDIRECT, slot } );
+                return;
+            }
+
+            const auto element = static_cast< const BitConstant& >( index ).value().value();
+            if( element >= length )
+            {
+                throw std::domain_error( "memory index '" + std::to_string( element ) +
+                                         "' is out of range of '" + src.name() + "'" );
+            }
+
+            m_locations.emplace( &instr, Location{ GLOBAL, (u32)( base.slot + element ) } );
+            return;
+        }
+
+        if( not isa< BitConstant >( index ) or base.space == INDIRECT or
+            not( src.type().isStructure() or src.type().isVector() ) )
+        {
+            throw std::domain_error(
+                "interpreter supports constant element extraction of aggregates only" );
+        }
+
+        const auto element = static_cast< const BitConstant& >( index ).value().value();
+        const auto& elements = src.type().results();
+        if( element >= elements.size() )
+        {
+            throw std::domain_error( "element '" + std::to_string( element ) +
+                                     "' is out of range of '" + src.name() + "'" );
+        }
+
+        u32 offset = 0;
+        for( u32 c = 0; c < element; c++ )
+        {
+            offset += size( *elements[ c ] );
+        }
+
+        m_locations.emplace( &instr, Location{ base.space, base.slot + offset } );
+    }
+
+    void call( const Instruction& instr )
+    {
+        const auto& callee = instr.operand( 0 );
+        if( not isa< Function >( callee ) )
+        {
+            throw std::domain_error( "interpreter does not support calls to '" +
+                                     callee->name() + "'" );
+        }
+
+        const auto& function = static_cast< const Function& >( *callee );
+        const auto index = m_interpreter.decode( function );
+
+        const u32 first = m_program.arguments.size();
+        for( u32 c = 1; c < instr.operands().size(); c++ )
+        {
+            const auto& operand = *instr.operand( c );
+            const auto slot = value( operand );
+            for( u32 i = 0; i < size( operand.type() ); i++ )
+            {
+                m_program.arguments.emplace_back( slot + i );
+            }
+        }
+        const u32 count = m_program.arguments.size() - first;
+
+        u32 inputs = 0;
+        for( const auto& reference : function.inputs() )
+        {
+            inputs += size( reference->type() );
+        }
+
+        if( count != inputs )
+        {
+            throw std::domain_error( "call of '" + function.name() + "' requires " +
+                                     std::to_string( inputs ) + " argument slots, found " +
+                                     std::to_string( count ) );
+        }
+
+        const auto result = allocate( size( instr.type() ) );
+        m_locations.emplace( &instr, Location{ FRAME, result } );
+
+        emit( Code::CALL, result, first, count, index );
+    }
+
+    Interpreter& m_interpreter;
+
+    Program& m_program;
+
+    std::unordered_map< const Value*, Location > m_locations;
+};
+
+//
+//
+// Interpreter
+//
+
+Interpreter::Interpreter( void )
+: m_executed( 0 )
+{
+}
+
+std::vector< BitConstant > Interpreter::run(
+    const Function& function, const std::vector< BitConstant >& arguments )
+{
+    const auto index = decode( function );
+    const auto& program = m_programs[ index ];
+
+    if( arguments.size() != program.inputs.size() )
+    {
+        throw std::domain_error( "function '" + function.name() + "' requires " +
+                                 std::to_string( program.inputs.size() ) + " arguments, found " +
+                                 std::to_string( arguments.size() ) );
+    }
+
+    if( m_stack.size() < program.frame.size() )
+    {
+        m_stack.resize( program.frame.size() );
+    }
+
+    std::copy( program.frame.begin(), program.frame.end(), m_stack.begin() );
+
+    for( u32 c = 0; c < arguments.size(); c++ )
+    {
+        if( arguments[ c ].type() != *program.inputs[ c ] )
+        {
+            throw std::domain_error( "argument " + std::to_string( c ) + " of '" +
+                                     function.name() + "' has type '" +
+                                     arguments[ c ].type().name() + "', expected '" +
+                                     program.inputs[ c ]->name() + "'" );
+        }
+
+        m_stack[ c ] = arguments[ c ].value().value();
+    }
+
+    m_executed += execute( index, 0, 0 );
+
+    std::vector< BitConstant > results;
+    results.reserve( program.outputs.size() );
+
+    for( u32 c = 0; c < program.outputs.size(); c++ )
+    {
+        results.emplace_back( program.outputs[ c ], m_stack[ program.inputs.size() + c ] );
+    }
+
+    return results;
+}
+
+BitConstant Interpreter::load( const Variable& variable )
+{
+    const auto slot = global( variable, 1 );
+    return BitConstant( variable.ptr_type(), m_globals[ slot ] );
+}
+
+void Interpreter::store( const Variable& variable, const BitConstant& value )
+{
+    if( value.type() != variable.type() )
+    {
+        throw std::domain_error( "value type '" + value.type().name() +
+                                 "' does not match variable type '" +
+                                 variable.type().name() + "'" );
+    }
+
+    m_globals[ global( variable, 1 ) ] = value.value().value();
+}
+
+BitConstant Interpreter::load( const Memory& memory, u32 index )
+{
+    if( index >= memory.length() )
+    {
+        throw std::domain_error( "memory index '" + std::to_string( index ) +
+                                 "' is out of range of '" + memory.name() + "'" );
+    }
+
+    const auto slot = global( memory, memory.length() );
+    return BitConstant( memory.type().ptr_results()[ 0 ], m_globals[ slot + index ] );
+}
+
+void Interpreter::store( const Memory& memory, u32 index, const BitConstant& value )
+{
+    if( index >= memory.length() )
+    {
+        throw std::domain_error( "memory index '" + std::to_string( index ) +
+                                 "' is out of range of '" + memory.name() + "'" );
+    }
+
+    if( value.type() != *memory.type().results()[ 0 ] )
+    {
+        throw std::domain_error( "value type '" + value.type().name() +
+                                 "' does not match memory element type '" +
+                                 memory.type().results()[ 0 ]->name() + "'" );
+    }
+
+    m_globals[ global( memory, memory.length() ) + index ] = value.value().value();
+}
+
+u64 Interpreter::executed( void ) const
+{
+    return m_executed;
+}
+
+u32 Interpreter::decode( const Function& function )
+{
+    const auto result = m_index.find( &function );
+    if( result != m_index.end() )
+    {
+        return result->second;
+    }
+
+    if( not function.context() )
+    {
+        throw std::domain_error( "function '" + function.name() + "' has no context" );
+    }
+
+    // register before decoding to support recursive calls
+    const u32 index = m_programs.size();
+    m_programs.emplace_back();
+    m_index.emplace( &function, index );
+
+    Program program;
+    try
+    {
+        Decoder decoder( *this, program );
+        decoder.function( function );
+    }
+    catch( ... )
+    {
+        m_index.erase( &function );
+        throw;
+    }
+
+    m_programs[ index ] = std::move( program );
+    return index;
+}
+
+u32 Interpreter::global( const Value& value, u32 count )
+{
+    const auto result = m_global.find( &value );
+    if( result != m_global.end() )
+    {
+        return result->second;
+    }
+
+    const u32 slot = m_globals.size();
+    m_globals.resize( slot + count, 0 );
+
+    if( isa< Variable >( value ) )
+    {
+        const auto& variable = static_cast< const Variable& >( value );
+        const auto expression = variable.expression();
+
+        if( not isa< BitConstant >( expression ) )
+        {
+            throw std::domain_error(
+                "interpreter supports bit constant initialized variables only" );
+        }
+
+        m_globals[ slot ] = static_cast< const BitConstant& >( *expression ).value().value() &
+                            mask( bits( variable.type() ) );
+    }
+
+    m_global.emplace( &value, slot );
+    return slot;
+}
+
+u64 Interpreter::execute( u32 index, std::size_t base, u32 depth )
+{
+    const auto& program = m_programs[ index ];
+    const Op* code = program.code.data();
+    u64* f = m_stack.data() + base;
+    u64* g = m_globals.data();
+    u64 count = 0;
+
+    for( u32 pc = 0;; )
+    {
+        const Op& op = code[ pc++ ];
+        count++;
+
+        switch( op.code )
+        {
+            case Code::MOVE:
+            {
+                f[ op.dst ] = f[ op.lhs ];
+                break;
+            }
+            case Code::ZERO:
+            {
+                f[ op.dst ] = 0;
+                break;
+            }
+            case Code::LOADG:
+            {
+                f[ op.dst ] = g[ op.imm ];
+                break;
+            }
+            case Code::STOREG:
+            {
+                g[ op.imm ] = f[ op.lhs ];
+                break;
+            }
+            case Code::LOADI:
+            {
+                f[ op.dst ] = g[ f[ op.lhs ] ];
+                break;
+            }
+            case Code::STOREI:
+            {
+                g[ f[ op.rhs ] ] = f[ op.lhs ];
+                break;
+            }
+            case Code::ADDRESS:
+            {
+                if( f[ op.lhs ] >= op.rhs )
+                {
+                    throw std::domain_error( "memory index '" + std::to_string( f[ op.lhs ] ) +
+                                             "' is out of range" );
+                }
+                f[ op.dst ] = op.imm + f[ op.lhs ];
+                break;
+            }
+            case Code::NOT:
+            {
+                f[ op.dst ] = ~f[ op.lhs ] & op.imm;
+                break;
+            }
+            case Code::LNOT:
+            {
+                f[ op.dst ] = f[ op.lhs ] == 0;
+                break;
+            }
+            case Code::AND:
+            {
+                f[ op.dst ] = f[ op.lhs ] & f[ op.rhs ];
+                break;
+            }
+            case Code::OR:
+            {
+                f[ op.dst ] = f[ op.lhs ] | f[ op.rhs ];
+                break;
+            }
+            case Code::XOR:
+            {
+                f[ op.dst ] = f[ op.lhs ] ^ f[ op.rhs ];
+                break;
+            }
+            case Code::ADD:
+            {
+                f[ op.dst ] = ( f[ op.lhs ] + f[ op.rhs ] ) & op.imm;
+                break;
+            }
+            case Code::DIVS:
+            {
+                const u64 sign = (u64)1 << ( op.bits - 1 );
+                const i64 lhs = (i64)( ( f[ op.lhs ] ^ sign ) - sign );
+                const i64 rhs = (i64)( ( f[ op.rhs ] ^ sign ) - sign );
+
+                if( rhs == 0 )
+                {
+                    throw std::domain_error( "division by zero" );
+                }
+
+                // avoid the overflow trap of the minimum value divided by '-1'
+                f[ op.dst ] = ( rhs == -1 ? ( 0 - (u64)lhs ) : (u64)( lhs / rhs ) ) & op.imm;
+                break;
+            }
+            case Code::MODU:
+            {
+                if( f[ op.rhs ] == 0 )
+                {
+                    throw std::domain_error( "division by zero" );
+                }
+                f[ op.dst ] = f[ op.lhs ] % f[ op.rhs ];
+                break;
+            }
+            case Code::EQU:
+            {
+                f[ op.dst ] = f[ op.lhs ] == f[ op.rhs ];
+                break;
+            }
+            case Code::NEQ:
+            {
+                f[ op.dst ] = f[ op.lhs ] != f[ op.rhs ];
+                break;
+            }
+            case Code::MASK:
+            {
+                f[ op.dst ] = f[ op.lhs ] & op.imm;
+                break;
+            }
+            case Code::JUMP:
+            {
+                pc = op.imm;
+                break;
+            }
+            case Code::JZ:
+            {
+                if( f[ op.lhs ] == 0 )
+                {
+                    pc = op.imm;
+                }
+                break;
+            }
+            case Code::JNE:
+            {
+                if( f[ op.lhs ] != op.rhs )
+                {
+                    pc = op.imm;
+                }
+                break;
+            }
+            case Code::CALL:
+            {
+                if( depth >= CALL_DEPTH_MAX )
+                {
+                    throw std::domain_error( "call depth exceeds " +
+                                             std::to_string( CALL_DEPTH_MAX ) );
+                }
+
+                const auto& callee = m_programs[ op.imm ];
+                const auto next = base + program.frame.size();
+
+                if( m_stack.size() < next + callee.frame.size() )
+                {
+                    m_stack.resize( next + callee.frame.size() );
+                    f = m_stack.data() + base;
+                }
+
+                u64* frame = f + program.frame.size();
+                std::memcpy( frame, callee.frame.data(), callee.frame.size() * sizeof( u64 ) );
+
+                const u32* arguments = program.arguments.data() + op.lhs;
+                for( u32 c = 0; c < op.rhs; c++ )
+                {
+                    frame[ c ] = f[ arguments[ c ] ];
+                }
+
+                count += execute( op.imm, next, depth + 1 );
+
+                // the callee may have grown the stack
+                f = m_stack.data() + base;
+                frame = f + program.frame.size();
+
+                const auto inputs = callee.inputs.size();
+                for( u32 c = 0; c < callee.outputs.size(); c++ )
+                {
+                    f[ op.dst + c ] = frame[ inputs + c ];
+                }
+                break;
+            }
+            case Code::RETURN:
+            {
+                return count;
+            }
+        }
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,188 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_INTERPRETER_H_
+#define _LIBCJEL_IR_INTERPRETER_H_
+
+#include <libcjel-ir/Constant>
+
+#include <unordered_map>
+
+namespace libcjel_ir
+{
+    class Function;
+    class Variable;
+    class Memory;
+
+    /**
+       @brief    reference interpreter for functions
+
+       Every function is decoded once on first use into a flat program of
+       fixed-size operations on 64-bit frame slots. Scopes and statements
+       become (conditional) jumps and all operand references are resolved to
+       slot indices, therefore the execution loop works on plain arrays only.
+       Later modifications of an already decoded function are not observed.
+
+       Structure and vector typed references are flattened into consecutive
+       slots in element order, the arguments and results of 'run' follow the
+       same flattened order. Variables and memories are global slots which
+       keep their state between runs.
+
+       A branch statement with one or two scopes uses the value of its last
+       instruction as condition and executes the first scope if it is
+       non-zero and the optional second scope otherwise, with more scopes the
+       value selects the scope by index. A loop statement executes its scope
+       as long as the value of its last instruction is non-zero. The blocks
+       of a parallel scope are executed in order, which is one valid
+       serialization.
+
+       Only bit types up to 64 bits are supported, unsupported constructs are
+       reported as 'std::domain_error' while decoding and runtime faults
+       (division by zero, memory index out of range) while running.
+    */
+
+    class Interpreter final
+    {
+      public:
+        Interpreter( void );
+
+        Interpreter( const Interpreter& ) = delete;
+
+        Interpreter& operator=( const Interpreter& ) = delete;
+
+        std::vector< BitConstant > run(
+            const Function& function, const std::vector< BitConstant >& arguments );
+
+        BitConstant load( const Variable& variable );
+
+        void store( const Variable& variable, const BitConstant& value );
+
+        BitConstant load( const Memory& memory, u32 index );
+
+        void store( const Memory& memory, u32 index, const BitConstant& value );
+
+        /**
+           number of operations executed by all runs so far
+        */
+
+        u64 executed( void ) const;
+
+      private:
+        class Decoder;
+
+        enum class Code : u8
+        {
+            MOVE,     // f[ dst ] = f[ lhs ]
+            ZERO,     // f[ dst ] = 0
+            LOADG,    // f[ dst ] = g[ imm ]
+            STOREG,   // g[ imm ] = f[ lhs ]
+            LOADI,    // f[ dst ] = g[ f[ lhs ] ]
+            STOREI,   // g[ f[ rhs ] ] = f[ lhs ]
+            ADDRESS,  // f[ dst ] = imm + f[ lhs ], f[ lhs ] < rhs
+            NOT,
+            LNOT,
+            AND,
+            OR,
+            XOR,
+            ADD,
+            DIVS,
+            MODU,
+            EQU,
+            NEQ,
+            MASK,  // f[ dst ] = f[ lhs ] & imm
+            JUMP,  // pc = imm
+            JZ,    // pc = imm if f[ lhs ] == 0
+            JNE,   // pc = imm if f[ lhs ] != rhs
+            CALL,  // program imm, arguments [ lhs, lhs + rhs ), results at dst
+            RETURN
+        };
+
+        struct Op
+        {
+            Code code;
+            u8 reserved;
+            u16 bits;
+            u32 dst;
+            u32 lhs;
+            u32 rhs;
+            u64 imm;  // mask, global slot, jump target or program index
+        };
+
+        struct Program
+        {
+            std::vector< Op > code;
+            std::vector< u64 > frame;      // initial frame with the constant slots
+            std::vector< u32 > arguments;  // caller slots of all call operations
+            std::vector< Type::Ptr > inputs;
+            std::vector< Type::Ptr > outputs;
+        };
+
+        u32 decode( const Function& function );
+
+        u32 global( const Value& value, u32 count );
+
+        u64 execute( u32 index, std::size_t base, u32 depth );
+
+        std::vector< Program > m_programs;
+
+        std::unordered_map< const Function*, u32 > m_index;
+
+        std::vector< u64 > m_globals;
+
+        std::unordered_map< const Value*, u32 > m_global;
+
+        std::vector< u64 > m_stack;
+
+        u64 m_executed;
+    };
+}
+
+#endif  // _LIBCJEL_IR_INTERPRETER_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -56,11 +56,31 @@
 
 using namespace libcjel_ir;
 
-Module::Module( const std::string& name )
+Module::Module( const std::string& name, u8 options )
 : User( name, libstdhl::Memory::get< VoidType >(), Value::MODULE )
+, m_arena( ( options & ARENA ) ? libstdhl::Memory::make< Arena >() : nullptr )
+, m_index( ( options & INDEX ) ? new std::array< Kind, Value::_SIZE_ >() : nullptr )
 {
 }
 
+Module::~Module( void )
+{
+    if( not m_index )
+    {
+        return;
+    }
+
+    for( std::size_t c = 0; c < m_index->size(); c++ )
+    {
+        std::lock_guard< std::mutex > guard( lock( c ) );
+
+        for( auto object : ( *m_index )[ c ].objects )
+        {
+            object->m_index.store( nullptr, std::memory_order_release );
+        }
+    }
+}
+
 void Module::add( const Value::Ptr& value )
 {
     if( isa< Structure >( value ) )
@@ -97,6 +117,55 @@ void Module::add( const Value::Ptr& value )
     }
 }
 
+u1 Module::hasArena( void ) const
+{
+    return m_arena != nullptr;
+}
+
+Arena::Ptr Module::arena( void ) const
+{
+    return m_arena;
+}
+
+u1 Module::hasIndex( void ) const
+{
+    return m_index != nullptr;
+}
+
+void Module::attach( Value& value ) const
+{
+    assert( m_index and value.m_index == nullptr );
+
+    auto& kind = ( *m_index )[ value.id() ];
+    std::lock_guard< std::mutex > guard( lock( value.id() ) );
+
+    value.m_slot = kind.objects.size();
+    kind.objects.push_back( &value );
+    value.m_index.store( const_cast< Module* >( this ), std::memory_order_release );
+}
+
+void Module::detach( Value& value )
+{
+    std::lock_guard< std::mutex > guard( lock( value.id() ) );
+
+    // the module may have released its values in the meantime
+    const auto module = value.m_index.load( std::memory_order_relaxed );
+    if( not module )
+    {
+        return;
+    }
+
+    auto& kind = ( *module->m_index )[ value.id() ];
+
+    // swap-remove keeps the kind vector dense in O(1)
+    auto last = kind.objects.back();
+    kind.objects[ value.m_slot ] = last;
+    last->m_slot = value.m_slot;
+    kind.objects.pop_back();
+
+    value.m_index.store( nullptr, std::memory_order_release );
+}
+
 std::size_t Module::hash( void ) const
 {
     return libstdhl::Hash::combine( classid(), std::hash< std::string >()( name() ) );
@@ -42,9 +42,14 @@
 #ifndef _LIBCJEL_IR_MODULE_H_
 #define _LIBCJEL_IR_MODULE_H_
 
+#include <libcjel-ir/Arena>
 #include <libcjel-ir/User>
 
+#include <libstdhl/Memory>
+
+#include <array>
 #include <cassert>
+#include <mutex>
 
 namespace libcjel_ir
 {
@@ -53,10 +58,98 @@ namespace libcjel_ir
       public:
         using Ptr = std::shared_ptr< Module >;
 
-        Module( const std::string& name );
+        enum Option : u8
+        {
+            NONE = 0,
+            ARENA = 1 << 0,  // allocate objects of 'make' from a module arena
+            INDEX = 1 << 1   // track objects of 'make' in a per-kind index
+        };
+
+        Module( const std::string& name, u8 options = NONE );
+
+        ~Module( void );
 
         void add( const Value::Ptr& value );
 
+        /**
+           creates a new IR object for this module, in arena mode the object
+           and its shared pointer control block are placed in the slabs of
+           the module arena, otherwise it is a regular heap allocation
+
+           constants of a 'ConstantPool' bound to this module and references
+           of the 'CallableUnit::in/out/link' overloads with this module are
+           created here as well, all other objects (e.g. 'allocId' constants)
+           are heap allocations
+
+           concurrent builders may call 'make' on the same module, the arena
+           and the index synchronize other threads than the arena creator
+        */
+
+        template < typename T, typename... Args >
+        std::shared_ptr< T > make( Args&&... args ) const
+        {
+            std::shared_ptr< T > object;
+
+            if( m_arena )
+            {
+                object = std::allocate_shared< T >(
+                    Arena::Allocator< T >( m_arena ), std::forward< Args >( args )... );
+            }
+            else
+            {
+                object = libstdhl::Memory::make< T >( std::forward< Args >( args )... );
+            }
+
+            if( m_index )
+            {
+                attach( *object );
+            }
+
+            return object;
+        }
+
+        u1 hasArena( void ) const;
+
+        Arena::Ptr arena( void ) const;
+
+        u1 hasIndex( void ) const;
+
+        /**
+           returns a snapshot of all live objects created through 'make' whose
+           kind matches 'C', for a concrete kind this is a copy of one dense
+           vector, for an abstract kind (e.g. 'Instruction') all kind vectors
+           are inspected once
+        */
+
+        template < class C >
+        std::vector< C* > index( void ) const
+        {
+            std::vector< C* > result;
+
+            if( not m_index )
+            {
+                return result;
+            }
+
+            for( std::size_t c = 0; c < m_index->size(); c++ )
+            {
+                const auto& kind = ( *m_index )[ c ];
+                std::lock_guard< std::mutex > guard( lock( c ) );
+
+                if( kind.objects.size() == 0 or not C::classof( kind.objects.front() ) )
+                {
+                    continue;
+                }
+
+                for( auto object : kind.objects )
+                {
+                    result.push_back( static_cast< C* >( object ) );
+                }
+            }
+
+            return result;
+        }
+
         template < class C >
         bool has( void ) const
         {
@@ -64,10 +157,15 @@ namespace libcjel_ir
         }
 
         template < class C >
-        Values get( void ) const
+        const Values& get( void ) const
         {
+            static const Values empty;
+
             auto result = m_content.find( C::classid() );
-            assert( result != m_content.end() );
+            if( result == m_content.end() )
+            {
+                return empty;
+            }
             return result->second;
         }
 
@@ -81,7 +179,34 @@ namespace libcjel_ir
         static bool classof( Value const* obj );
 
       private:
+        void attach( Value& value ) const;
+
+        static void detach( Value& value );
+
+        /**
+           the index lock of a kind is shared by all modules, a value which
+           outlives its module detaches under the same lock which the module
+           destructor takes to release its values
+        */
+
+        static std::mutex& lock( std::size_t kind )
+        {
+            static std::array< std::mutex, Value::_SIZE_ > obj;
+            return obj[ kind ];
+        }
+
+        friend class Value;
+
         std::unordered_map< u32, Values > m_content;
+
+        Arena::Ptr m_arena;
+
+        struct Kind
+        {
+            std::vector< Value* > objects;
+        };
+
+        std::unique_ptr< std::array< Kind, Value::_SIZE_ > > m_index;
     };
 }
 
@@ -0,0 +1,164 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_MODULE_SCHEDULER_H_
+#define _LIBCJEL_IR_MODULE_SCHEDULER_H_
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/ThreadPool>
+#include <libcjel-ir/Variable>
+#include <libcjel-ir/Visitor>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    runs a pass over a module with function-local parallelism
+
+       The module-level objects (structures, constants, variables, memories
+       and interconnects) are processed first by the 'global' action, in
+       module order on the calling thread with one module context. Then the
+       'local' action processes the callable units (intrinsics and
+       functions) as parallel jobs of the thread pool. Every callable unit
+       gets its own context of type 'C', a context is therefore never shared
+       between threads. Finally the optional 'merge' action is called for
+       every callable unit and its context in module order on the calling
+       thread, so merged results do not depend on the scheduling. If local
+       actions throw, the exception of the first callable unit in module
+       order is rethrown and nothing is merged.
+
+       A local action may read the whole module and may modify the callable
+       unit it was called for: its statements, scopes, instructions and
+       their operands, as long as every new or removed operand is a value
+       of the same callable unit. New objects may be created through
+       'Module::make'. It must not
+
+       - add values to or remove values from the module,
+       - modify module-level objects or other callable units,
+       - add or remove uses of values outside of its callable unit (e.g. a
+         variable, a memory, a called function or a constant which is also
+         used by other callable units), their use lists are not
+         synchronized,
+       - create types or constants through the global caches
+         ('libstdhl::Memory::get', 'Constant::cache', ...), these have to
+         be created by the global action.
+
+       Constants created by a local action belong to its callable unit,
+       therefore every callable unit needs its own 'ConstantPool', e.g. as
+       part of its context 'C'. A pool is never shared between local
+       actions.
+    */
+
+    template < typename C = Context >
+    class ModuleScheduler final
+    {
+      public:
+        using GlobalAction = std::function< void( Value& value, C& cxt ) >;
+
+        using LocalAction = std::function< void( CallableUnit& callable, C& cxt ) >;
+
+        explicit ModuleScheduler( ThreadPool& pool )
+        : m_pool( pool )
+        {
+        }
+
+        void run( Module& module, const GlobalAction& global, const LocalAction& local,
+            const LocalAction& merge = nullptr )
+        {
+            C context;
+
+            for( const auto* objects : { &module.get< Structure >(),
+                     &module.get< Constant >(),
+                     &module.get< Variable >(),
+                     &module.get< Memory >(),
+                     &module.get< Interconnect >() } )
+            {
+                for( const auto& object : *objects )
+                {
+                    global( *object, context );
+                }
+            }
+
+            std::vector< CallableUnit* > callables;
+            for( const auto* objects : { &module.get< Intrinsic >(), &module.get< Function >() } )
+            {
+                for( const auto& object : *objects )
+                {
+                    callables.emplace_back( static_cast< CallableUnit* >( object.get() ) );
+                }
+            }
+
+            std::vector< C > contexts( callables.size() );
+
+            m_pool.parallel( callables.size(), [&callables, &contexts, &local]( u32 index ) {
+                local( *callables[ index ], contexts[ index ] );
+            } );
+
+            if( merge )
+            {
+                for( std::size_t c = 0; c < callables.size(); c++ )
+                {
+                    merge( *callables[ c ], contexts[ c ] );
+                }
+            }
+        }
+
+      private:
+        ThreadPool& m_pool;
+    };
+}
+
+#endif  // _LIBCJEL_IR_MODULE_SCHEDULER_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
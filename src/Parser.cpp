@@ -0,0 +1,1342 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Parser.h"
+
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Variable>
+
+#include <cassert>
+#include <cstring>
+
+using namespace libcjel_ir;
+
+namespace
+{
+    enum class Opcode : u8
+    {
+        NOP,
+        ALLOC,
+        ID,
+        LOAD,
+        STORE,
+        EXTRACT,
+        CAST,
+        CALL,
+        ICALL,
+        ZEXT,
+        TRUNC,
+        NOT,
+        LNOT,
+        AND,
+        OR,
+        XOR,
+        ADDU,
+        ADDS,
+        DIVS,
+        MODU,
+        EQU,
+        NEQ
+    };
+
+    struct Signature
+    {
+        const char* name;
+        Opcode opcode;
+        u8 operands;  // exact operand count, 'call' has at least one
+        u1 type;      // requires a '->' result type
+    };
+
+    // in the order of 'Opcode', the opcodes are interned first and the
+    // symbol of an opcode is its index
+    static const Signature SIGNATURES[] = {
+        { "nop", Opcode::NOP, 0, false },
+        { "alloc", Opcode::ALLOC, 0, true },
+        { "id", Opcode::ID, 1, false },
+        { "load", Opcode::LOAD, 1, false },
+        { "store", Opcode::STORE, 2, false },
+        { "extract", Opcode::EXTRACT, 2, false },
+        { "cast", Opcode::CAST, 2, false },
+        { "call", Opcode::CALL, 1, false },
+        { "icall", Opcode::ICALL, 2, false },
+        { "zext", Opcode::ZEXT, 1, true },
+        { "trunc", Opcode::TRUNC, 1, true },
+        { "not", Opcode::NOT, 1, false },
+        { "lnot", Opcode::LNOT, 1, false },
+        { "and", Opcode::AND, 2, false },
+        { "or", Opcode::OR, 2, false },
+        { "xor", Opcode::XOR, 2, false },
+        { "addu", Opcode::ADDU, 2, false },
+        { "adds", Opcode::ADDS, 2, false },
+        { "divs", Opcode::DIVS, 2, false },
+        { "modu", Opcode::MODU, 2, false },
+        { "equ", Opcode::EQU, 2, false },
+        { "neq", Opcode::NEQ, 2, false },
+    };
+
+    static const u32 OPCODES = sizeof( SIGNATURES ) / sizeof( SIGNATURES[ 0 ] );
+
+    // interned after the opcodes
+    enum Keyword : u32
+    {
+        STRUCT = OPCODES,
+        VARIABLE,
+        MEMORY,
+        INTRINSIC,
+        FUNCTION,
+        BRANCH,
+        LOOP
+    };
+
+    static const char* const KEYWORDS[] = {
+        "struct", "variable", "memory", "intrinsic", "function", "branch", "loop"
+    };
+
+    inline u64 hash( const char* text, std::size_t length )
+    {
+        // FNV-1a
+        u64 result = 0xcbf29ce484222325;
+        for( std::size_t c = 0; c < length; c++ )
+        {
+            result = ( result ^ (u8)text[ c ] ) * 0x100000001b3;
+        }
+        return result;
+    }
+
+    inline u1 isIdentifier( char c )
+    {
+        return ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+               ( c >= '0' and c <= '9' ) or c == '_';
+    }
+}
+
+constexpr std::size_t Parser::ChunkSize;
+constexpr Parser::Symbol Parser::NoSymbol;
+constexpr u64 Parser::NoElement;
+
+Parser::Parser( const Module::Ptr& module, std::size_t chunksize )
+: m_module( module )
+, m_constants( module.get() )
+, m_input( nullptr )
+, m_chunksize( chunksize )
+, m_cursor( nullptr )
+, m_end( nullptr )
+, m_mark( nullptr )
+, m_token( Token::END )
+, m_text( nullptr )
+, m_length( 0 )
+, m_symbol( NoSymbol )
+, m_line( 1 )
+{
+    if( not m_module )
+    {
+        throw std::domain_error( "module of 'Parser' cannot be a null pointer" );
+    }
+
+    if( m_chunksize == 0 )
+    {
+        throw std::domain_error( "chunk size of 'Parser' cannot be '0'" );
+    }
+
+    m_slots.resize( 256, NoSymbol );
+
+    for( const auto& signature : SIGNATURES )
+    {
+        intern( signature.name, std::strlen( signature.name ) );
+    }
+
+    for( const auto keyword : KEYWORDS )
+    {
+        intern( keyword, std::strlen( keyword ) );
+    }
+
+    assert( m_names.size() == LOOP + 1 );
+}
+
+void Parser::parse( std::istream& input )
+{
+    m_input = &input;
+    m_cursor = m_end = m_mark = nullptr;
+    m_line = 1;
+
+    run();
+
+    m_input = nullptr;
+}
+
+void Parser::parse( const std::string& input )
+{
+    m_input = nullptr;
+    m_cursor = m_mark = input.data();
+    m_end = input.data() + input.size();
+    m_line = 1;
+
+    run();
+}
+
+const Module::Ptr& Parser::module( void ) const
+{
+    return m_module;
+}
+
+//
+//
+// Lexer
+//
+
+u1 Parser::fill( void )
+{
+    if( not m_input or not *m_input )
+    {
+        return false;
+    }
+
+    // keep the partially scanned token starting at 'm_mark'
+    const std::size_t keep = m_end - m_mark;
+    const std::size_t cursor = m_cursor - m_mark;
+
+    if( keep > 0 and m_mark != m_buffer.data() )
+    {
+        std::memmove( m_buffer.data(), m_mark, keep );
+    }
+
+    if( m_buffer.size() < keep + m_chunksize )
+    {
+        m_buffer.resize( keep + m_chunksize );
+    }
+
+    m_input->read( m_buffer.data() + keep, m_chunksize );
+    const std::size_t count = m_input->gcount();
+
+    m_mark = m_buffer.data();
+    m_cursor = m_mark + cursor;
+    m_end = m_mark + keep + count;
+
+    return count > 0;
+}
+
+char Parser::peek( std::size_t offset )
+{
+    while( m_cursor + offset >= m_end )
+    {
+        if( not fill() )
+        {
+            return '\0';
+        }
+    }
+
+    return m_cursor[ offset ];
+}
+
+void Parser::next( void )
+{
+    while( true )
+    {
+        if( m_cursor == m_end )
+        {
+            m_mark = m_cursor;
+            if( not fill() )
+            {
+                m_token = Token::END;
+                m_length = 0;
+                return;
+            }
+        }
+
+        const char c = *m_cursor;
+
+        if( c == '\n' )
+        {
+            m_line++;
+            m_cursor++;
+        }
+        else if( c == ' ' or c == '\t' or c == '\r' )
+        {
+            m_cursor++;
+        }
+        else if( c == '/' )
+        {
+            m_mark = m_cursor;
+            if( peek( 1 ) != '/' )
+            {
+                error( "unexpected character '/'" );
+            }
+
+            while( true )
+            {
+                if( m_cursor == m_end )
+                {
+                    m_mark = m_cursor;
+                    if( not fill() )
+                    {
+                        break;
+                    }
+                }
+
+                if( *m_cursor == '\n' )
+                {
+                    break;
+                }
+
+                m_cursor++;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    m_mark = m_cursor;
+    const char c = *m_cursor;
+    std::size_t length = 1;
+
+    switch( c )
+    {
+        case '{':
+        {
+            if( peek( 1 ) == '|' )
+            {
+                m_token = Token::SEQ_BEGIN;
+                length = 2;
+            }
+            else
+            {
+                m_token = Token::PAR_BEGIN;
+            }
+            break;
+        }
+        case '|':
+        {
+            if( peek( 1 ) != '}' )
+            {
+                error( "unexpected character '|'" );
+            }
+            m_token = Token::SEQ_END;
+            length = 2;
+            break;
+        }
+        case '-':
+        {
+            if( peek( 1 ) != '>' )
+            {
+                error( "unexpected character '-'" );
+            }
+            m_token = Token::ARROW;
+            length = 2;
+            break;
+        }
+        case '}':
+        {
+            m_token = Token::PAR_END;
+            break;
+        }
+        case '[':
+        {
+            m_token = Token::STMT_BEGIN;
+            break;
+        }
+        case ']':
+        {
+            m_token = Token::STMT_END;
+            break;
+        }
+        case '(':
+        {
+            m_token = Token::LPAREN;
+            break;
+        }
+        case ')':
+        {
+            m_token = Token::RPAREN;
+            break;
+        }
+        case ',':
+        {
+            m_token = Token::COMMA;
+            break;
+        }
+        case ';':
+        {
+            m_token = Token::SEMICOLON;
+            break;
+        }
+        case ':':
+        {
+            m_token = Token::COLON;
+            break;
+        }
+        case '=':
+        {
+            m_token = Token::ASSIGN;
+            break;
+        }
+        case '.':
+        {
+            m_token = Token::DOT;
+            break;
+        }
+        default:
+        {
+            if( not isIdentifier( c ) )
+            {
+                error( std::string( "unexpected character '" ) + c + "'" );
+            }
+
+            m_token = ( c >= '0' and c <= '9' ) ? Token::NUMBER : Token::NAME;
+            m_cursor++;
+
+            while( true )
+            {
+                if( m_cursor == m_end and not fill() )
+                {
+                    break;
+                }
+
+                if( not isIdentifier( *m_cursor ) )
+                {
+                    break;
+                }
+
+                m_cursor++;
+            }
+
+            m_text = m_mark;
+            m_length = m_cursor - m_mark;
+            m_symbol = m_token == Token::NAME ? intern( m_text, m_length ) : NoSymbol;
+            return;
+        }
+    }
+
+    m_cursor += length;
+    m_text = m_mark;
+    m_length = length;
+}
+
+Parser::Symbol Parser::intern( const char* text, std::size_t length )
+{
+    const auto value = hash( text, length );
+    const auto mask = m_slots.size() - 1;
+
+    for( auto slot = value & mask;; slot = ( slot + 1 ) & mask )
+    {
+        const auto symbol = m_slots[ slot ];
+        if( symbol == NoSymbol )
+        {
+            const Symbol result = m_names.size();
+            m_names.emplace_back( text, length );
+            m_hashes.emplace_back( value );
+            m_slots[ slot ] = result;
+
+            // at most half of the slots are used
+            if( 2 * m_names.size() > m_slots.size() )
+            {
+                std::vector< Symbol > slots( 2 * m_slots.size(), NoSymbol );
+                const auto grown = slots.size() - 1;
+                for( Symbol c = 0; c < m_names.size(); c++ )
+                {
+                    auto next = m_hashes[ c ] & grown;
+                    while( slots[ next ] != NoSymbol )
+                    {
+                        next = ( next + 1 ) & grown;
+                    }
+                    slots[ next ] = c;
+                }
+                m_slots.swap( slots );
+            }
+
+            return result;
+        }
+
+        const auto& name = m_names[ symbol ];
+        if( m_hashes[ symbol ] == value and name.size() == length and
+            std::memcmp( name.data(), text, length ) == 0 )
+        {
+            return symbol;
+        }
+    }
+}
+
+Parser::Symbol Parser::qualify( Symbol prefix, Symbol segment, u1 create )
+{
+    const u64 key = ( (u64)prefix << 32 ) | segment;
+
+    const auto result = m_qualified.find( key );
+    if( result != m_qualified.end() )
+    {
+        return result->second;
+    }
+
+    if( not create )
+    {
+        return NoSymbol;
+    }
+
+    const auto name = spelling( prefix ) + "." + spelling( segment );
+    const auto symbol = intern( name.data(), name.size() );
+    m_qualified.emplace( key, symbol );
+    return symbol;
+}
+
+const std::string& Parser::spelling( Symbol symbol ) const
+{
+    return m_names[ symbol ];
+}
+
+template < typename T >
+void Parser::define( std::vector< T >& table, Symbol symbol, const T& value )
+{
+    if( table.size() <= symbol )
+    {
+        table.resize( symbol + 1 );
+    }
+    table[ symbol ] = value;
+}
+
+u1 Parser::is( Symbol keyword ) const
+{
+    return m_token == Token::NAME and m_symbol == keyword;
+}
+
+std::string Parser::text( void ) const
+{
+    return m_token == Token::END ? "end of input" : std::string( m_text, m_length );
+}
+
+void Parser::error( const std::string& message ) const
+{
+    throw std::domain_error( "line " + std::to_string( m_line ) + ": " + message );
+}
+
+void Parser::expect( Token token, const char* spelling )
+{
+    if( m_token != token )
+    {
+        error( std::string( "expected '" ) + spelling + "', found '" + text() + "'" );
+    }
+
+    next();
+}
+
+Parser::Symbol Parser::name( void )
+{
+    if( m_token != Token::NAME )
+    {
+        error( "expected a name, found '" + text() + "'" );
+    }
+
+    const auto result = m_symbol;
+    next();
+    return result;
+}
+
+u64 Parser::number( void )
+{
+    if( m_token != Token::NUMBER )
+    {
+        error( "expected a number, found '" + text() + "'" );
+    }
+
+    u64 result = 0;
+    u64 radix = 10;
+    std::size_t c = 0;
+
+    if( m_length > 2 and m_text[ 0 ] == '0' and ( m_text[ 1 ] == 'x' or m_text[ 1 ] == 'X' ) )
+    {
+        radix = 16;
+        c = 2;
+    }
+
+    for( ; c < m_length; c++ )
+    {
+        const char digit = m_text[ c ];
+        u64 value;
+
+        if( digit >= '0' and digit <= '9' )
+        {
+            value = digit - '0';
+        }
+        else if( radix == 16 and digit >= 'a' and digit <= 'f' )
+        {
+            value = digit - 'a' + 10;
+        }
+        else if( radix == 16 and digit >= 'A' and digit <= 'F' )
+        {
+            value = digit - 'A' + 10;
+        }
+        else
+        {
+            error( "invalid number '" + text() + "'" );
+        }
+
+        if( result > ( ~0ull - value ) / radix )
+        {
+            error( "number '" + text() + "' exceeds 64 bits" );
+        }
+
+        result = result * radix + value;
+    }
+
+    next();
+    return result;
+}
+
+//
+//
+// Parser
+//
+
+void Parser::run( void )
+{
+    next();
+
+    while( m_token != Token::END )
+    {
+        if( is( STRUCT ) )
+        {
+            structure();
+        }
+        else if( is( VARIABLE ) )
+        {
+            variable();
+        }
+        else if( is( MEMORY ) )
+        {
+            memory();
+        }
+        else if( is( INTRINSIC ) )
+        {
+            callable( false );
+        }
+        else if( is( FUNCTION ) )
+        {
+            callable( true );
+        }
+        else
+        {
+            error( "expected a module definition, found '" + text() + "'" );
+        }
+    }
+}
+
+void Parser::structure( void )
+{
+    next();
+    const auto identifier = name();
+
+    std::vector< StructureElement > elements;
+
+    expect( Token::PAR_BEGIN, "{" );
+    while( true )
+    {
+        const auto element = type();
+        elements.emplace_back( element, spelling( name() ) );
+
+        if( m_token != Token::COMMA )
+        {
+            break;
+        }
+        next();
+    }
+    expect( Token::PAR_END, "}" );
+
+    auto kind = m_module->make< Structure >( spelling( identifier ), elements );
+
+    const auto object = libstdhl::Memory::make< StructureType >( kind );
+
+    if( identifier < m_types.size() and m_types[ identifier ] )
+    {
+        error( "type '" + spelling( identifier ) + "' is already defined" );
+    }
+    define< Type::Ptr >( m_types, identifier, object );
+
+    m_module->add( kind );
+}
+
+void Parser::variable( void )
+{
+    next();
+    const auto identifier = name();
+
+    expect( Token::COLON, ":" );
+    const auto t = type();
+    expect( Token::ASSIGN, "=" );
+    const auto value = number();
+
+    auto object =
+        m_module->make< Variable >( t, m_constants.bit( t, value ), spelling( identifier ) );
+
+    if( symbol( identifier, false ) )
+    {
+        error( "symbol '" + spelling( identifier ) + "' is already defined" );
+    }
+    define< Value::Ptr >( m_globals, identifier, object );
+
+    m_module->add( object );
+}
+
+void Parser::memory( void )
+{
+    next();
+    const auto identifier = name();
+
+    expect( Token::COLON, ":" );
+    const auto t = type();
+    expect( Token::ARROW, "->" );
+    const auto length = number();
+
+    if( length == 0 or length > 0xffffffff )
+    {
+        error( "invalid memory length '" + std::to_string( length ) + "'" );
+    }
+
+    auto object = m_module->make< Memory >( spelling( identifier ), t, length );
+
+    if( symbol( identifier, false ) )
+    {
+        error( "symbol '" + spelling( identifier ) + "' is already defined" );
+    }
+    define< Value::Ptr >( m_globals, identifier, object );
+
+    m_module->add( object );
+}
+
+std::vector< StructureElement > Parser::parameters( void )
+{
+    std::vector< StructureElement > result;
+
+    expect( Token::LPAREN, "(" );
+    while( m_token != Token::RPAREN )
+    {
+        const auto t = type();
+        result.emplace_back( t, spelling( name() ) );
+
+        if( m_token != Token::COMMA )
+        {
+            break;
+        }
+        next();
+    }
+    expect( Token::RPAREN, ")" );
+
+    return result;
+}
+
+void Parser::callable( u1 function )
+{
+    next();
+    auto identifier = name();
+    while( m_token == Token::DOT )
+    {
+        next();
+        identifier = qualify( identifier, name(), true );
+    }
+
+    const auto inputs = parameters();
+    expect( Token::ARROW, "->" );
+    const auto outputs = parameters();
+
+    std::vector< Type::Ptr > arguments;
+    for( const auto& input : inputs )
+    {
+        arguments.emplace_back( std::get< 0 >( input ) );
+    }
+
+    std::vector< Type::Ptr > results;
+    for( const auto& output : outputs )
+    {
+        results.emplace_back( std::get< 0 >( output ) );
+    }
+
+    if( results.size() == 0 )
+    {
+        error( "callable '" + spelling( identifier ) + "' requires at least one output" );
+    }
+
+    const auto relation = libstdhl::Memory::make< RelationType >( results, arguments );
+
+    CallableUnit::Ptr object;
+    if( function )
+    {
+        object = m_module->make< Function >( spelling( identifier ), relation );
+    }
+    else
+    {
+        object = m_module->make< Intrinsic >( spelling( identifier ), relation );
+    }
+
+    if( symbol( identifier, false ) )
+    {
+        error( "symbol '" + spelling( identifier ) + "' is already defined" );
+    }
+    define< Value::Ptr >( m_globals, identifier, object );
+
+    const auto forget = [this]( void ) {
+        for( const auto local : m_defined )
+        {
+            m_locals[ local ] = nullptr;
+        }
+        m_defined.clear();
+    };
+
+    const auto add = [this]( const Reference::Ptr& reference ) {
+        const auto& name = reference->name();
+        const auto local = intern( name.data(), name.size() );
+        if( local >= m_locals.size() or not m_locals[ local ] )
+        {
+            define< Value::Ptr >( m_locals, local, reference );
+            m_defined.emplace_back( local );
+        }
+    };
+
+    forget();
+
+    for( const auto& parameter : inputs )
+    {
+        auto reference = m_module->make< Reference >(
+            std::get< 1 >( parameter ), std::get< 0 >( parameter ), Reference::INPUT );
+        reference->setCallable( object );
+        object->add( reference );
+        add( reference );
+    }
+
+    for( const auto& parameter : outputs )
+    {
+        auto reference = m_module->make< Reference >(
+            std::get< 1 >( parameter ), std::get< 0 >( parameter ), Reference::OUTPUT );
+        reference->setCallable( object );
+        object->add( reference );
+        add( reference );
+    }
+
+    if( function )
+    {
+        object->setContext( scope() );
+    }
+
+    forget();
+    m_module->add( object );
+}
+
+Type::Ptr Parser::type( void )
+{
+    if( m_token == Token::NUMBER )
+    {
+        const auto bitsize = number();
+        if( bitsize < 1 or bitsize > BitType::SizeMax )
+        {
+            error( "invalid bit size '" + std::to_string( bitsize ) + "'" );
+        }
+
+        return BitType::get( bitsize );
+    }
+
+    if( m_token == Token::NAME and m_length > 1 and m_text[ 0 ] == 'u' and
+        m_text[ 1 ] >= '0' and m_text[ 1 ] <= '9' )
+    {
+        u64 bitsize = 0;
+        for( std::size_t c = 1; c < m_length; c++ )
+        {
+            if( m_text[ c ] < '0' or m_text[ c ] > '9' or bitsize > BitType::SizeMax )
+            {
+                error( "invalid bit type '" + text() + "'" );
+            }
+            bitsize = bitsize * 10 + ( m_text[ c ] - '0' );
+        }
+
+        if( bitsize < 1 or bitsize > BitType::SizeMax )
+        {
+            error( "invalid bit type '" + text() + "'" );
+        }
+
+        next();
+        return BitType::get( bitsize );
+    }
+
+    const auto identifier = name();
+
+    if( identifier >= m_types.size() or not m_types[ identifier ] )
+    {
+        error( "unknown type '" + spelling( identifier ) + "'" );
+    }
+
+    return m_types[ identifier ];
+}
+
+Scope::Ptr Parser::scope( void )
+{
+    Scope::Ptr result;
+    Token end;
+
+    if( m_token == Token::SEQ_BEGIN )
+    {
+        result = m_module->make< SequentialScope >();
+        end = Token::SEQ_END;
+    }
+    else if( m_token == Token::PAR_BEGIN )
+    {
+        result = m_module->make< ParallelScope >();
+        end = Token::PAR_END;
+    }
+    else
+    {
+        error( "expected a scope, found '" + text() + "'" );
+    }
+
+    next();
+
+    while( m_token != end )
+    {
+        if( m_token == Token::END )
+        {
+            error( "unterminated scope" );
+        }
+
+        auto child = block();
+        child->setParent( result );
+        result->add( child );
+    }
+
+    next();
+    return result;
+}
+
+Block::Ptr Parser::block( void )
+{
+    if( m_token == Token::SEQ_BEGIN or m_token == Token::PAR_BEGIN )
+    {
+        return scope();
+    }
+
+    return statement();
+}
+
+Statement::Ptr Parser::statement( void )
+{
+    if( m_token == Token::STMT_BEGIN )
+    {
+        auto result = m_module->make< TrivialStatement >();
+        instructions( *result );
+        return result;
+    }
+
+    Statement::Ptr result;
+    const u1 loop = is( LOOP );
+
+    if( loop )
+    {
+        result = m_module->make< LoopStatement >();
+    }
+    else if( is( BRANCH ) )
+    {
+        result = m_module->make< BranchStatement >();
+    }
+    else
+    {
+        error( "expected a statement, found '" + text() + "'" );
+    }
+
+    next();
+    instructions( *result );
+
+    do
+    {
+        if( loop and result->scopes().size() > 0 )
+        {
+            error( "loop statements cannot have multiple scopes" );
+        }
+
+        auto child = scope();
+        child->setParent( result );
+        result->add( child );
+    } while( m_token == Token::SEQ_BEGIN or m_token == Token::PAR_BEGIN );
+
+    return result;
+}
+
+void Parser::instructions( Statement& statement )
+{
+    expect( Token::STMT_BEGIN, "[" );
+
+    while( true )
+    {
+        instruction( statement );
+
+        if( m_token != Token::SEMICOLON )
+        {
+            break;
+        }
+        next();
+    }
+
+    expect( Token::STMT_END, "]" );
+}
+
+Instruction::Ptr Parser::instruction( Statement& statement )
+{
+    auto label = NoSymbol;
+    auto opcode = name();
+
+    if( m_token == Token::ASSIGN )
+    {
+        next();
+        label = opcode;
+        opcode = name();
+    }
+
+    if( opcode >= OPCODES )
+    {
+        error( "unknown instruction '" + spelling( opcode ) + "'" );
+    }
+    const auto& signature = SIGNATURES[ opcode ];
+
+    // the operand buffer is reused, 'operand' does not parse instructions
+    auto& values = m_values;
+    values.clear();
+    if( m_token != Token::SEMICOLON and m_token != Token::STMT_END and m_token != Token::ARROW )
+    {
+        values.emplace_back( operand( statement ) );
+
+        while( m_token == Token::COMMA )
+        {
+            next();
+            values.emplace_back( operand( statement ) );
+        }
+    }
+
+    Type::Ptr target;
+    if( signature.type )
+    {
+        expect( Token::ARROW, "->" );
+        target = type();
+    }
+
+    if( signature.opcode == Opcode::CALL ? values.size() < signature.operands
+                                         : values.size() != signature.operands )
+    {
+        error( "instruction '" + spelling( opcode ) + "' expects " +
+               std::to_string( signature.operands ) + " operand(s)" );
+    }
+
+    if( signature.operands == 2 and signature.opcode >= Opcode::STORE and
+        ( signature.opcode == Opcode::STORE or signature.opcode >= Opcode::AND ) and
+        values[ 0 ]->type() != values[ 1 ]->type() )
+    {
+        error( "operand types '" + values[ 0 ]->type().name() + "' and '" +
+               values[ 1 ]->type().name() + "' of instruction '" + spelling( opcode ) +
+               "' do not match" );
+    }
+
+    const auto& m = *m_module;
+    Instruction::Ptr instr;
+
+    switch( signature.opcode )
+    {
+        case Opcode::NOP:
+        {
+            instr = m.make< NopInstruction >();
+            break;
+        }
+        case Opcode::ALLOC:
+        {
+            instr = m.make< AllocInstruction >( target );
+            break;
+        }
+        case Opcode::ID:
+        {
+            if( not isa< Variable >( values[ 0 ] ) and not isa< Function >( values[ 0 ] ) )
+            {
+                error( "instruction 'id' requires a variable or function operand" );
+            }
+            instr = m.make< IdInstruction >( values[ 0 ] );
+            break;
+        }
+        case Opcode::LOAD:
+        {
+            instr = m.make< LoadInstruction >( values[ 0 ] );
+            break;
+        }
+        case Opcode::STORE:
+        {
+            if( not values[ 0 ]->type().isBit() )
+            {
+                error( "instruction 'store' requires bit typed operands" );
+            }
+            instr = m.make< StoreInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::EXTRACT:
+        {
+            instr = m.make< ExtractInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::CAST:
+        {
+            if( not isa< CallableUnit >( values[ 0 ] ) and not isa< Structure >( values[ 0 ] ) )
+            {
+                error( "instruction 'cast' requires a callable or structure kind" );
+            }
+            instr = m.make< CastInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::CALL:
+        {
+            if( not isa< CallableUnit >( values[ 0 ] ) or
+                values[ 0 ]->type().results().size() != 1 )
+            {
+                error( "instruction 'call' requires a callable with one output" );
+            }
+            instr = m.make< CallInstruction >(
+                values[ 0 ], std::vector< Value::Ptr >( values.begin() + 1, values.end() ) );
+            break;
+        }
+        case Opcode::ICALL:
+        {
+            if( values[ 1 ]->type() != *BitType::get( 64 ) )
+            {
+                error( "instruction 'icall' requires a 'u64' symbol" );
+            }
+            instr = m.make< IdCallInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::ZEXT:
+        {
+            instr = m.make< ZeroExtendInstruction >( values[ 0 ], target );
+            break;
+        }
+        case Opcode::TRUNC:
+        {
+            instr = m.make< TruncationInstruction >( values[ 0 ], target );
+            break;
+        }
+        case Opcode::NOT:
+        {
+            instr = m.make< NotInstruction >( values[ 0 ] );
+            break;
+        }
+        case Opcode::LNOT:
+        {
+            instr = m.make< LnotInstruction >( values[ 0 ] );
+            break;
+        }
+        case Opcode::AND:
+        {
+            instr = m.make< AndInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::OR:
+        {
+            instr = m.make< OrInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::XOR:
+        {
+            instr = m.make< XorInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::ADDU:
+        {
+            instr = m.make< AddUnsignedInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::ADDS:
+        {
+            instr = m.make< AddSignedInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::DIVS:
+        {
+            instr = m.make< DivSignedInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::MODU:
+        {
+            instr = m.make< ModUnsignedInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::EQU:
+        {
+            instr = m.make< EquInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+        case Opcode::NEQ:
+        {
+            instr = m.make< NeqInstruction >( values[ 0 ], values[ 1 ] );
+            break;
+        }
+    }
+
+    statement.add( instr );
+
+    if( label != NoSymbol )
+    {
+        if( label < m_locals.size() and m_locals[ label ] )
+        {
+            error( "symbol '" + spelling( label ) + "' is already defined" );
+        }
+        define< Value::Ptr >( m_locals, label, instr );
+        m_defined.emplace_back( label );
+    }
+
+    return instr;
+}
+
+Value::Ptr Parser::operand( Statement& statement )
+{
+    if( m_token == Token::NUMBER )
+    {
+        const auto value = number();
+        expect( Token::COLON, ":" );
+        return m_constants.bit( type(), value );
+    }
+
+    // the prefixes are the qualified names of the leading segments
+    m_segments.assign( 1, name() );
+    m_prefixes.assign( 1, m_segments[ 0 ] );
+    while( m_token == Token::DOT )
+    {
+        next();
+        m_segments.emplace_back( name() );
+
+        const auto prefix = m_prefixes.back();
+        m_prefixes.emplace_back(
+            prefix != NoSymbol ? qualify( prefix, m_segments.back(), false ) : NoSymbol );
+    }
+
+    const auto& segments = m_segments;
+
+    // the longest qualified name wins, e.g. 'casmrt.inc.twice' over
+    // 'casmrt.inc', a shorter one is only taken with a structure element
+    for( std::size_t count = segments.size(); count > 0; count-- )
+    {
+        if( segments.size() - count > 1 or m_prefixes[ count - 1 ] == NoSymbol )
+        {
+            continue;
+        }
+
+        const auto value = symbol( m_prefixes[ count - 1 ], count == 1 );
+        if( not value )
+        {
+            continue;
+        }
+
+        if( count == segments.size() )
+        {
+            return value;
+        }
+
+        const auto index = element( *value, segments.back() );
+        if( index != NoElement )
+        {
+            auto instr = m_module->make< ExtractInstruction >(
+                value, m_constants.bit( BitType::get( 64 ), index ) );
+            statement.add( instr );
+            return instr;
+        }
+    }
+
+    const auto value = symbol( segments[ 0 ], true );
+    if( not value or segments.size() > 2 )
+    {
+        auto identifier = spelling( segments[ 0 ] );
+        for( std::size_t c = 1; c < segments.size(); c++ )
+        {
+            identifier += "." + spelling( segments[ c ] );
+        }
+        error( "unknown symbol '" + identifier + "'" );
+    }
+
+    if( not isa< Reference >( value ) or not value->type().isStructure() )
+    {
+        error( "symbol '" + spelling( segments[ 0 ] ) + "' is not a structure reference" );
+    }
+
+    const auto& kind = static_cast< const StructureType& >( value->type() ).kind();
+    error( "structure '" + kind.name() + "' has no element '" + spelling( segments[ 1 ] ) +
+           "'" );
+}
+
+Value::Ptr Parser::symbol( Symbol symbol, u1 local ) const
+{
+    if( local and symbol < m_locals.size() and m_locals[ symbol ] )
+    {
+        return m_locals[ symbol ];
+    }
+
+    return symbol < m_globals.size() ? m_globals[ symbol ] : nullptr;
+}
+
+u64 Parser::element( const Value& value, Symbol field ) const
+{
+    if( not isa< Reference >( value ) or not value.type().isStructure() )
+    {
+        return NoElement;
+    }
+
+    const auto& kind = static_cast< const StructureType& >( value.type() ).kind();
+    const auto& elements = kind.elements();
+
+    for( u64 index = 0; index < elements.size(); index++ )
+    {
+        if( std::get< 1 >( elements[ index ] ) == spelling( field ) )
+        {
+            return index;
+        }
+    }
+
+    return NoElement;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
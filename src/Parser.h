@@ -0,0 +1,260 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_PARSER_H_
+#define _LIBCJEL_IR_PARSER_H_
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Structure>
+
+#include <istream>
+#include <unordered_map>
+
+namespace libcjel_ir
+{
+    class Block;
+    class Scope;
+    class Statement;
+    class Instruction;
+
+    /**
+       @brief    single-pass reader of the textual CJEL IR syntax
+
+       The lexer and the recursive descent parser work on the same buffer
+       and create the IR objects directly in the target module, there is no
+       intermediate syntax tree. Stream inputs are consumed in chunks, only
+       the current token is retained when the buffer is refilled. Names are
+       interned once by the lexer, keywords, opcodes and symbols are looked
+       up by their interned number.
+
+       module      := { struct | variable | memory | intrinsic | function }
+       struct      := 'struct' NAME '{' type NAME { ',' type NAME } '}'
+       variable    := 'variable' NAME ':' type '=' NUMBER
+       memory      := 'memory' NAME ':' type '->' NUMBER
+       intrinsic   := 'intrinsic' signature
+       function    := 'function' signature scope
+       signature   := NAME { '.' NAME } '(' params ')' '->' '(' params ')'
+       params      := [ type NAME { ',' type NAME } ]
+       scope       := '{|' { block } '|}'               (sequential)
+                    | '{' { block } '}'                 (parallel)
+       block       := scope | statement
+       statement   := '[' instruction { ';' instruction } ']'
+                    | 'branch' '[' instructions ']' scope { scope }
+                    | 'loop' '[' instructions ']' scope
+       instruction := [ NAME '=' ] OPCODE [ operand { ',' operand } ] [ '->' type ]
+       operand     := NAME { '.' NAME } | NUMBER ':' type
+       type        := NUMBER | 'u'NUMBER | NAME
+
+       A bare number type is a bit type of that size, a structure element
+       operand 'ra.value' implicitly emits an 'extract' instruction and line
+       comments start with '//'. A dotted operand resolves to the longest
+       defined qualified name, optionally followed by one structure element.
+       Errors are reported as 'std::domain_error' including the line number.
+    */
+
+    class Parser final
+    {
+      public:
+        static constexpr std::size_t ChunkSize = 1 << 16;
+
+        Parser( const Module::Ptr& module, std::size_t chunksize = ChunkSize );
+
+        void parse( std::istream& input );
+
+        void parse( const std::string& input );
+
+        const Module::Ptr& module( void ) const;
+
+      private:
+        enum class Token : u8
+        {
+            END,
+            NAME,
+            NUMBER,
+            SEQ_BEGIN,  // {|
+            SEQ_END,    // |}
+            PAR_BEGIN,  // {
+            PAR_END,    // }
+            STMT_BEGIN,  // [
+            STMT_END,    // ]
+            LPAREN,
+            RPAREN,
+            COMMA,
+            SEMICOLON,
+            COLON,
+            ASSIGN,
+            DOT,
+            ARROW
+        };
+
+        // lexer
+
+        void next( void );
+
+        u1 fill( void );
+
+        char peek( std::size_t offset );
+
+        using Symbol = u32;
+
+        static constexpr Symbol NoSymbol = ~( (u32)0 );
+
+        Symbol intern( const char* text, std::size_t length );
+
+        Symbol qualify( Symbol prefix, Symbol segment, u1 create );
+
+        const std::string& spelling( Symbol symbol ) const;
+
+        u1 is( Symbol keyword ) const;
+
+        std::string text( void ) const;
+
+        [[noreturn]] void error( const std::string& message ) const;
+
+        void expect( Token token, const char* spelling );
+
+        Symbol name( void );
+
+        u64 number( void );
+
+        // parser
+
+        void run( void );
+
+        void structure( void );
+
+        void variable( void );
+
+        void memory( void );
+
+        void callable( u1 function );
+
+        std::vector< StructureElement > parameters( void );
+
+        Type::Ptr type( void );
+
+        std::shared_ptr< Scope > scope( void );
+
+        std::shared_ptr< Block > block( void );
+
+        std::shared_ptr< Statement > statement( void );
+
+        void instructions( Statement& statement );
+
+        std::shared_ptr< Instruction > instruction( Statement& statement );
+
+        Value::Ptr operand( Statement& statement );
+
+        Value::Ptr symbol( Symbol symbol, u1 local ) const;
+
+        static constexpr u64 NoElement = ~( (u64)0 );
+
+        u64 element( const Value& value, Symbol field ) const;
+
+        template < typename T >
+        static void define( std::vector< T >& table, Symbol symbol, const T& value );
+
+        Module::Ptr m_module;
+
+        ConstantPool m_constants;
+
+        // interned names, their open addressing slots and the
+        // qualified name of a prefix and a segment
+        std::vector< std::string > m_names;
+
+        std::vector< u64 > m_hashes;
+
+        std::vector< Symbol > m_slots;
+
+        std::unordered_map< u64, Symbol > m_qualified;
+
+        // definitions indexed by symbol
+        std::vector< Type::Ptr > m_types;
+
+        std::vector< Value::Ptr > m_globals;
+
+        std::vector< Value::Ptr > m_locals;
+
+        std::vector< Symbol > m_defined;
+
+        // operand segments and their qualified prefixes
+        std::vector< Symbol > m_segments;
+
+        std::vector< Symbol > m_prefixes;
+
+        std::vector< Value::Ptr > m_values;
+
+        std::istream* m_input;
+
+        std::size_t m_chunksize;
+
+        std::vector< char > m_buffer;
+
+        const char* m_cursor;
+
+        const char* m_end;
+
+        const char* m_mark;
+
+        Token m_token;
+
+        const char* m_text;
+
+        std::size_t m_length;
+
+        Symbol m_symbol;
+
+        u64 m_line;
+    };
+}
+
+#endif  // _LIBCJEL_IR_PARSER_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,139 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Scheduler.h"
+
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+
+using namespace libcjel_ir;
+
+constexpr u64 Scheduler::GrainSize;
+
+Scheduler::Scheduler( ThreadPool& pool, u64 grainsize )
+: m_pool( pool )
+, m_grainsize( grainsize )
+{
+}
+
+void Scheduler::run( const Scope& scope, const Action& action )
+{
+    process( scope, action, true );
+}
+
+u64 Scheduler::grainsize( void ) const
+{
+    return m_grainsize;
+}
+
+void Scheduler::process( const Block& block, const Action& action, u1 parallel )
+{
+    if( isa< Statement >( block ) )
+    {
+        action( static_cast< const Statement& >( block ) );
+        return;
+    }
+
+    const auto& blocks = static_cast< const Scope& >( block ).blocks();
+
+    if( parallel and block.isParallel() and blocks.size() > 1 )
+    {
+        u64 budget = m_grainsize;
+        if( small( block, budget ) )
+        {
+            parallel = false;
+        }
+        else
+        {
+            m_pool.parallel( blocks.size(), [this, &blocks, &action]( u32 index ) {
+                process( *blocks[ index ], action, true );
+            } );
+            return;
+        }
+    }
+
+    for( const auto& child : blocks )
+    {
+        process( *child, action, parallel );
+    }
+}
+
+u1 Scheduler::small( const Block& block, u64& budget ) const
+{
+    if( isa< Statement >( block ) )
+    {
+        const auto& statement = static_cast< const Statement& >( block );
+        const auto instructions = statement.instructions().size();
+        if( instructions > budget )
+        {
+            return false;
+        }
+        budget -= instructions;
+
+        for( const auto& scope : statement.scopes() )
+        {
+            if( not small( *scope, budget ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    for( const auto& child : static_cast< const Scope& >( block ).blocks() )
+    {
+        if( not small( *child, budget ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
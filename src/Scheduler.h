@@ -0,0 +1,104 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_SCHEDULER_H_
+#define _LIBCJEL_IR_SCHEDULER_H_
+
+#include <libcjel-ir/ThreadPool>
+
+namespace libcjel_ir
+{
+    class Block;
+    class Scope;
+    class Statement;
+
+    /**
+       @brief    schedules the blocks of a scope tree onto a thread pool
+
+       The blocks of a sequential scope are processed in order, the blocks of
+       a parallel scope are processed as parallel jobs of the thread pool.
+       A parallel scope with at most 'grainsize' instructions (including all
+       nested blocks) is processed inline together with all of its nested
+       blocks, so that job overhead does not dominate small scopes.
+
+       The action is called once per statement of the scope tree, the scopes
+       of branch and loop statements are left to the action (e.g. to decide
+       which scope to execute) which can schedule them by a nested 'run' call.
+       Results stay deterministic as long as the actions of the blocks of a
+       parallel scope do not depend on each other, which is the semantics of
+       a parallel scope.
+    */
+
+    class Scheduler final
+    {
+      public:
+        static constexpr u64 GrainSize = 64;
+
+        using Action = std::function< void( const Statement& ) >;
+
+        Scheduler( ThreadPool& pool, u64 grainsize = GrainSize );
+
+        void run( const Scope& scope, const Action& action );
+
+        u64 grainsize( void ) const;
+
+      private:
+        void process( const Block& block, const Action& action, u1 parallel );
+
+        u1 small( const Block& block, u64& budget ) const;
+
+        ThreadPool& m_pool;
+
+        u64 m_grainsize;
+    };
+}
+
+#endif  // _LIBCJEL_IR_SCHEDULER_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
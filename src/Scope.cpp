@@ -46,6 +46,13 @@
 
 using namespace libcjel_ir;
 
+// scopes share the label type
+static const Type::Ptr& labelType( void )
+{
+    static const Type::Ptr obj = libstdhl::Memory::get< LabelType >();
+    return obj;
+}
+
 //
 // Scope
 //
@@ -65,11 +72,28 @@ void Scope::add( const Block::Ptr& block )
     m_blocks.add( block );
 }
 
-Blocks Scope::blocks( void ) const
+const Blocks& Scope::blocks( void ) const
 {
     return m_blocks;
 }
 
+u32 Scope::remove( const std::function< u1( const Block& ) >& predicate )
+{
+    Blocks blocks;
+
+    for( const auto& block : m_blocks )
+    {
+        if( not predicate( *block ) )
+        {
+            blocks.add( block );
+        }
+    }
+
+    const u32 removed = m_blocks.size() - blocks.size();
+    m_blocks = std::move( blocks );
+    return removed;
+}
+
 std::size_t Scope::hash( void ) const
 {
     return libstdhl::Hash::combine( classid(), std::hash< std::string >()( name() ) );
@@ -86,7 +110,7 @@ bool Scope::classof( Value const* obj )
 //
 
 SequentialScope::SequentialScope( void )
-: Scope( "seq", libstdhl::Memory::get< LabelType >(), false, classid() )
+: Scope( "seq", labelType(), false, classid() )
 {
 }
 
@@ -100,7 +124,7 @@ bool SequentialScope::classof( Value const* obj )
 //
 
 ParallelScope::ParallelScope( void )
-: Scope( "par", libstdhl::Memory::get< LabelType >(), false, classid() )
+: Scope( "par", labelType(), true, classid() )
 {
 }
 
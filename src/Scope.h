@@ -44,6 +44,8 @@
 
 #include <libcjel-ir/Block>
 
+#include <functional>
+
 namespace libcjel_ir
 {
     class Scope : public Block
@@ -56,7 +58,14 @@ namespace libcjel_ir
 
         void add( const Block::Ptr& block );
 
-        Blocks blocks( void ) const;
+        const Blocks& blocks( void ) const;
+
+        /**
+           removes every block for which 'predicate' holds and keeps the order
+           of the others, returns the number of removed blocks
+        */
+
+        u32 remove( const std::function< u1( const Block& ) >& predicate );
 
         std::size_t hash( void ) const override;
 
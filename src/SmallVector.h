@@ -0,0 +1,251 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_SMALL_VECTOR_H_
+#define _LIBCJEL_IR_SMALL_VECTOR_H_
+
+#include <libcjel-ir/CjelIR>
+
+#include <new>
+#include <utility>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    vector with inline capacity
+
+       Stores up to 'N' elements inside the object itself and only moves
+       them to the heap when more elements are added. Elements are stored
+       contiguously in both cases, but every growth invalidates pointers
+       and references to them.
+    */
+
+    template < typename T, u32 N >
+    class SmallVector final
+    {
+      public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        SmallVector( void )
+        : m_data( local() )
+        , m_size( 0 )
+        , m_capacity( N )
+        {
+        }
+
+        ~SmallVector( void )
+        {
+            clear();
+            release();
+        }
+
+        SmallVector( const SmallVector& ) = delete;
+
+        SmallVector& operator=( const SmallVector& ) = delete;
+
+        T& operator[]( u32 position )
+        {
+            return m_data[ position ];
+        }
+
+        const T& operator[]( u32 position ) const
+        {
+            return m_data[ position ];
+        }
+
+        T* data( void )
+        {
+            return m_data;
+        }
+
+        const T* data( void ) const
+        {
+            return m_data;
+        }
+
+        iterator begin( void )
+        {
+            return m_data;
+        }
+
+        iterator end( void )
+        {
+            return m_data + m_size;
+        }
+
+        const_iterator begin( void ) const
+        {
+            return m_data;
+        }
+
+        const_iterator end( void ) const
+        {
+            return m_data + m_size;
+        }
+
+        u32 size( void ) const
+        {
+            return m_size;
+        }
+
+        u32 capacity( void ) const
+        {
+            return m_capacity;
+        }
+
+        u1 empty( void ) const
+        {
+            return m_size == 0;
+        }
+
+        T& back( void )
+        {
+            return m_data[ m_size - 1 ];
+        }
+
+        const T& back( void ) const
+        {
+            return m_data[ m_size - 1 ];
+        }
+
+        /**
+           true as long as the elements are stored inside the object
+        */
+
+        u1 isInline( void ) const
+        {
+            return m_data == local();
+        }
+
+        void reserve( u32 capacity )
+        {
+            if( capacity <= m_capacity )
+            {
+                return;
+            }
+
+            auto data = static_cast< T* >( ::operator new( capacity * sizeof( T ) ) );
+            for( u32 c = 0; c < m_size; c++ )
+            {
+                new( data + c ) T( std::move( m_data[ c ] ) );
+                m_data[ c ].~T();
+            }
+
+            release();
+            m_data = data;
+            m_capacity = capacity;
+        }
+
+        template < typename... Args >
+        T& emplace_back( Args&&... args )
+        {
+            if( m_size < m_capacity )
+            {
+                new( m_data + m_size ) T( std::forward< Args >( args )... );
+            }
+            else
+            {
+                // the arguments may refer to an element of this vector
+                T value( std::forward< Args >( args )... );
+                reserve( 2 * m_capacity );
+                new( m_data + m_size ) T( std::move( value ) );
+            }
+
+            return m_data[ m_size++ ];
+        }
+
+        void pop_back( void )
+        {
+            m_data[ --m_size ].~T();
+        }
+
+        void clear( void )
+        {
+            for( u32 c = 0; c < m_size; c++ )
+            {
+                m_data[ c ].~T();
+            }
+
+            m_size = 0;
+        }
+
+      private:
+        T* local( void )
+        {
+            return reinterpret_cast< T* >( m_local );
+        }
+
+        const T* local( void ) const
+        {
+            return reinterpret_cast< const T* >( m_local );
+        }
+
+        void release( void )
+        {
+            if( not isInline() )
+            {
+                ::operator delete( m_data );
+            }
+        }
+
+        alignas( T ) u8 m_local[ N * sizeof( T ) ];
+
+        T* m_data;
+
+        u32 m_size;
+
+        u32 m_capacity;
+    };
+}
+
+#endif  // _LIBCJEL_IR_SMALL_VECTOR_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -45,6 +45,13 @@
 
 using namespace libcjel_ir;
 
+// statements share the label type, it is looked up once and not per statement
+static const Type::Ptr& labelType( void )
+{
+    static const Type::Ptr obj = libstdhl::Memory::get< LabelType >();
+    return obj;
+}
+
 //
 // Statement
 //
@@ -54,7 +61,7 @@ Statement::Statement( const std::string& name, const Type::Ptr& type, Value::ID
 {
 }
 
-Instructions Statement::instructions( void ) const
+const Instructions& Statement::instructions( void ) const
 {
     return m_instructions;
 }
@@ -71,6 +78,23 @@ Instruction::Ptr Statement::add( const Instruction::Ptr& instruction )
     return instruction;
 }
 
+u32 Statement::remove( const std::function< u1( const Instruction& ) >& predicate )
+{
+    Instructions instructions;
+
+    for( const auto& instruction : m_instructions )
+    {
+        if( not predicate( *instruction ) )
+        {
+            instructions.add( instruction );
+        }
+    }
+
+    const u32 removed = m_instructions.size() - instructions.size();
+    m_instructions = std::move( instructions );
+    return removed;
+}
+
 void Statement::add( const Scope::Ptr& scope )
 {
     if( not scope )
@@ -95,7 +119,7 @@ void Statement::add( const Scope::Ptr& scope )
     m_scopes.add( scope );
 }
 
-Scopes Statement::scopes( void ) const
+const Scopes& Statement::scopes( void ) const
 {
     return m_scopes;
 }
@@ -111,7 +135,7 @@ bool Statement::classof( Value const* obj )
 //
 
 TrivialStatement::TrivialStatement( Value* parent )
-: Statement( "stmt", libstdhl::Memory::get< LabelType >(), classid() )
+: Statement( "stmt", labelType(), classid() )
 {
 }
 
@@ -125,7 +149,7 @@ bool TrivialStatement::classof( Value const* obj )
 //
 
 BranchStatement::BranchStatement( Value* parent )
-: Statement( "branch", libstdhl::Memory::get< LabelType >(), classid() )
+: Statement( "branch", labelType(), classid() )
 {
 }
 
@@ -139,7 +163,7 @@ bool BranchStatement::classof( Value const* obj )
 //
 
 LoopStatement::LoopStatement( Value* parent )
-: Statement( "loop", libstdhl::Memory::get< LabelType >(), classid() )
+: Statement( "loop", labelType(), classid() )
 {
 }
 
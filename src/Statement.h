@@ -49,6 +49,8 @@
 #include <libcjel-ir/Scope>
 #include <libcjel-ir/Value>
 
+#include <functional>
+
 namespace libcjel_ir
 {
     class Statement : public Block
@@ -58,18 +60,25 @@ namespace libcjel_ir
 
         Statement( const std::string& name, const Type::Ptr& type, Value::ID id = classid() );
 
-        Instructions instructions( void ) const;
+        const Instructions& instructions( void ) const;
 
         Instruction::Ptr add( const Instruction::Ptr& instruction );
 
+        /**
+           removes every instruction for which 'predicate' holds and keeps the
+           order of the others, returns the number of removed instructions
+        */
+
+        u32 remove( const std::function< u1( const Instruction& ) >& predicate );
+
         void add( const Scope::Ptr& scope );
 
-        Scopes scopes( void ) const;
+        const Scopes& scopes( void ) const;
 
         template < typename C >
         u1 consistsOnlyOf( void ) const
         {
-            for( auto instruction : instructions() )
+            for( const auto& instruction : instructions() )
             {
                 if( not isa< C >( instruction ) )
                 {
@@ -0,0 +1,263 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_STATIC_VISITOR_H_
+#define _LIBCJEL_IR_STATIC_VISITOR_H_
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Traverser>
+#include <libcjel-ir/Variable>
+#include <libcjel-ir/Visitor>
+
+#include <cassert>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    statically dispatched visitor base
+
+       Alternative to the virtual 'Visitor' for passes which are only
+       interested in a few stages and value classes. The derived class
+       implements only the hooks it needs with the signatures of the
+       'LIBCJEL_IR_VISITOR_INTERFACE', e.g.
+
+       class Counter final : public StaticVisitor< Counter >
+       {
+         public:
+           void visit_prolog( LoadInstruction& value, Context& cxt );
+       };
+
+       A hook may also take a base class, 'visit_prolog( Instruction&,
+       Context& )' receives every instruction. The hooks are resolved at
+       compile time, a missing hook results in no code at all and the
+       present ones can be inlined into the traversal. Hooks have to be
+       accessible from 'StaticVisitor', otherwise they are ignored.
+    */
+
+    template < typename Derived >
+    class StaticVisitor
+    {
+      public:
+        void dispatch( Visitor::Stage stage, Value& value, Context& cxt );
+
+        void iterate( Value& value, Traversal order, Context& cxt )
+        {
+            Traverser::iterate(
+                value, order, static_cast< Derived* >( this ), cxt, []( Value& ) {} );
+        }
+
+      private:
+        template < typename V, typename T >
+        static auto prolog( V& visitor, T& value, Context& cxt, int )
+            -> decltype( visitor.visit_prolog( value, cxt ), void() )
+        {
+            visitor.visit_prolog( value, cxt );
+        }
+
+        template < typename V, typename T >
+        static void prolog( V&, T&, Context&, long )
+        {
+        }
+
+        template < typename V, typename T >
+        static auto interlog( V& visitor, T& value, Context& cxt, int )
+            -> decltype( visitor.visit_interlog( value, cxt ), void() )
+        {
+            visitor.visit_interlog( value, cxt );
+        }
+
+        template < typename V, typename T >
+        static void interlog( V&, T&, Context&, long )
+        {
+        }
+
+        template < typename V, typename T >
+        static auto epilog( V& visitor, T& value, Context& cxt, int )
+            -> decltype( visitor.visit_epilog( value, cxt ), void() )
+        {
+            visitor.visit_epilog( value, cxt );
+        }
+
+        template < typename V, typename T >
+        static void epilog( V&, T&, Context&, long )
+        {
+        }
+    };
+
+    /**
+       all dispatched value IDs and their classes, the classes with an
+       INTERLOG stage are listed in 'LIBCJEL_IR_STATIC_VISITOR_INTERLOG_VALUES_'
+    */
+
+#define LIBCJEL_IR_STATIC_VISITOR_VALUES_( CASE )                                                  \
+    CASE( MODULE, Module );                                                                        \
+    CASE( FUNCTION, Function );                                                                    \
+    CASE( INTRINSIC, Intrinsic );                                                                  \
+    CASE( REFERENCE, Reference );                                                                  \
+    CASE( VARIABLE, Variable );                                                                    \
+    CASE( MEMORY, Memory );                                                                        \
+    CASE( STRUCTURE, Structure );                                                                  \
+    CASE( BIT_CONSTANT, BitConstant );                                                             \
+    CASE( STRING_CONSTANT, StringConstant );                                                       \
+    CASE( STRUCTURE_CONSTANT, StructureConstant );                                                 \
+    CASE( PARALLEL_SCOPE, ParallelScope );                                                         \
+    CASE( SEQUENTIAL_SCOPE, SequentialScope );                                                     \
+    CASE( TRIVIAL_STATEMENT, TrivialStatement );                                                   \
+    CASE( BRANCH_STATEMENT, BranchStatement );                                                     \
+    CASE( LOOP_STATEMENT, LoopStatement );                                                         \
+    CASE( CALL_INSTRUCTION, CallInstruction );                                                     \
+    CASE( ID_CALL_INSTRUCTION, IdCallInstruction );                                                \
+    CASE( STREAM_INSTRUCTION, StreamInstruction );                                                 \
+    CASE( NOP_INSTRUCTION, NopInstruction );                                                       \
+    CASE( ALLOC_INSTRUCTION, AllocInstruction );                                                   \
+    CASE( ID_INSTRUCTION, IdInstruction );                                                         \
+    CASE( CAST_INSTRUCTION, CastInstruction );                                                     \
+    CASE( EXTRACT_INSTRUCTION, ExtractInstruction );                                               \
+    CASE( LOAD_INSTRUCTION, LoadInstruction );                                                     \
+    CASE( STORE_INSTRUCTION, StoreInstruction );                                                   \
+    CASE( NOT_INSTRUCTION, NotInstruction );                                                       \
+    CASE( LNOT_INSTRUCTION, LnotInstruction );                                                     \
+    CASE( AND_INSTRUCTION, AndInstruction );                                                       \
+    CASE( OR_INSTRUCTION, OrInstruction );                                                         \
+    CASE( XOR_INSTRUCTION, XorInstruction );                                                       \
+    CASE( ADDU_INSTRUCTION, AddUnsignedInstruction );                                              \
+    CASE( ADDS_INSTRUCTION, AddSignedInstruction );                                                \
+    CASE( DIVS_INSTRUCTION, DivSignedInstruction );                                                \
+    CASE( MODU_INSTRUCTION, ModUnsignedInstruction );                                              \
+    CASE( EQU_INSTRUCTION, EquInstruction );                                                       \
+    CASE( NEQ_INSTRUCTION, NeqInstruction );                                                       \
+    CASE( ZEXT_INSTRUCTION, ZeroExtendInstruction );                                               \
+    CASE( TRUNC_INSTRUCTION, TruncationInstruction );                                              \
+    CASE( INTERCONNECT, Interconnect );
+
+#define LIBCJEL_IR_STATIC_VISITOR_INTERLOG_VALUES_( CASE )                                         \
+    CASE( FUNCTION, Function );                                                                    \
+    CASE( INTRINSIC, Intrinsic );                                                                  \
+    CASE( BRANCH_STATEMENT, BranchStatement );                                                     \
+    CASE( LOOP_STATEMENT, LoopStatement );
+
+#define LIBCJEL_IR_STATIC_VISITOR_CASE_( STAGE, VID, CLASS )                                       \
+    case Value::ID::VID:                                                                           \
+        STAGE( visitor, static_cast< CLASS& >( value ), cxt, 0 );                                  \
+        break
+
+#define LIBCJEL_IR_STATIC_VISITOR_PROLOG_( VID, CLASS )                                            \
+    LIBCJEL_IR_STATIC_VISITOR_CASE_( prolog, VID, CLASS )
+#define LIBCJEL_IR_STATIC_VISITOR_INTERLOG_( VID, CLASS )                                          \
+    LIBCJEL_IR_STATIC_VISITOR_CASE_( interlog, VID, CLASS )
+#define LIBCJEL_IR_STATIC_VISITOR_EPILOG_( VID, CLASS )                                            \
+    LIBCJEL_IR_STATIC_VISITOR_CASE_( epilog, VID, CLASS )
+
+    template < typename Derived >
+    inline void StaticVisitor< Derived >::dispatch(
+        Visitor::Stage stage, Value& value, Context& cxt )
+    {
+        auto& visitor = static_cast< Derived& >( *this );
+
+        // one switch per stage, cases without a hook are folded away
+        switch( stage )
+        {
+            case Visitor::Stage::PROLOG:
+            {
+                switch( value.id() )
+                {
+                    LIBCJEL_IR_STATIC_VISITOR_VALUES_( LIBCJEL_IR_STATIC_VISITOR_PROLOG_ );
+                    default:
+                        assert( !"unimplemented value ID to dispatch!" );
+                        break;
+                }
+                break;
+            }
+            case Visitor::Stage::INTERLOG:
+            {
+                switch( value.id() )
+                {
+                    LIBCJEL_IR_STATIC_VISITOR_INTERLOG_VALUES_(
+                        LIBCJEL_IR_STATIC_VISITOR_INTERLOG_ );
+                    default:
+                        assert( !"invalid visitor stage value!" );
+                        break;
+                }
+                break;
+            }
+            case Visitor::Stage::EPILOG:
+            {
+                switch( value.id() )
+                {
+                    LIBCJEL_IR_STATIC_VISITOR_VALUES_( LIBCJEL_IR_STATIC_VISITOR_EPILOG_ );
+                    default:
+                        assert( !"unimplemented value ID to dispatch!" );
+                        break;
+                }
+                break;
+            }
+        }
+    }
+
+#undef LIBCJEL_IR_STATIC_VISITOR_VALUES_
+#undef LIBCJEL_IR_STATIC_VISITOR_INTERLOG_VALUES_
+#undef LIBCJEL_IR_STATIC_VISITOR_CASE_
+#undef LIBCJEL_IR_STATIC_VISITOR_PROLOG_
+#undef LIBCJEL_IR_STATIC_VISITOR_INTERLOG_
+#undef LIBCJEL_IR_STATIC_VISITOR_EPILOG_
+}
+
+#endif  // _LIBCJEL_IR_STATIC_VISITOR_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,365 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Statistics.h"
+
+#include <libcjel-ir/CallableUnit>
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Type>
+#include <libcjel-ir/Variable>
+#include <libcjel-ir/Visitor>
+
+#include <cstdio>
+#include <unordered_set>
+
+using namespace libcjel_ir;
+
+/**
+   all constructible value IDs and their classes
+*/
+
+#define LIBCJEL_IR_STATISTICS_VALUES_( CASE )                                                      \
+    CASE( MODULE, Module );                                                                        \
+    CASE( INTERCONNECT, Interconnect );                                                            \
+    CASE( MEMORY, Memory );                                                                        \
+    CASE( INTRINSIC, Intrinsic );                                                                  \
+    CASE( FUNCTION, Function );                                                                    \
+    CASE( VARIABLE, Variable );                                                                    \
+    CASE( REFERENCE, Reference );                                                                  \
+    CASE( STRUCTURE, Structure );                                                                  \
+    CASE( VOID_CONSTANT, VoidConstant );                                                           \
+    CASE( BIT_CONSTANT, BitConstant );                                                             \
+    CASE( STRUCTURE_CONSTANT, StructureConstant );                                                 \
+    CASE( STRING_CONSTANT, StringConstant );                                                       \
+    CASE( IDENTIFIER, Identifier );                                                                \
+    CASE( PARALLEL_SCOPE, ParallelScope );                                                         \
+    CASE( SEQUENTIAL_SCOPE, SequentialScope );                                                     \
+    CASE( TRIVIAL_STATEMENT, TrivialStatement );                                                   \
+    CASE( BRANCH_STATEMENT, BranchStatement );                                                     \
+    CASE( LOOP_STATEMENT, LoopStatement );                                                         \
+    CASE( NOP_INSTRUCTION, NopInstruction );                                                       \
+    CASE( ALLOC_INSTRUCTION, AllocInstruction );                                                   \
+    CASE( ID_INSTRUCTION, IdInstruction );                                                         \
+    CASE( CAST_INSTRUCTION, CastInstruction );                                                     \
+    CASE( EXTRACT_INSTRUCTION, ExtractInstruction );                                               \
+    CASE( LOAD_INSTRUCTION, LoadInstruction );                                                     \
+    CASE( STORE_INSTRUCTION, StoreInstruction );                                                   \
+    CASE( CALL_INSTRUCTION, CallInstruction );                                                     \
+    CASE( ID_CALL_INSTRUCTION, IdCallInstruction );                                                \
+    CASE( STREAM_INSTRUCTION, StreamInstruction );                                                 \
+    CASE( NOT_INSTRUCTION, NotInstruction );                                                       \
+    CASE( LNOT_INSTRUCTION, LnotInstruction );                                                     \
+    CASE( AND_INSTRUCTION, AndInstruction );                                                       \
+    CASE( OR_INSTRUCTION, OrInstruction );                                                         \
+    CASE( XOR_INSTRUCTION, XorInstruction );                                                       \
+    CASE( ADDS_INSTRUCTION, AddSignedInstruction );                                                \
+    CASE( ADDU_INSTRUCTION, AddUnsignedInstruction );                                              \
+    CASE( DIVS_INSTRUCTION, DivSignedInstruction );                                                \
+    CASE( MODU_INSTRUCTION, ModUnsignedInstruction );                                              \
+    CASE( EQU_INSTRUCTION, EquInstruction );                                                       \
+    CASE( NEQ_INSTRUCTION, NeqInstruction );                                                       \
+    CASE( ZEXT_INSTRUCTION, ZeroExtendInstruction );                                               \
+    CASE( TRUNC_INSTRUCTION, TruncationInstruction );
+
+namespace
+{
+    /**
+       heap bytes of a string, nothing if it fits into the small buffer
+    */
+
+    static u64 heap( const std::string& text )
+    {
+        const auto data = reinterpret_cast< const char* >( text.data() );
+        const auto self = reinterpret_cast< const char* >( &text );
+
+        if( data >= self and data < self + sizeof( text ) )
+        {
+            return 0;
+        }
+
+        return text.capacity() + 1;
+    }
+
+    template < typename Map >
+    static u64 table( const Map& map )
+    {
+        // one bucket pointer per bucket and one node per entry
+        return map.bucket_count() * sizeof( void* ) +
+               map.size() * ( sizeof( void* ) + sizeof( std::size_t ) +
+                              sizeof( typename Map::value_type ) );
+    }
+}
+
+std::array< Statistics::Counter, Value::_SIZE_ > Statistics::s_counters;
+
+void Statistics::construct( Value::ID id )
+{
+    auto& counter = s_counters[ id ];
+
+    const auto count = counter.count.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+    auto peak = counter.peak.load( std::memory_order_relaxed );
+    while( count > peak and
+           not counter.peak.compare_exchange_weak( peak, count, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+void Statistics::destruct( Value::ID id )
+{
+    s_counters[ id ].count.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+Statistics::Entries Statistics::live( void )
+{
+    Entries result;
+
+    for( u32 c = 0; c < Value::_SIZE_; c++ )
+    {
+        const auto id = static_cast< Value::ID >( c );
+        auto& entry = result[ c ];
+
+        entry.count = s_counters[ c ].count.load( std::memory_order_relaxed );
+        entry.peak = s_counters[ c ].peak.load( std::memory_order_relaxed );
+        entry.bytes = entry.count * size( id );
+    }
+
+    return result;
+}
+
+Statistics::Entries Statistics::collect( Value& value )
+{
+    Entries result;
+    std::unordered_set< const Value* > operands;
+
+    const auto account = [&result]( const Value& value ) {
+        auto& entry = result[ value.id() ];
+        entry.count++;
+        entry.peak++;
+        entry.bytes += size( value.id() ) + owned( value );
+    };
+
+    value.iterate( PREORDER, [&]( Value& value ) {
+        account( value );
+
+        const auto user = cast< User >( value );
+        if( not user )
+        {
+            return;
+        }
+
+        // constants are only reachable as operands and may be shared
+        for( u32 c = 0; c < user->arity(); c++ )
+        {
+            const auto& operand = user->operand( c );
+            if( operand and isa< Constant >( operand ) and
+                operands.emplace( operand.get() ).second )
+            {
+                account( *operand );
+            }
+        }
+    } );
+
+    return result;
+}
+
+std::vector< Statistics::Cache > Statistics::caches( void )
+{
+    const auto& types = Type::s_cache();
+    const auto& constants = Constant::cache();
+    const auto& structures = Structure::make_cache();
+
+    return {
+        { "Type::s_cache", types.size(), table( types ) },
+        { "Constant::cache", constants.size(), table( constants ) },
+        { "Structure::make_cache", structures.size(), table( structures ) },
+    };
+}
+
+u64 Statistics::owned( const Value& value )
+{
+    u64 result = heap( value.m_name );
+
+    if( not value.m_uses.isInline() )
+    {
+        result += value.m_uses.capacity() * sizeof( Value::Use );
+    }
+
+    if( const auto user = cast< User >( value ) )
+    {
+        // inline operands are part of the object size
+        if( not user->m_operands.isInline() )
+        {
+            result += user->m_operands.capacity() * sizeof( Value::Ptr );
+        }
+        if( not user->m_slots.isInline() )
+        {
+            result += user->m_slots.capacity() * sizeof( u32 );
+        }
+    }
+
+    if( const auto statement = cast< Statement >( value ) )
+    {
+        result += ( statement->instructions().size() + statement->scopes().size() ) *
+                  sizeof( Value::Ptr );
+    }
+    else if( const auto scope = cast< Scope >( value ) )
+    {
+        result += scope->blocks().size() * sizeof( Value::Ptr );
+    }
+    else if( const auto callable = cast< CallableUnit >( value ) )
+    {
+        result += ( callable->inputs().capacity() + callable->outputs().capacity() +
+                      callable->linkage().capacity() ) *
+                  sizeof( Value::Ptr );
+    }
+
+    return result;
+}
+
+u64 Statistics::size( Value::ID id )
+{
+#define LIBCJEL_IR_STATISTICS_SIZE_( VID, CLASS )                                                  \
+    case Value::ID::VID:                                                                           \
+        return sizeof( CLASS )
+
+    switch( id )
+    {
+        LIBCJEL_IR_STATISTICS_VALUES_( LIBCJEL_IR_STATISTICS_SIZE_ );
+        default:
+            return sizeof( Value );
+    }
+
+#undef LIBCJEL_IR_STATISTICS_SIZE_
+}
+
+std::string Statistics::name( Value::ID id )
+{
+#define LIBCJEL_IR_STATISTICS_NAME_( VID, CLASS )                                                  \
+    case Value::ID::VID:                                                                           \
+        return #CLASS
+
+    switch( id )
+    {
+        LIBCJEL_IR_STATISTICS_VALUES_( LIBCJEL_IR_STATISTICS_NAME_ );
+        default:
+            return "Value(" + std::to_string( id ) + ")";
+    }
+
+#undef LIBCJEL_IR_STATISTICS_NAME_
+}
+
+std::string Statistics::report( Value* value )
+{
+    std::string result;
+    char line[ 160 ];
+
+    const auto print = [&result, &line]( const std::string& name, const Entry& entry ) {
+        snprintf( line, sizeof( line ), "%-24s %12llu %12llu %14llu\n", name.c_str(),
+            (unsigned long long)entry.count, (unsigned long long)entry.peak,
+            (unsigned long long)entry.bytes );
+        result += line;
+    };
+
+    const auto section = [&]( const std::string& title, const Entries& entries ) {
+        snprintf( line, sizeof( line ), "%-24s %12s %12s %14s\n", title.c_str(), "count", "peak",
+            "bytes" );
+        result += line;
+
+        Entry total;
+        for( u32 c = 0; c < Value::_SIZE_; c++ )
+        {
+            const auto& entry = entries[ c ];
+            if( entry.count == 0 and entry.peak == 0 )
+            {
+                continue;
+            }
+
+            print( name( static_cast< Value::ID >( c ) ), entry );
+            total.count += entry.count;
+            total.peak += entry.peak;
+            total.bytes += entry.bytes;
+        }
+
+        print( "total", total );
+        result += "\n";
+    };
+
+    if( value )
+    {
+        section( value->name(), collect( *value ) );
+    }
+
+    section( "live", live() );
+
+    snprintf( line, sizeof( line ), "%-24s %12s %12s %14s\n", "cache", "entries", "", "bytes" );
+    result += line;
+    for( const auto& cache : caches() )
+    {
+        snprintf( line, sizeof( line ), "%-24s %12llu %12s %14llu\n", cache.name.c_str(),
+            (unsigned long long)cache.entries, "", (unsigned long long)cache.bytes );
+        result += line;
+    }
+
+    return result;
+}
+
+#undef LIBCJEL_IR_STATISTICS_VALUES_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,149 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_STATISTICS_H_
+#define _LIBCJEL_IR_STATISTICS_H_
+
+#include <libcjel-ir/Value>
+
+#include <array>
+#include <atomic>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    memory accounting of the IR per value kind
+
+       Every constructed and destroyed value updates the process-wide live
+       and peak count of its kind with relaxed atomic operations only, the
+       accounting is therefore always enabled. The bytes of the process-wide
+       statistics are the object sizes of the live values.
+
+       'collect' inspects a value and all its children (the operands of
+       users included) and reports the bytes of every kind including the
+       owned storage, i.e. the heap allocated name, the operand storage of
+       users, the use lists and the child lists of statements, scopes and
+       callable units. Shared pointer control blocks and arena slack are not
+       part of the bytes.
+
+       'caches' reports the global caches, their entries and an estimate of
+       their table bytes.
+    */
+
+    class Statistics final
+    {
+      public:
+        struct Entry
+        {
+            u64 count = 0;
+            u64 peak = 0;
+            u64 bytes = 0;
+        };
+
+        using Entries = std::array< Entry, Value::_SIZE_ >;
+
+        struct Cache
+        {
+            std::string name;
+            u64 entries;
+            u64 bytes;
+        };
+
+        /**
+           process-wide live values per kind, the bytes are the object sizes
+        */
+
+        static Entries live( void );
+
+        /**
+           values of 'value' and its children per kind, the peak equals the
+           count
+        */
+
+        static Entries collect( Value& value );
+
+        static std::vector< Cache > caches( void );
+
+        /**
+           heap bytes owned by 'value' without the object itself
+        */
+
+        static u64 owned( const Value& value );
+
+        static u64 size( Value::ID id );
+
+        static std::string name( Value::ID id );
+
+        /**
+           text table of the non-empty kinds of 'collect' (if a value is
+           given) and 'live' and all caches
+        */
+
+        static std::string report( Value* value = nullptr );
+
+      private:
+        struct alignas( 64 ) Counter
+        {
+            std::atomic< u64 > count;
+            std::atomic< u64 > peak;
+        };
+
+        static void construct( Value::ID id );
+
+        static void destruct( Value::ID id );
+
+        static std::array< Counter, Value::_SIZE_ > s_counters;
+
+        friend class Value;
+    };
+}
+
+#endif  // _LIBCJEL_IR_STATISTICS_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
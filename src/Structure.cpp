@@ -67,7 +67,7 @@ Structure::Structure( const std::string& name, const std::vector< StructureEleme
     }
 }
 
-StructureElement Structure::element( std::size_t index ) const
+const StructureElement& Structure::element( std::size_t index ) const
 {
     if( index >= m_elements.size() )
     {
@@ -78,7 +78,7 @@ StructureElement Structure::element( std::size_t index ) const
     return m_elements[ index ];
 }
 
-StructureElement Structure::element( const std::string& name ) const
+const StructureElement& Structure::element( const std::string& name ) const
 {
     const auto result = m_element2index.find( name );
     if( result == m_element2index.end() )
@@ -90,7 +90,7 @@ StructureElement Structure::element( const std::string& name ) const
     return m_elements[ result->second ];
 }
 
-std::vector< StructureElement > Structure::elements( void ) const
+const std::vector< StructureElement >& Structure::elements( void ) const
 {
     return m_elements;
 }
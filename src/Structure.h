@@ -57,11 +57,11 @@ namespace libcjel_ir
 
         Structure( const std::string& name, const std::vector< StructureElement >& elements );
 
-        StructureElement element( std::size_t index ) const;
+        const StructureElement& element( std::size_t index ) const;
 
-        StructureElement element( const std::string& name ) const;
+        const StructureElement& element( const std::string& name ) const;
 
-        std::vector< StructureElement > elements( void ) const;
+        const std::vector< StructureElement >& elements( void ) const;
 
         std::size_t hash( void ) const override;
 
@@ -78,7 +78,7 @@ namespace libcjel_ir
         std::unordered_map< std::string, std::size_t > m_element2index;
 
       public:
-        std::unordered_map< std::string, Structure::Ptr >& make_cache( void )
+        static std::unordered_map< std::string, Structure::Ptr >& make_cache( void )
         {
             static std::unordered_map< std::string, Structure::Ptr > cache;
             return cache;
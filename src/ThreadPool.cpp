@@ -0,0 +1,262 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "ThreadPool.h"
+
+using namespace libcjel_ir;
+
+// queue of the current thread, 'nullptr' for threads outside of every pool
+static thread_local const ThreadPool* s_pool = nullptr;
+static thread_local u32 s_queue = 0;
+
+ThreadPool::ThreadPool( u32 workers )
+: m_jobs( 0 )
+, m_stop( false )
+{
+    // the last queue is shared by all threads outside of the pool
+    for( u32 c = 0; c <= workers; c++ )
+    {
+        m_queues.emplace_back( new Queue() );
+    }
+
+    for( u32 c = 0; c < workers; c++ )
+    {
+        m_threads.emplace_back( &ThreadPool::loop, this, c );
+    }
+}
+
+ThreadPool::~ThreadPool( void )
+{
+    {
+        std::lock_guard< std::mutex > guard( m_lock );
+        m_stop = true;
+    }
+    m_wakeup.notify_all();
+
+    for( auto& thread : m_threads )
+    {
+        thread.join();
+    }
+}
+
+u32 ThreadPool::workers( void ) const
+{
+    return m_threads.size();
+}
+
+u32 ThreadPool::defaultWorkers( void )
+{
+    const u32 concurrency = std::thread::hardware_concurrency();
+    return concurrency > 1 ? concurrency - 1 : 0;
+}
+
+ThreadPool& ThreadPool::shared( void )
+{
+    static ThreadPool obj;
+    return obj;
+}
+
+void ThreadPool::parallel( u32 count, const std::function< void( u32 ) >& task )
+{
+    if( count == 0 )
+    {
+        return;
+    }
+
+    Group group;
+    group.task = &task;
+    group.pending = count;
+    group.errors.resize( count );
+
+    if( count > 1 and m_threads.size() > 0 )
+    {
+        const auto current = queue();
+        auto& owner = *m_queues[ current ];
+        {
+            // counted before they are published, a thief decrements only
+            // after taking a job under this lock, the counter cannot wrap
+            std::lock_guard< std::mutex > guard( owner.lock );
+            m_jobs += count - 1;
+
+            // pushed in reverse, the owner continues with index 1
+            for( u32 c = count - 1; c > 0; c-- )
+            {
+                owner.jobs.emplace_back( Job{ &group, c } );
+            }
+        }
+
+        {
+            std::lock_guard< std::mutex > guard( m_lock );
+        }
+        m_wakeup.notify_all();
+
+        run( Job{ &group, 0 } );
+
+        while( group.pending.load( std::memory_order_acquire ) > 0 )
+        {
+            if( execute( current ) )
+            {
+                continue;
+            }
+
+            // nothing left to steal, sleep until the last job of the group
+            // finishes or new jobs are published
+            std::unique_lock< std::mutex > lock( m_lock );
+            m_wakeup.wait( lock, [this, &group]() {
+                return group.pending.load( std::memory_order_acquire ) == 0 or m_jobs > 0;
+            } );
+        }
+    }
+    else
+    {
+        for( u32 c = 0; c < count; c++ )
+        {
+            run( Job{ &group, c } );
+        }
+    }
+
+    for( const auto& error : group.errors )
+    {
+        if( error )
+        {
+            std::rethrow_exception( error );
+        }
+    }
+}
+
+void ThreadPool::loop( u32 queue )
+{
+    s_pool = this;
+    s_queue = queue;
+
+    while( true )
+    {
+        if( execute( queue ) )
+        {
+            continue;
+        }
+
+        std::unique_lock< std::mutex > lock( m_lock );
+        m_wakeup.wait( lock, [this]() { return m_stop or m_jobs > 0; } );
+
+        if( m_stop )
+        {
+            return;
+        }
+    }
+}
+
+u32 ThreadPool::queue( void ) const
+{
+    return s_pool == this ? s_queue : m_queues.size() - 1;
+}
+
+u1 ThreadPool::execute( u32 queue )
+{
+    Job job;
+    u1 found = false;
+
+    {
+        auto& own = *m_queues[ queue ];
+        std::lock_guard< std::mutex > guard( own.lock );
+        if( not own.jobs.empty() )
+        {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    for( u32 c = 1; not found and c < m_queues.size(); c++ )
+    {
+        auto& victim = *m_queues[ ( queue + c ) % m_queues.size() ];
+        std::lock_guard< std::mutex > guard( victim.lock );
+        if( not victim.jobs.empty() )
+        {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if( not found )
+    {
+        return false;
+    }
+
+    m_jobs--;
+    run( job );
+    return true;
+}
+
+void ThreadPool::run( const Job& job )
+{
+    auto& group = *job.group;
+
+    try
+    {
+        ( *group.task )( job.index );
+    }
+    catch( ... )
+    {
+        group.errors[ job.index ] = std::current_exception();
+    }
+
+    // the waiting thread may release the group as soon as it observes
+    // zero, only the pool is accessed afterwards
+    if( group.pending.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+    {
+        {
+            std::lock_guard< std::mutex > guard( m_lock );
+        }
+        m_wakeup.notify_all();
+    }
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,156 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_THREAD_POOL_H_
+#define _LIBCJEL_IR_THREAD_POOL_H_
+
+#include <libcjel-ir/CjelIR>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    work-stealing fork-join thread pool
+
+       Every worker owns a job queue, it takes its own jobs in LIFO order and
+       steals the oldest jobs of other queues when it runs out of work.
+       Threads outside of the pool share one additional queue. A thread
+       waiting for a fork-join 'parallel' call keeps executing queued jobs,
+       therefore nested 'parallel' calls from inside jobs cannot deadlock,
+       and sleeps only while there is nothing left to execute.
+    */
+
+    class ThreadPool final
+    {
+      public:
+        /**
+           creates a pool with 'workers' threads in addition to the calling
+           thread, by default one less than the hardware concurrency
+        */
+
+        explicit ThreadPool( u32 workers = defaultWorkers() );
+
+        ~ThreadPool( void );
+
+        ThreadPool( const ThreadPool& ) = delete;
+
+        ThreadPool& operator=( const ThreadPool& ) = delete;
+
+        u32 workers( void ) const;
+
+        /**
+           calls 'task' for all indices in [ 0, count ) and returns when all
+           calls are finished, the calling thread executes index 0 itself. If
+           calls throw, the exception of the lowest index is rethrown after
+           all calls are finished.
+        */
+
+        void parallel( u32 count, const std::function< void( u32 ) >& task );
+
+        static u32 defaultWorkers( void );
+
+        /**
+           process-wide pool with the default number of workers, created on
+           first use, for callers which do not manage a pool of their own
+        */
+
+        static ThreadPool& shared( void );
+
+      private:
+        struct Group
+        {
+            const std::function< void( u32 ) >* task;
+            std::atomic< u32 > pending;
+            std::vector< std::exception_ptr > errors;
+        };
+
+        struct Job
+        {
+            Group* group;
+            u32 index;
+        };
+
+        struct Queue
+        {
+            std::mutex lock;
+            std::deque< Job > jobs;
+        };
+
+        void loop( u32 queue );
+
+        u32 queue( void ) const;
+
+        u1 execute( u32 queue );
+
+        void run( const Job& job );
+
+        std::vector< std::unique_ptr< Queue > > m_queues;
+
+        std::vector< std::thread > m_threads;
+
+        std::atomic< u64 > m_jobs;
+
+        std::atomic< u1 > m_stop;
+
+        std::mutex m_lock;
+
+        std::condition_variable m_wakeup;
+    };
+}
+
+#endif  // _LIBCJEL_IR_THREAD_POOL_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,201 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "Traverser.h"
+
+#include <libcjel-ir/CallableUnit>
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Variable>
+
+#include <cassert>
+
+using namespace libcjel_ir;
+
+thread_local std::vector< Traverser::Frame > Traverser::s_frames;
+
+Traverser::Stack::Stack( void )
+: frames( s_frames )
+, base( s_frames.size() )
+{
+}
+
+Traverser::Stack::~Stack( void )
+{
+    frames.erase( frames.begin() + base, frames.end() );
+}
+
+template < typename List >
+static inline Value* at( const List& list, u32& index )
+{
+    if( index < list.size() )
+    {
+        return ( list.begin() + ( index++ ) )->get();
+    }
+
+    return nullptr;
+}
+
+static const Values& content( const Module& module, u32 phase )
+{
+    switch( phase )
+    {
+        case 0:
+            return module.get< Structure >();
+        case 1:
+            return module.get< Constant >();
+        case 2:
+            return module.get< Variable >();
+        case 3:
+            return module.get< Memory >();
+        case 4:
+            return module.get< Interconnect >();
+        case 5:
+            return module.get< Intrinsic >();
+        default:
+            return module.get< Function >();
+    }
+}
+
+Value* Traverser::next( Frame& frame )
+{
+    Value& value = *frame.value;
+
+    switch( frame.kind )
+    {
+        case Kind::MODULE:
+        {
+            const auto& module = static_cast< const Module& >( value );
+
+            for( ; frame.phase < 7; frame.phase++, frame.index = 0 )
+            {
+                if( auto child = at( content( module, frame.phase ), frame.index ) )
+                {
+                    return child;
+                }
+            }
+            return nullptr;
+        }
+        case Kind::CALLABLE_UNIT:
+        {
+            const auto& obj = static_cast< const CallableUnit& >( value );
+
+            if( frame.phase == 0 )
+            {
+                if( auto child = at( obj.inputs(), frame.index ) )
+                {
+                    return child;
+                }
+
+                frame.phase = 1;
+                frame.index = 0;
+            }
+
+            if( frame.phase == 1 )
+            {
+                if( auto child = at( obj.outputs(), frame.index ) )
+                {
+                    return child;
+                }
+
+                frame.phase = 2;
+                return nullptr;
+            }
+
+            if( frame.phase == 2 )
+            {
+                frame.phase = 3;
+
+                assert( obj.context() );
+                return obj.context().get();
+            }
+            return nullptr;
+        }
+        case Kind::STATEMENT:
+        {
+            return at( static_cast< const Statement& >( value ).scopes(), frame.index );
+        }
+        case Kind::SCOPE:
+        {
+            return at( static_cast< const Scope& >( value ).blocks(), frame.index );
+        }
+        case Kind::STRUCTURE_CONSTANT:
+        {
+            const auto& elements = static_cast< const StructureConstant& >( value ).value();
+
+            if( frame.index < elements.size() )
+            {
+                return const_cast< Constant* >( &elements[ frame.index++ ] );
+            }
+            return nullptr;
+        }
+        case Kind::LEAF:
+        {
+            break;
+        }
+    }
+
+    return nullptr;
+}
+
+Context& Traverser::defaultContext( void )
+{
+    static thread_local Context context = Context();
+    return context;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,293 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_TRAVERSER_H_
+#define _LIBCJEL_IR_TRAVERSER_H_
+
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Value>
+#include <libcjel-ir/Visitor>
+
+#include <cassert>
+#include <vector>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    iterative traversal engine of the IR
+
+       Walks a value and all its children with an explicit stack instead of
+       recursion, the nesting depth of the IR is therefore only bounded by
+       the heap. The frame stack is owned by the calling thread and reused
+       by all traversals of it (nested traversals from within an action
+       included), after warm-up a traversal does not allocate.
+
+       The action is a template parameter and invoked in pre- or post-order
+       for every value, the 'Visitor' stages PROLOG, INTERLOG and EPILOG are
+       dispatched exactly as by the former recursive 'Value::iterate'.
+       Children are visited in this order:
+
+       Module            structures, constants, variables, memories,
+                         interconnects, intrinsics and functions
+       CallableUnit      inputs, outputs, INTERLOG, context
+       Statement         instructions, INTERLOG (not for trivial statements),
+                         scopes
+       Scope             blocks
+       StructureConstant elements
+
+       The visitor is a template parameter as well, it is either a 'Visitor'
+       (virtual hooks) or a 'StaticVisitor' whose hooks are resolved and
+       inlined at compile time, any type providing
+       'dispatch( Visitor::Stage, Value&, Context& )' can be used.
+
+       The children are iterated in place, an action must therefore not add
+       or remove children of the values which are currently traversed.
+    */
+
+    class Traverser final
+    {
+      public:
+        template < typename V, typename Action >
+        static void iterate(
+            Value& value, Traversal order, V* visitor, Context& context, Action&& action )
+        {
+            Stack stack;
+
+            push( stack, value, order, visitor, context, action );
+
+            while( stack.frames.size() > stack.base )
+            {
+                if( stack.frames.back().kind == Kind::STATEMENT and
+                    stack.frames.back().phase == 0 )
+                {
+                    // instructions are leaves, they are visited in one tight loop
+                    Value& statement = *stack.frames.back().value;
+                    const auto& stmt = static_cast< const Statement& >( statement );
+                    assert(
+                        stmt.instructions().size() > 0 and
+                        " a statement must contain at least one instruction " );
+
+                    for( const auto& instruction : stmt.instructions() )
+                    {
+                        enter( *instruction, order, visitor, context, action );
+                        leave( *instruction, order, visitor, context, action );
+                    }
+
+                    // a nested traversal of the action may have moved the frames
+                    stack.frames.back().phase = 1;
+
+                    if( visitor and not isa< TrivialStatement >( statement ) )
+                    {
+                        visitor->dispatch( Visitor::Stage::INTERLOG, statement, context );
+                    }
+                }
+
+                Value* child = next( stack.frames.back() );
+
+                if( not child and stack.frames.back().kind == Kind::CALLABLE_UNIT and
+                    stack.frames.back().phase == 2 )
+                {
+                    // inputs and outputs are done, the context follows the INTERLOG
+                    Value& callable = *stack.frames.back().value;
+
+                    if( visitor )
+                    {
+                        visitor->dispatch( Visitor::Stage::INTERLOG, callable, context );
+                    }
+
+                    child = next( stack.frames.back() );
+                }
+
+                if( child )
+                {
+                    push( stack, *child, order, visitor, context, action );
+                    continue;
+                }
+
+                Value& done = *stack.frames.back().value;
+                stack.frames.pop_back();
+
+                leave( done, order, visitor, context, action );
+            }
+        }
+
+        template < typename Action >
+        static void iterate( Value& value, Traversal order, Action&& action )
+        {
+            iterate( value, order, static_cast< Visitor* >( nullptr ), defaultContext(), action );
+        }
+
+      private:
+        enum class Kind : u8
+        {
+            LEAF,
+            MODULE,
+            CALLABLE_UNIT,
+            STATEMENT,
+            SCOPE,
+            STRUCTURE_CONSTANT
+        };
+
+        struct Frame
+        {
+            Value* value;
+            Kind kind;
+            u8 phase;
+            u32 index;
+        };
+
+        /**
+           frames of one traversal on top of the thread-local frame stack,
+           the frames of an interrupted traversal (exception thrown by the
+           action or a visitor) are dropped on destruction
+        */
+
+        struct Stack
+        {
+            Stack( void );
+
+            ~Stack( void );
+
+            std::vector< Frame >& frames;
+            const std::size_t base;
+        };
+
+        static inline Kind kind( Value::ID id )
+        {
+            switch( id )
+            {
+                case Value::MODULE:
+                    return Kind::MODULE;
+                case Value::FUNCTION:  // fall-through
+                case Value::INTRINSIC:
+                    return Kind::CALLABLE_UNIT;
+                case Value::TRIVIAL_STATEMENT:  // fall-through
+                case Value::BRANCH_STATEMENT:
+                case Value::LOOP_STATEMENT:
+                    return Kind::STATEMENT;
+                case Value::PARALLEL_SCOPE:  // fall-through
+                case Value::SEQUENTIAL_SCOPE:
+                    return Kind::SCOPE;
+                case Value::STRUCTURE_CONSTANT:
+                    return Kind::STRUCTURE_CONSTANT;
+                default:
+                    return Kind::LEAF;
+            }
+        }
+
+        template < typename V, typename Action >
+        static void enter(
+            Value& value, Traversal order, V* visitor, Context& context, Action& action )
+        {
+            if( order == Traversal::PREORDER )
+            {
+                action( value );
+            }
+
+            if( visitor )
+            {
+                visitor->dispatch( Visitor::Stage::PROLOG, value, context );
+            }
+        }
+
+        /**
+           enters a value and pushes its frame, leaf values (references,
+           constants, ...) are completed right away without a frame
+        */
+
+        template < typename V, typename Action >
+        static void push( Stack& stack, Value& value, Traversal order, V* visitor,
+            Context& context, Action& action )
+        {
+            enter( value, order, visitor, context, action );
+
+            const auto shape = kind( value.id() );
+            if( shape == Kind::LEAF )
+            {
+                leave( value, order, visitor, context, action );
+                return;
+            }
+
+            stack.frames.push_back( Frame{ &value, shape, 0, 0 } );
+        }
+
+        template < typename V, typename Action >
+        static void leave(
+            Value& value, Traversal order, V* visitor, Context& context, Action& action )
+        {
+            if( visitor )
+            {
+                visitor->dispatch( Visitor::Stage::EPILOG, value, context );
+            }
+
+            if( order == Traversal::POSTORDER )
+            {
+                action( value );
+            }
+        }
+
+        /**
+           returns the next child of the frame value or a null pointer if all
+           children have been visited, a callable unit returns a null pointer
+           in phase 2 before its context to let 'iterate' dispatch the
+           INTERLOG stage, the instructions of a statement are handled by
+           'iterate' itself as well
+        */
+
+        static Value* next( Frame& frame );
+
+        static Context& defaultContext( void );
+
+        static thread_local std::vector< Frame > s_frames;
+    };
+}
+
+#endif  // _LIBCJEL_IR_TRAVERSER_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -49,16 +49,17 @@ Type::Type( const std::string& name, const std::string& description, u64 bitsize
 : m_name( name )
 , m_description( description )
 , m_bitsize( bitsize )
+, m_uid( 0 )
 , m_id( id )
 {
 }
 
-std::string Type::name( void ) const
+const std::string& Type::name( void ) const
 {
     return m_name;
 }
 
-std::string Type::description( void ) const
+const std::string& Type::description( void ) const
 {
     return m_description;
 }
@@ -68,6 +69,29 @@ Type::ID Type::id( void ) const
     return m_id;
 }
 
+u32 Type::uid( void ) const
+{
+    return m_uid;
+}
+
+std::size_t Type::hash( void ) const
+{
+    return m_uid;
+}
+
+void Type::intern( void )
+{
+    // PPA: the type kind and name are unique for every structural type, the
+    // table is only consulted once per constructed aggregate or relation type
+    const auto key = std::to_string( id() ) + ":" + m_name;
+
+    std::lock_guard< std::mutex > guard( s_uid_lock() );
+
+    auto& table = s_uid_table();
+    const auto result = table.emplace( key, _DYNAMIC_UID_ + table.size() );
+    m_uid = result.first->second;
+}
+
 u64 Type::bitsize( void ) const
 {
     return m_bitsize;
@@ -83,7 +107,7 @@ const Types& Type::results( void ) const
     return m_results;
 }
 
-Types Type::ptr_results( void ) const
+const Types& Type::ptr_results( void ) const
 {
     return results();
 }
@@ -100,7 +124,7 @@ const Types& Type::arguments( void ) const
     return empty;
 }
 
-Types Type::ptr_arguments( void ) const
+const Types& Type::ptr_arguments( void ) const
 {
     return arguments();
 }
@@ -155,11 +179,7 @@ PrimitiveType::PrimitiveType(
 LabelType::LabelType( void )
 : PrimitiveType( "label", "Label", 0, Type::LABEL )
 {
-}
-
-std::size_t LabelType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    m_uid = LABEL_UID;
 }
 
 //
@@ -169,11 +189,7 @@ std::size_t LabelType::hash( void ) const
 VoidType::VoidType( void )
 : PrimitiveType( "void", "Void", 0, Type::VOID )
 {
-}
-
-std::size_t VoidType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    m_uid = VOID_UID;
 }
 
 //
@@ -197,11 +213,36 @@ BitType::BitType( u16 bitsize )
             "bit size of 'BitType' shall be smaller or equal than '" +
             std::to_string( BitType::SizeMax ) + "'" );
     }
+
+    m_uid = bitsize;
 }
 
-std::size_t BitType::hash( void ) const
+const BitType::Ptr& BitType::get( u16 bitsize )
 {
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    static const auto types = []( void ) {
+        std::vector< BitType::Ptr > obj( BitType::SizeMax + 1 );
+
+        for( u16 c = 1; c <= BitType::SizeMax; c++ )
+        {
+            // reuse already cached bit types to keep the pointer identity
+            auto result = s_cache().emplace( c, nullptr );
+            if( result.second )
+            {
+                result.first->second = std::make_shared< BitType >( c );
+            }
+            obj[ c ] = std::static_pointer_cast< BitType >( result.first->second );
+        }
+
+        return obj;
+    }();
+
+    if( bitsize < 1 or bitsize > BitType::SizeMax )
+    {
+        throw std::domain_error(
+            "bit size '" + std::to_string( bitsize ) + "' of 'BitType' is out of range" );
+    }
+
+    return types[ bitsize ];
 }
 
 //
@@ -214,11 +255,8 @@ StringType::StringType( void )
     // TODO: PPA: FIXME: IDEA: strings are either always without a size and it
     // is determined later in the compilation step or every string size
     // (bitsize) will be fixed by construction
-}
 
-std::size_t StringType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    m_uid = STRING_UID;
 }
 
 //
@@ -253,11 +291,8 @@ VectorType::VectorType( const Type::Ptr& type, u16 length )
     {
         m_results.add( m_type );
     }
-}
 
-std::size_t VectorType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    intern();
 }
 
 //
@@ -273,7 +308,7 @@ StructureType::StructureType( const Structure::Ptr& kind )
         throw std::domain_error( "structure kind of 'StructureType' cannot be a null pointer" );
     }
 
-    const auto elements = kind->elements();
+    const auto& elements = kind->elements();
 
     m_name = "[";
     m_description = "[";
@@ -309,11 +344,18 @@ StructureType::StructureType( const Structure::Ptr& kind )
     {
         throw std::domain_error( "bit-size of 'StructureType' cannot be '0'" );
     }
+
+    intern();
 }
 
-std::size_t StructureType::hash( void ) const
+Structure& StructureType::kind( void ) const
 {
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    return *m_kind;
+}
+
+Structure::Ptr StructureType::ptr_kind( void ) const
+{
+    return m_kind;
 }
 
 //
@@ -336,7 +378,7 @@ RelationType::RelationType(
     m_description = "(";
 
     u1 first = true;
-    for( auto argument : m_arguments )
+    for( const auto& argument : m_arguments )
     {
         if( not first )
         {
@@ -356,7 +398,7 @@ RelationType::RelationType(
     m_bitsize = 0;
 
     first = true;
-    for( auto result : m_results )
+    for( const auto& result : m_results )
     {
         m_bitsize += result->bitsize();
 
@@ -379,6 +421,8 @@ RelationType::RelationType(
     {
         throw std::domain_error( "bit-size of 'StructureType' cannot be '0'" );
     }
+
+    intern();
 }
 
 const Types& RelationType::arguments( void ) const
@@ -386,11 +430,6 @@ const Types& RelationType::arguments( void ) const
     return m_arguments;
 }
 
-std::size_t RelationType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
-}
-
 //
 // SyntheticType
 //
@@ -408,11 +447,7 @@ SyntheticType::SyntheticType(
 InterconnectType::InterconnectType( void )
 : SyntheticType( "x", "Interconnect", 0, Type::INTERCONNECT )
 {
-}
-
-std::size_t InterconnectType::hash( void ) const
-{
-    return std::hash< std::string >()( "t:" + std::to_string( id() ) + ":" + description() );
+    m_uid = INTERCONNECT_UID;
 }
 
 //
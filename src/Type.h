@@ -48,6 +48,7 @@
 #include <libstdhl/Log>
 
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -82,36 +83,36 @@ namespace libcjel_ir
 
         ~Type() = default;
 
-        std::string name( void ) const;
+        const std::string& name( void ) const;
 
-        std::string description( void ) const;
+        const std::string& description( void ) const;
 
         ID id( void ) const;
 
+        /**
+           dense unique type identifier, all structurally equal types share
+           the same identifier, bit types use their bit size as identifier
+        */
+
+        u32 uid( void ) const;
+
         u64 bitsize( void ) const;
 
         u64 wordsize( const u64 wordbits = 64 ) const;
 
         const Types& results( void ) const;
 
-        Types ptr_results( void ) const;
+        const Types& ptr_results( void ) const;
 
         const Types& arguments( void ) const;
 
-        Types ptr_arguments( void ) const;
+        const Types& ptr_arguments( void ) const;
 
-        virtual std::size_t hash( void ) const = 0;
+        virtual std::size_t hash( void ) const;
 
         inline u1 operator==( const Type& rhs ) const
         {
-            if( this != &rhs )
-            {
-                if( this->id() != rhs.id() or this->name().compare( rhs.name() ) )
-                {
-                    return false;
-                }
-            }
-            return true;
+            return m_uid == rhs.m_uid;
         }
 
         inline u1 operator!=( const Type& rhs ) const
@@ -134,6 +135,17 @@ namespace libcjel_ir
         }
 
       protected:
+        enum UID : u32
+        {
+            LABEL_UID = 513,
+            VOID_UID,
+            STRING_UID,
+            INTERCONNECT_UID,
+            _DYNAMIC_UID_
+        };
+
+        void intern( void );
+
         std::string m_name;
 
         std::string m_description;
@@ -142,6 +154,8 @@ namespace libcjel_ir
 
         Types m_results;
 
+        u32 m_uid;
+
       private:
         ID m_id;
 
@@ -163,6 +177,18 @@ namespace libcjel_ir
             static std::unordered_map< u64, std::size_t > obj = {};
             return obj;
         }
+
+      private:
+        static std::mutex& s_uid_lock( void )
+        {
+            static std::mutex obj;
+            return obj;
+        }
+        static std::unordered_map< std::string, u32 >& s_uid_table( void )
+        {
+            static std::unordered_map< std::string, u32 > obj = {};
+            return obj;
+        }
     };
 
     class PrimitiveType : public Type
@@ -198,8 +224,6 @@ namespace libcjel_ir
         using Ptr = std::shared_ptr< LabelType >;
 
         LabelType( void );
-
-        std::size_t hash( void ) const override;
     };
 
     class VoidType : public PrimitiveType
@@ -208,8 +232,6 @@ namespace libcjel_ir
         using Ptr = std::shared_ptr< VoidType >;
 
         VoidType( void );
-
-        std::size_t hash( void ) const override;
     };
 
     class BitType : public PrimitiveType
@@ -221,7 +243,12 @@ namespace libcjel_ir
 
         BitType( u16 bitsize );
 
-        std::size_t hash( void ) const override;
+        /**
+           returns the canonical bit type of a bit size, all 'SizeMax' bit
+           types are pre-seeded and shared with the type cache
+        */
+
+        static const BitType::Ptr& get( u16 bitsize );
     };
 
     class StringType : public PrimitiveType
@@ -230,8 +257,6 @@ namespace libcjel_ir
         using Ptr = std::shared_ptr< StringType >;
 
         StringType( void );
-
-        std::size_t hash( void ) const override;
     };
 
     class VectorType : public AggregateType
@@ -241,8 +266,6 @@ namespace libcjel_ir
 
         VectorType( const Type::Ptr& type, u16 length );
 
-        std::size_t hash( void ) const override;
-
       private:
         Type::Ptr m_type;
         u16 m_length;
@@ -259,8 +282,6 @@ namespace libcjel_ir
 
         std::shared_ptr< Structure > ptr_kind( void ) const;
 
-        std::size_t hash( void ) const override;
-
       private:
         std::shared_ptr< Structure > m_kind;
     };
@@ -275,8 +296,6 @@ namespace libcjel_ir
 
         const Types& arguments( void ) const;
 
-        std::size_t hash( void ) const override;
-
       private:
         Types m_arguments;
     };
@@ -285,8 +304,6 @@ namespace libcjel_ir
     {
       public:
         InterconnectType( void );
-
-        std::size_t hash( void ) const override;
     };
 }
 
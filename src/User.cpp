@@ -51,8 +51,143 @@
 #include <libcjel-ir/Structure>
 #include <libcjel-ir/Variable>
 
+#include <cassert>
+
 using namespace libcjel_ir;
 
+User::User( const std::string& name, const Type::Ptr& type, Value::ID id )
+: Value( name, type, id )
+{
+}
+
+User::User(
+    const std::string& name,
+    const Type::Ptr& type,
+    const std::vector< Value::Ptr >& operands,
+    Value::ID id )
+: Value( name, type, id )
+{
+    m_operands.reserve( operands.size() );
+    m_slots.reserve( operands.size() );
+
+    for( const auto& operand : operands )
+    {
+        add( operand );
+    }
+}
+
+User::User(
+    const std::string& name,
+    const Type::Ptr& type,
+    std::initializer_list< Value::Ptr > operands,
+    Value::ID id )
+: Value( name, type, id )
+{
+    m_operands.reserve( operands.size() );
+    m_slots.reserve( operands.size() );
+
+    for( const auto& operand : operands )
+    {
+        add( operand );
+    }
+}
+
+User::User( const User& other )
+: Value( other )
+{
+    m_operands.reserve( other.m_operands.size() );
+    m_slots.reserve( other.m_operands.size() );
+
+    for( const auto& operand : other.m_operands )
+    {
+        add( operand );
+    }
+}
+
+User::~User( void )
+{
+    for( u32 c = 0; c < m_operands.size(); c++ )
+    {
+        unlink( c );
+    }
+}
+
+const Value::Ptr& User::operand( u8 position ) const
+{
+    if( position >= m_operands.size() )
+    {
+        throw std::domain_error(
+            "operand position '" + std::to_string( position ) + "' does not exist!" );
+    }
+
+    return m_operands[ position ];
+}
+
+u32 User::arity( void ) const
+{
+    return m_operands.size();
+}
+
+User::Operands User::operands( void ) const
+{
+    return Operands( m_operands.begin(), m_operands.end() );
+}
+
+void User::setOperand( u8 position, const Value::Ptr& value )
+{
+    assert( value );
+
+    if( position >= m_operands.size() )
+    {
+        throw std::domain_error(
+            "operand position '" + std::to_string( position ) + "' does not exist!" );
+    }
+
+    // keep the previous operand alive until the use lists are consistent again
+    const auto previous = m_operands[ position ];
+
+    unlink( position );
+    m_operands[ position ] = value;
+    link( position );
+}
+
+void User::add( const Value::Ptr& value )
+{
+    m_operands.emplace_back( value );
+    m_slots.emplace_back( 0 );
+    link( m_operands.size() - 1 );
+}
+
+void User::link( u32 position )
+{
+    auto& value = m_operands[ position ];
+    if( not value )
+    {
+        return;
+    }
+
+    m_slots[ position ] = value->m_uses.size();
+    value->m_uses.emplace_back( Use{ this, position } );
+}
+
+void User::unlink( u32 position )
+{
+    auto& value = m_operands[ position ];
+    if( not value )
+    {
+        return;
+    }
+
+    // swap-remove the use and re-target the slot of the moved use
+    auto& uses = value->m_uses;
+    const auto slot = m_slots[ position ];
+    assert( slot < uses.size() and uses[ slot ].user == this );
+
+    uses[ slot ] = uses.back();
+    uses[ slot ].user->m_slots[ uses[ slot ].operand ] = slot;
+    uses.pop_back();
+}
+
 bool User::classof( Value const* obj )
 {
     return obj->id() == classid() or Module::classof( obj ) or Memory::classof( obj ) or
@@ -44,15 +44,66 @@
 
 #include "Value.h"
 
+#include <libcjel-ir/SmallVector>
+#include <libcjel-ir/View>
+
+#include <initializer_list>
+
 namespace libcjel_ir
 {
+    /**
+       @brief    value which consumes other values
+
+       A user owns its operands, every operand position is registered as a
+       'Use' at the used value and is unregistered again when the operand is
+       replaced or the user is destroyed.
+
+       Up to 'INLINE' operands are stored inside the user itself, which
+       covers all unary and binary instructions without a heap allocation.
+       The operand accessors return references and views into this storage
+       and never copy the operand pointers.
+    */
+
     class User : public Value
     {
       public:
-        User( const std::string& name, const Type::Ptr& type, Value::ID id = classid() )
-        : Value( name, type, id )
-        {
-        }
+        static constexpr u32 INLINE = 3;
+
+        using Operands = View< Value >;
+
+        User( const std::string& name, const Type::Ptr& type, Value::ID id = classid() );
+
+        User(
+            const std::string& name,
+            const Type::Ptr& type,
+            const std::vector< Value::Ptr >& operands,
+            Value::ID id = classid() );
+
+        /**
+           fixed operands are linked without a temporary vector
+        */
+
+        User(
+            const std::string& name,
+            const Type::Ptr& type,
+            std::initializer_list< Value::Ptr > operands,
+            Value::ID id = classid() );
+
+        User( const User& other );
+
+        ~User( void );
+
+        const Value::Ptr& operand( u8 position ) const;
+
+        u32 arity( void ) const;
+
+        /**
+           view of all operands, invalidated when an operand is added
+        */
+
+        Operands operands( void ) const;
+
+        void setOperand( u8 position, const Value::Ptr& value );
 
         static inline Value::ID classid( void )
         {
@@ -60,6 +111,21 @@ namespace libcjel_ir
         }
 
         static bool classof( Value const* obj );
+
+      protected:
+        void add( const Value::Ptr& value );
+
+      private:
+        void link( u32 position );
+
+        void unlink( u32 position );
+
+        SmallVector< Value::Ptr, INLINE > m_operands;
+
+        SmallVector< u32, INLINE > m_slots;
+
+        friend class Value;
+        friend class Statistics;
     };
 }
 
@@ -51,7 +51,9 @@
 #include <libcjel-ir/Reference>
 #include <libcjel-ir/Scope>
 #include <libcjel-ir/Statement>
+#include <libcjel-ir/Statistics>
 #include <libcjel-ir/Structure>
+#include <libcjel-ir/Traverser>
 #include <libcjel-ir/Variable>
 #include <libcjel-ir/Visitor>
 
@@ -63,13 +65,42 @@ Value::Value( const std::string& name, const Type::Ptr& type, Value::ID id )
 : m_name( name )
 , m_type( type )
 , m_id( id )
+, m_index( nullptr )
+, m_slot( 0 )
 {
-    m_id2objs()[ m_id ].insert( this );
+    Statistics::construct( m_id );
+}
+
+Value::Value( const Value& other )
+: m_name( other.m_name )
+, m_type( other.m_type )
+, m_id( other.m_id )
+, m_module( other.m_module )
+, m_index( nullptr )
+, m_slot( 0 )
+{
+    Statistics::construct( m_id );
+}
+
+Value& Value::operator=( const Value& other )
+{
+    // the kind stays, it is accounted and indexed
+    assert( m_id == other.m_id );
+
+    m_name = other.m_name;
+    m_type = other.m_type;
+    m_module = other.m_module;
+    return *this;
 }
 
 Value::~Value( void )
 {
-    m_id2objs()[ m_id ].erase( this );
+    Statistics::destruct( m_id );
+
+    if( m_index.load( std::memory_order_acquire ) )
+    {
+        Module::detach( *this );
+    }
 }
 
 std::string Value::name( void ) const
@@ -83,6 +114,30 @@ std::string Value::name( void ) const
     return m_name;
 }
 
+void Value::appendName( std::string& output ) const
+{
+    if( not isa< BitConstant >( this ) )
+    {
+        output += m_name;
+        return;
+    }
+
+    auto value = static_cast< const BitConstant* >( this )->value().value();
+
+    char digits[ 20 ];
+    u32 count = 0;
+    do
+    {
+        digits[ count++ ] = '0' + value % 10;
+        value /= 10;
+    } while( value );
+
+    while( count > 0 )
+    {
+        output += digits[ --count ];
+    }
+}
+
 const Type& Value::type( void ) const
 {
     return *m_type.get();
@@ -93,11 +148,6 @@ Type::Ptr Value::ptr_type( void ) const
     return m_type;
 }
 
-Value::ID Value::id( void ) const
-{
-    return m_id;
-}
-
 std::string Value::description( void ) const
 {
     return type().name() + " " + name();
@@ -117,7 +167,7 @@ std::string Value::dump( void ) const
     if( auto instr = cast< Instruction >( this ) )
     {
         u1 first = true;
-        for( auto operand : instr->operands() )
+        for( const auto& operand : instr->operands() )
         {
             if( first )
             {
@@ -146,142 +196,61 @@ std::string Value::label( void ) const
     return name();
 }
 
-void Value::iterate(
-    Traversal order, Visitor* visitor, Context* context, std::function< void( Value& ) > action )
+const Value::Uses& Value::uses( void ) const
 {
-    static Context default_context = Context();
-
-    Context* cxt = context ? context : &default_context;
-
-    Value& value = static_cast< Value& >( *this );
-
-    if( order == Traversal::PREORDER )
-    {
-        action( /*order, */ value );
-    }
+    return m_uses;
+}
 
-    if( visitor )
-    {
-        visitor->dispatch( Visitor::Stage::PROLOG, value, *cxt );
-    }
+std::vector< User* > Value::users( void ) const
+{
+    std::vector< User* > tmp;
+    tmp.reserve( m_uses.size() );
 
-    if( isa< Module >( value ) )
+    for( const auto& use : m_uses )
     {
-        Module& module = static_cast< Module& >( value );
-
-        for( auto p : module.get< Structure >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Constant >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Variable >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Memory >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Interconnect >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Intrinsic >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
-
-        for( auto p : module.get< Function >() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
+        tmp.emplace_back( use.user );
     }
-    else if( isa< StructureConstant >( value ) )
-    {
-        StructureConstant& obj = static_cast< StructureConstant& >( value );
 
-        for( auto p : obj.value() )
-        {
-            p.iterate( order, visitor, cxt, action );
-        }
-    }
-    else if( isa< CallableUnit >( value ) )
-    {
-        CallableUnit& obj = static_cast< CallableUnit& >( value );
+    return tmp;
+}
 
-        for( auto p : obj.inputs() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
+u1 Value::hasOneUse( void ) const
+{
+    return m_uses.size() == 1;
+}
 
-        for( auto p : obj.outputs() )
-        {
-            p->iterate( order, visitor, cxt, action );
-        }
+void Value::replaceAllUsesWith( const Value::Ptr& value )
+{
+    assert( value and value.get() != this );
 
-        if( visitor )
-        {
-            visitor->dispatch( Visitor::Stage::INTERLOG, value, *cxt );
-        }
+    // the users may hold the last references to this value, therefore all
+    // released operands are kept alive until the use lists are moved over
+    std::vector< Value::Ptr > released;
+    released.reserve( m_uses.size() );
 
-        auto context = obj.context();
-        assert( context );
+    auto& uses = value->m_uses;
+    uses.reserve( uses.size() + m_uses.size() );
 
-        context->iterate( order, visitor, cxt, action );
-    }
-    else if( isa< Statement >( value ) )
+    for( const auto& use : m_uses )
     {
-        Statement& stmt = static_cast< Statement& >( value );
-
-        assert(
-            stmt.instructions().size() > 0 and
-            " a statement must contain at least one instruction " );
-
-        for( auto instr : stmt.instructions() )
-        {
-            assert( instr );
-            instr->iterate( order, visitor, cxt, action );
-        }
+        auto user = use.user;
+        user->m_slots[ use.operand ] = uses.size();
+        uses.emplace_back( use );
 
-        if( visitor && not isa< TrivialStatement >( value ) )
-        {
-            visitor->dispatch( Visitor::Stage::INTERLOG, value, *cxt );
-
-            for( auto sco : stmt.scopes() )
-            {
-                assert( sco );
-                sco->iterate( order, visitor, cxt, action );
-            }
-        }
+        released.emplace_back( std::move( user->m_operands[ use.operand ] ) );
+        user->m_operands[ use.operand ] = value;
     }
-    else if( isa< Scope >( value ) )
-    {
-        Scope& scope = static_cast< Scope& >( value );
 
-        for( auto block : scope.blocks() )
-        {
-            assert( block );
-            block->iterate( order, visitor, cxt, action );
-        }
-    }
+    m_uses.clear();
+}
 
-    if( visitor )
-    {
-        visitor->dispatch( Visitor::Stage::EPILOG, value, *cxt );
-    }
+void Value::iterate(
+    Traversal order, Visitor* visitor, Context* context, std::function< void( Value& ) > action )
+{
+    static thread_local Context default_context = Context();
 
-    if( order == Traversal::POSTORDER )
-    {
-        action( /*order, */ value );
-    }
+    Traverser::iterate(
+        *this, order, visitor, context ? *context : default_context, action );
 }
 
 void Value::iterate( Traversal order, std::function< void( Value& ) > action )
@@ -43,8 +43,11 @@
 #define _LIBCJEL_IR_VALUE_H_
 
 #include <libcjel-ir/CjelIR>
+#include <libcjel-ir/SmallVector>
 #include <libcjel-ir/Type>
 
+#include <atomic>
+
 namespace libcjel_ir
 {
     class Visitor;
@@ -52,6 +55,7 @@ namespace libcjel_ir
     enum Traversal : u8;
 
     class Module;
+    class User;
 
     /**
       @extends CjelIR
@@ -164,19 +168,58 @@ namespace libcjel_ir
             ,
             ZEXT_INSTRUCTION,
             TRUNC_INSTRUCTION
+
+            ,
+            _SIZE_
+        };
+
+        /**
+           operand position 'operand' of 'user' refers to this value
+        */
+
+        struct Use
+        {
+            User* user;
+            u32 operand;
         };
 
+        /**
+           most values have a single use, which is stored inline
+        */
+
+        using Uses = SmallVector< Use, 1 >;
+
         Value( const std::string& name, const Type::Ptr& type, ID id );
 
+        /**
+           copies are neither registered in a module index nor used by any
+           user of the original value, an assignment keeps the kind, the
+           index entry and the users of the assigned value
+        */
+
+        Value( const Value& other );
+
+        Value& operator=( const Value& other );
+
         ~Value( void );
 
         std::string name( void ) const;
 
+        /**
+           appends the name to 'output' without a temporary string, the
+           literal of a bit constant is written digit by digit
+        */
+
+        void appendName( std::string& output ) const;
+
         const Type& type( void ) const;
 
         Type::Ptr ptr_type( void ) const;
 
-        ID id() const;
+        inline ID id( void ) const
+        {
+            return m_id;
+        }
 
         std::string description( void ) const;
 
@@ -192,6 +235,19 @@ namespace libcjel_ir
 
         std::shared_ptr< Module > ptr_module( void ) const;
 
+        const Uses& uses( void ) const;
+
+        std::vector< User* > users( void ) const;
+
+        u1 hasOneUse( void ) const;
+
+        /**
+           re-targets every use of this value to 'value', the cost is linear
+           in the number of uses of this value
+        */
+
+        void replaceAllUsesWith( const Value::Ptr& value );
+
         virtual std::size_t hash( void ) const = 0;
 
         inline u1 operator==( const Value& rhs ) const
@@ -229,13 +285,6 @@ namespace libcjel_ir
 
         virtual void iterate( Traversal order, std::function< void( Value& ) > action ) final;
 
-      private:
-        static std::unordered_map< u8, std::unordered_set< Value* > >& m_id2objs( void )
-        {
-            static std::unordered_map< u8, std::unordered_set< Value* > > cache;
-            return cache;
-        }
-
       protected:
         std::string m_name;
 
@@ -246,6 +295,16 @@ namespace libcjel_ir
 
         std::weak_ptr< Module > m_module;
 
+        std::atomic< Module* > m_index;
+
+        u32 m_slot;
+
+        Uses m_uses;
+
+        friend class Module;
+        friend class User;
+        friend class Statistics;
+
         // Value* m_next; // TODO: PPA: use a std::weak_ptr here?
     };
 
@@ -48,21 +48,23 @@
 
 using namespace libcjel_ir;
 
-u64 Variable::m_allocation_cnt = 0;
+std::atomic< u64 > Variable::m_allocation_cnt( 0 );
 
 Variable::Variable( const Type::Ptr& type, const Value::Ptr& expression, const std::string& ident )
 : User( ident, type, Value::VARIABLE )
 , m_expression( expression )
-, m_allocation_id( libstdhl::Memory::make< BitConstant >( 64, m_allocation_cnt ) )
+, m_allocation_id( m_allocation_cnt++ )
 {
     assert( expression && isa< Constant >( expression ) );
+}
 
-    m_allocation_cnt++;
+Variable::~Variable( void )
+{
 }
 
 BitConstant::Ptr Variable::allocId( void )
 {
-    return m_allocation_id;
+    return libstdhl::Memory::make< BitConstant >( 64, m_allocation_id );
 }
 
 Value::Ptr Variable::expression( void ) const
@@ -48,6 +48,8 @@
 #include <libcjel-ir/Instruction>
 #include <libcjel-ir/Value>
 
+#include <atomic>
+
 namespace libcjel_ir
 {
     class Variable : public User
@@ -60,6 +62,11 @@ namespace libcjel_ir
 
         ~Variable( void );
 
+        /**
+           returns a new 64-bit constant of the allocation number, the
+           number is drawn at construction time
+        */
+
         BitConstant::Ptr allocId( void );
 
         Value::Ptr expression( void ) const;
@@ -74,10 +81,10 @@ namespace libcjel_ir
         static bool classof( Value const* obj );
 
       private:
-        static u64 m_allocation_cnt;
+        static std::atomic< u64 > m_allocation_cnt;
 
         Value::Ptr m_expression;
-        BitConstant::Ptr m_allocation_id;
+        u64 m_allocation_id;
     };
 }
 
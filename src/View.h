@@ -0,0 +1,127 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_VIEW_H_
+#define _LIBCJEL_IR_VIEW_H_
+
+#include <libcjel-ir/CjelIR>
+
+#include <vector>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    non-owning view of contiguous value pointers
+
+       Gives read access to a range of 'T::Ptr' without copying the pointers
+       and therefore without touching their reference counts. A view is only
+       valid as long as the viewed storage is neither modified nor destroyed.
+    */
+
+    template < typename T >
+    class View final
+    {
+      public:
+        using value_type = typename T::Ptr;
+        using iterator = const value_type*;
+        using const_iterator = const value_type*;
+
+        View( void )
+        : m_begin( nullptr )
+        , m_end( nullptr )
+        {
+        }
+
+        View( const value_type* begin, const value_type* end )
+        : m_begin( begin )
+        , m_end( end )
+        {
+        }
+
+        View( const std::vector< value_type >& values )
+        : m_begin( values.data() )
+        , m_end( values.data() + values.size() )
+        {
+        }
+
+        const value_type& operator[]( std::size_t position ) const
+        {
+            return m_begin[ position ];
+        }
+
+        const_iterator begin( void ) const
+        {
+            return m_begin;
+        }
+
+        const_iterator end( void ) const
+        {
+            return m_end;
+        }
+
+        std::size_t size( void ) const
+        {
+            return m_end - m_begin;
+        }
+
+        u1 empty( void ) const
+        {
+            return m_begin == m_end;
+        }
+
+      private:
+        const value_type* m_begin;
+
+        const value_type* m_end;
+    };
+}
+
+#endif  // _LIBCJEL_IR_VIEW_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
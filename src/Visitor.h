@@ -98,6 +98,11 @@ namespace libcjel_ir
         POSTORDER
     };
 
+    /**
+       state of one traversal, a context is only used by the thread which
+       runs the traversal, the default contexts are per thread as well
+    */
+
     class Context : public CjelIR
     {
     };
@@ -48,6 +48,9 @@
 #include <libcjel-ir/Interconnect>
 #include <libcjel-ir/Intrinsic>
 #include <libcjel-ir/Memory>
+#include <libcjel-ir/ModuleScheduler>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/StaticVisitor>
 #include <libcjel-ir/Statement>
 #include <libcjel-ir/Structure>
 #include <libcjel-ir/Variable>
@@ -55,6 +58,10 @@
 
 #include <libpass/PassRegistry>
 
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+
 using namespace libcjel_ir;
 
 char CjelIRDumpPass::id = 0;
@@ -64,25 +71,239 @@ static libpass::PassRegistration< CjelIRDumpPass > PASS(
 
 bool CjelIRDumpPass::run( libpass::PassResult& pr )
 {
-    // auto data = pr.result< CjelIRDumpPass >();
-    // assert( data );
-
-    // try
-    // {
-    //     // data->module()->iterate( Traversal::PREORDER, this );
-    //     data->module()->iterate( Traversal::PREORDER, this );
-    // }
-    // catch( ... )
-    // {
-    //     fprintf( stderr, "unsuccessful EL dump\n" );
-    //     return false;
-    // }
+    auto data = pr.result< CjelIRDumpPass >();
+    assert( data );
 
-    // // libstdhl::Log::info( "%p: %s", tmp.c_str() );
+    try
+    {
+        dump( *data->module(), ThreadPool::shared(), []( const char* data, std::size_t size ) {
+            fwrite( data, 1, size, stdout );
+        } );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful EL dump: %s\n", e.what() );
+        return false;
+    }
 
     return true;
 }
 
+namespace
+{
+    // a full buffer is passed to the sink and reused
+    static constexpr std::size_t BUFFER_SIZE = 1 << 20;
+
+    /**
+       appends the line of a value to 'output', the format follows
+       'printf( "%-14s: %p, %s, %s%s ", ... )' of the former dump
+    */
+
+    static void line( std::string& output, const Value& value, u32 depth )
+    {
+        static const char HEX[] = "0123456789abcdef";
+
+        output += "visit_prolog  : 0x";
+
+        char digits[ 16 ];
+        u32 count = 0;
+        auto address = reinterpret_cast< std::uintptr_t >( &value );
+        do
+        {
+            digits[ count++ ] = HEX[ address & 0xf ];
+            address >>= 4;
+        } while( address );
+
+        while( count > 0 )
+        {
+            output += digits[ --count ];
+        }
+
+        output += ", ";
+        value.appendName( output );
+        output += ", ";
+        output.append( 2 * depth, ' ' );
+        value.appendName( output );
+        output += ' ';
+
+        if( isa< Reference >( value ) )
+        {
+            output += value.type().name();
+            output += static_cast< const Reference& >( value ).isInput() ? " in" : " out";
+        }
+        else if( isa< Instruction >( value ) and not isa< CallInstruction >( value ) )
+        {
+            const auto& user = static_cast< const User& >( value );
+            for( u32 c = 0; c < user.arity(); c++ )
+            {
+                const auto& operand = user.operand( c );
+                output += ", ";
+                operand->appendName( output );
+                output += " (";
+                output += operand->type().name();
+                output += ')';
+            }
+        }
+
+        output += '\n';
+    }
+
+    class DumpContext : public Context
+    {
+      public:
+        std::string output;
+
+        u32 depth = 0;
+    };
+
+    /**
+       prints every value in its prolog, the depth is the number of
+       enclosing blocks and is tracked by the block prologs and epilogs
+    */
+
+    class Printer final : public StaticVisitor< Printer >
+    {
+      public:
+        Printer( const CjelIRDumpPass::Sink* sink )
+        : m_sink( sink )
+        {
+        }
+
+        void visit_prolog( Value& value, Context& cxt )
+        {
+            auto& context = static_cast< DumpContext& >( cxt );
+            line( context.output, value, context.depth );
+
+            if( m_sink and context.output.size() >= BUFFER_SIZE )
+            {
+                ( *m_sink )( context.output.data(), context.output.size() );
+                context.output.clear();
+            }
+        }
+
+        void visit_prolog( Block& value, Context& cxt )
+        {
+            visit_prolog( static_cast< Value& >( value ), cxt );
+            static_cast< DumpContext& >( cxt ).depth++;
+        }
+
+        void visit_epilog( Block&, Context& cxt )
+        {
+            static_cast< DumpContext& >( cxt ).depth--;
+        }
+
+      private:
+        const CjelIRDumpPass::Sink* m_sink;
+    };
+
+    /**
+       the buffer of the calling thread, a nested dump (e.g. from a sink)
+       falls back to a fresh buffer
+    */
+
+    class Buffer final
+    {
+      public:
+        Buffer( DumpContext& context )
+        : m_context( context )
+        , m_owner( not s_busy )
+        {
+            if( m_owner )
+            {
+                s_busy = true;
+                m_context.output.swap( s_buffer );
+            }
+            m_context.output.reserve( BUFFER_SIZE + BUFFER_SIZE / 4 );
+        }
+
+        ~Buffer( void )
+        {
+            if( m_owner )
+            {
+                m_context.output.clear();
+                m_context.output.swap( s_buffer );
+                s_busy = false;
+            }
+        }
+
+      private:
+        DumpContext& m_context;
+        const u1 m_owner;
+
+        static thread_local std::string s_buffer;
+        static thread_local u1 s_busy;
+    };
+
+    thread_local std::string Buffer::s_buffer;
+    thread_local u1 Buffer::s_busy = false;
+}
+
+void CjelIRDumpPass::dump( Value& value, const Sink& sink )
+{
+    DumpContext context;
+    Buffer buffer( context );
+
+    Printer printer( &sink );
+    printer.iterate( value, Traversal::PREORDER, context );
+
+    if( context.output.size() > 0 )
+    {
+        sink( context.output.data(), context.output.size() );
+    }
+}
+
+std::string CjelIRDumpPass::dump( Value& value )
+{
+    DumpContext context;
+
+    Printer printer( nullptr );
+    printer.iterate( value, Traversal::PREORDER, context );
+
+    return std::move( context.output );
+}
+
+void CjelIRDumpPass::dump( Module& module, ThreadPool& pool, const Sink& sink )
+{
+    DumpContext context;
+    Buffer buffer( context );
+
+    Printer printer( &sink );
+    printer.visit_prolog( module, context );
+
+    ModuleScheduler< DumpContext > scheduler( pool );
+    scheduler.run( module,
+        [&printer, &context]( Value& value, DumpContext& ) {
+            printer.iterate( value, Traversal::PREORDER, context );
+        },
+        []( CallableUnit& callable, DumpContext& cxt ) {
+            // every callable unit is buffered until it is merged
+            Printer local( nullptr );
+            local.iterate( callable, Traversal::PREORDER, cxt );
+        },
+        [&context, &sink]( CallableUnit&, DumpContext& cxt ) {
+            if( context.output.size() > 0 )
+            {
+                sink( context.output.data(), context.output.size() );
+                context.output.clear();
+            }
+            sink( cxt.output.data(), cxt.output.size() );
+        } );
+
+    if( context.output.size() > 0 )
+    {
+        sink( context.output.data(), context.output.size() );
+    }
+}
+
+std::string CjelIRDumpPass::dump( Module& module, ThreadPool& pool )
+{
+    std::string result;
+    dump( module, pool, [&result]( const char* data, std::size_t size ) {
+        result.append( data, size );
+    } );
+    return result;
+}
+
 std::string CjelIRDumpPass::indention( Value& value )
 {
     std::string ind = "";
@@ -116,26 +337,21 @@ std::string CjelIRDumpPass::indention( Value& value )
     return ind;
 }
 
-#define DUMP_PREFIX                 \
-    printf(                         \
-        "%-14s: %p, %s, %s%s ",     \
-        __FUNCTION__,               \
-        &value,                     \
-        value.label().c_str(),      \
-        indention( value ).c_str(), \
-        value.name().c_str() )
-#define DUMP_POSTFIX printf( "\n" );
-
-#define DUMP_INSTR                                                                       \
-    for( auto operand : value.operands() )                                               \
-    {                                                                                    \
-        printf( ", %s (%s)", operand->label().c_str(), operand->type().name().c_str() ); \
-    }
+/**
+   prints the line of a value to stdout for a traversal through the virtual
+   'Visitor' interface, the depth is derived from the parent links
+*/
+
+static void print( const Value& value, const std::string& indention )
+{
+    std::string output;
+    line( output, value, indention.size() / 2 );
+    fputs( output.c_str(), stdout );
+}
 
 void CjelIRDumpPass::visit_prolog( Module& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Module& value, Context& )
 {
@@ -143,8 +359,7 @@ void CjelIRDumpPass::visit_epilog( Module& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Function& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_interlog( Function& value, Context& )
 {
@@ -155,8 +370,7 @@ void CjelIRDumpPass::visit_epilog( Function& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Intrinsic& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_interlog( Intrinsic& value, Context& )
 {
@@ -167,12 +381,7 @@ void CjelIRDumpPass::visit_epilog( Intrinsic& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Reference& value, Context& )
 {
-    DUMP_PREFIX;
-    printf( "%s %s", value.type().name().c_str(), value.isInput() ? "in" : "out" );
-    // printf(
-    //     "%s, %s", value.identifier()->name(), value.isInput() ? "in" : "out"
-    //     );
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Reference& value, Context& )
 {
@@ -180,8 +389,7 @@ void CjelIRDumpPass::visit_epilog( Reference& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Structure& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Structure& value, Context& )
 {
@@ -189,8 +397,7 @@ void CjelIRDumpPass::visit_epilog( Structure& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Variable& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Variable& value, Context& )
 {
@@ -198,8 +405,7 @@ void CjelIRDumpPass::visit_epilog( Variable& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Memory& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Memory& value, Context& )
 {
@@ -207,8 +413,7 @@ void CjelIRDumpPass::visit_epilog( Memory& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( ParallelScope& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( ParallelScope& value, Context& )
 {
@@ -216,8 +421,7 @@ void CjelIRDumpPass::visit_epilog( ParallelScope& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( SequentialScope& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( SequentialScope& value, Context& )
 {
@@ -225,8 +429,7 @@ void CjelIRDumpPass::visit_epilog( SequentialScope& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( TrivialStatement& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( TrivialStatement& value, Context& )
 {
@@ -234,8 +437,7 @@ void CjelIRDumpPass::visit_epilog( TrivialStatement& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( BranchStatement& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_interlog( BranchStatement& value, Context& )
 {
@@ -246,8 +448,7 @@ void CjelIRDumpPass::visit_epilog( BranchStatement& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( LoopStatement& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_interlog( LoopStatement& value, Context& )
 {
@@ -258,9 +459,7 @@ void CjelIRDumpPass::visit_epilog( LoopStatement& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( NopInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( NopInstruction& value, Context& )
 {
@@ -268,9 +467,7 @@ void CjelIRDumpPass::visit_epilog( NopInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( AllocInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( AllocInstruction& value, Context& )
 {
@@ -278,9 +475,7 @@ void CjelIRDumpPass::visit_epilog( AllocInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( IdInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( IdInstruction& value, Context& )
 {
@@ -288,9 +483,7 @@ void CjelIRDumpPass::visit_epilog( IdInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( CastInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( CastInstruction& value, Context& )
 {
@@ -298,9 +491,7 @@ void CjelIRDumpPass::visit_epilog( CastInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( CallInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    // DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( CallInstruction& value, Context& )
 {
@@ -308,9 +499,7 @@ void CjelIRDumpPass::visit_epilog( CallInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( IdCallInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( IdCallInstruction& value, Context& )
 {
@@ -318,9 +507,7 @@ void CjelIRDumpPass::visit_epilog( IdCallInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( StreamInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( StreamInstruction& value, Context& )
 {
@@ -328,9 +515,7 @@ void CjelIRDumpPass::visit_epilog( StreamInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( ExtractInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( ExtractInstruction& value, Context& )
 {
@@ -338,9 +523,7 @@ void CjelIRDumpPass::visit_epilog( ExtractInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( LoadInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( LoadInstruction& value, Context& )
 {
@@ -348,9 +531,7 @@ void CjelIRDumpPass::visit_epilog( LoadInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( StoreInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( StoreInstruction& value, Context& )
 {
@@ -358,9 +539,7 @@ void CjelIRDumpPass::visit_epilog( StoreInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( NotInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( NotInstruction& value, Context& )
 {
@@ -368,9 +547,7 @@ void CjelIRDumpPass::visit_epilog( NotInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( LnotInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( LnotInstruction& value, Context& )
 {
@@ -378,9 +555,7 @@ void CjelIRDumpPass::visit_epilog( LnotInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( AndInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( AndInstruction& value, Context& )
 {
@@ -388,9 +563,7 @@ void CjelIRDumpPass::visit_epilog( AndInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( OrInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( OrInstruction& value, Context& )
 {
@@ -398,9 +571,7 @@ void CjelIRDumpPass::visit_epilog( OrInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( XorInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( XorInstruction& value, Context& )
 {
@@ -408,9 +579,7 @@ void CjelIRDumpPass::visit_epilog( XorInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( AddUnsignedInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( AddUnsignedInstruction& value, Context& )
 {
@@ -418,9 +587,7 @@ void CjelIRDumpPass::visit_epilog( AddUnsignedInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( AddSignedInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( AddSignedInstruction& value, Context& )
 {
@@ -428,9 +595,7 @@ void CjelIRDumpPass::visit_epilog( AddSignedInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( DivSignedInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( DivSignedInstruction& value, Context& )
 {
@@ -438,9 +603,7 @@ void CjelIRDumpPass::visit_epilog( DivSignedInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( EquInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( EquInstruction& value, Context& )
 {
@@ -448,9 +611,7 @@ void CjelIRDumpPass::visit_epilog( EquInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( NeqInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( NeqInstruction& value, Context& )
 {
@@ -458,9 +619,7 @@ void CjelIRDumpPass::visit_epilog( NeqInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( ZeroExtendInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( ZeroExtendInstruction& value, Context& )
 {
@@ -468,9 +627,7 @@ void CjelIRDumpPass::visit_epilog( ZeroExtendInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( TruncationInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( TruncationInstruction& value, Context& )
 {
@@ -478,9 +635,7 @@ void CjelIRDumpPass::visit_epilog( TruncationInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( ModUnsignedInstruction& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_INSTR;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( ModUnsignedInstruction& value, Context& )
 {
@@ -488,8 +643,7 @@ void CjelIRDumpPass::visit_epilog( ModUnsignedInstruction& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( BitConstant& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( BitConstant& value, Context& )
 {
@@ -497,8 +651,7 @@ void CjelIRDumpPass::visit_epilog( BitConstant& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( StructureConstant& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( StructureConstant& value, Context& )
 {
@@ -506,8 +659,7 @@ void CjelIRDumpPass::visit_epilog( StructureConstant& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( StringConstant& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( StringConstant& value, Context& )
 {
@@ -515,8 +667,7 @@ void CjelIRDumpPass::visit_epilog( StringConstant& value, Context& )
 
 void CjelIRDumpPass::visit_prolog( Interconnect& value, Context& )
 {
-    DUMP_PREFIX;
-    DUMP_POSTFIX;
+    print( value, indention( value ) );
 }
 void CjelIRDumpPass::visit_epilog( Interconnect& value, Context& )
 {
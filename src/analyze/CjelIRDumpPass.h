@@ -47,8 +47,11 @@
 #include <libpass/PassResult>
 
 #include <libcjel-ir/Module>
+#include <libcjel-ir/ThreadPool>
 #include <libcjel-ir/Visitor>
 
+#include <functional>
+
 namespace libcjel_ir
 {
     class CjelIRDumpPass final
@@ -60,6 +63,33 @@ namespace libcjel_ir
 
         bool run( libpass::PassResult& pr ) override;
 
+        /**
+           receives the dump in chunks, a chunk is only valid during the call
+        */
+
+        using Sink = std::function< void( const char* data, std::size_t size ) >;
+
+        /**
+           dumps a value and all its children, the lines are written into a
+           reusable buffer of the calling thread which is passed to the sink
+           whenever it is full, the indentation is the block nesting depth
+           and tracked during the traversal
+        */
+
+        static void dump( Value& value, const Sink& sink );
+
+        static std::string dump( Value& value );
+
+        /**
+           dumps a module, the callable units are dumped in parallel on the
+           thread pool into separate buffers which are passed to the sink in
+           module order, the result equals a sequential dump
+        */
+
+        static void dump( Module& module, ThreadPool& pool, const Sink& sink );
+
+        static std::string dump( Module& module, ThreadPool& pool );
+
         std::string indention( Value& value );
 
         LIBCJEL_IR_VISITOR_INTERFACE;
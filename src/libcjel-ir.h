@@ -42,25 +42,47 @@
 #ifndef _LIBCJEL_IR_H_
 #define _LIBCJEL_IR_H_
 
+#include <libcjel-ir/Arena>
+#include <libcjel-ir/Binary>
+#include <libcjel-ir/BitValue>
 #include <libcjel-ir/Block>
 #include <libcjel-ir/CallableUnit>
 #include <libcjel-ir/CjelIR>
 #include <libcjel-ir/Function>
+#include <libcjel-ir/Generator>
 #include <libcjel-ir/Instruction>
 #include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Interpreter>
 #include <libcjel-ir/Intrinsic>
 #include <libcjel-ir/Memory>
 #include <libcjel-ir/Module>
+#include <libcjel-ir/ModuleScheduler>
+#include <libcjel-ir/Parser>
 #include <libcjel-ir/Reference>
+#include <libcjel-ir/Scheduler>
 #include <libcjel-ir/Scope>
+#include <libcjel-ir/SmallVector>
 #include <libcjel-ir/Statement>
+#include <libcjel-ir/StaticVisitor>
+#include <libcjel-ir/Statistics>
 #include <libcjel-ir/Structure>
+#include <libcjel-ir/ThreadPool>
+#include <libcjel-ir/Traverser>
 #include <libcjel-ir/Type>
 #include <libcjel-ir/Value>
 #include <libcjel-ir/Variable>
 #include <libcjel-ir/Version>
+#include <libcjel-ir/View>
 #include <libcjel-ir/Visitor>
 #include <libcjel-ir/analyze/CjelIRDumpPass>
+#include <libcjel-ir/analyze/CjelIRStatisticsPass>
+#include <libcjel-ir/transform/CjelIRConstantFoldingPass>
+#include <libcjel-ir/transform/CjelIRDeadCodeEliminationPass>
+#include <libcjel-ir/transform/CjelIRParallelizationPass>
+#include <libcjel-ir/transform/CjelIRToBinaryPass>
+#include <libcjel-ir/transform/CjelIRToC11Pass>
+#include <libcjel-ir/transform/CjelIRToLLPass>
+#include <libcjel-ir/transform/CjelIRValueNumberingPass>
 
 namespace libcjel_ir
 {
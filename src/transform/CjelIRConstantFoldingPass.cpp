@@ -0,0 +1,291 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRConstantFoldingPass.h"
+
+#include <libcjel-ir/BitValue>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Visitor>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <cstdio>
+#include <unordered_set>
+
+using namespace libcjel_ir;
+
+char CjelIRConstantFoldingPass::id = 0;
+
+static libpass::PassRegistration< CjelIRConstantFoldingPass > PASS( "CJEL IR Constant Folding Pass",
+    "folds instructions with constant operands into constants", "el-fold", 0 );
+
+bool CjelIRConstantFoldingPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRConstantFoldingPass >();
+    assert( data );
+
+    try
+    {
+        data->setRemoved( fold( *data->module() ) );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful EL constant folding: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    /**
+       computes the exact result of 'instr' if all its operands are bit
+       constants, a division by zero is not evaluated
+    */
+
+    static u1 evaluate( const Instruction& instr, BitValue& result )
+    {
+        const auto arity = instr.arity();
+        if( arity == 0 or arity > 2 or not instr.type().isBit() )
+        {
+            return false;
+        }
+
+        BitValue value[ 2 ];
+        for( u32 c = 0; c < arity; c++ )
+        {
+            const auto& operand = instr.operand( c );
+            if( not isa< BitConstant >( operand ) )
+            {
+                return false;
+            }
+            value[ c ] = BitValue( static_cast< const BitConstant& >( *operand ) );
+        }
+
+        const auto& lhs = value[ 0 ];
+        const auto& rhs = value[ 1 ];
+
+        switch( instr.id() )
+        {
+            case Value::ZEXT_INSTRUCTION:
+            {
+                result = lhs.zext( instr.type().bitsize() );
+                return true;
+            }
+            case Value::TRUNC_INSTRUCTION:
+            {
+                result = lhs.trunc( instr.type().bitsize() );
+                return true;
+            }
+            case Value::NOT_INSTRUCTION:
+            {
+                result = ~lhs;
+                return true;
+            }
+            case Value::LNOT_INSTRUCTION:
+            {
+                result = lhs.lnot();
+                return true;
+            }
+            case Value::AND_INSTRUCTION:
+            {
+                result = lhs & rhs;
+                return true;
+            }
+            case Value::OR_INSTRUCTION:
+            {
+                result = lhs | rhs;
+                return true;
+            }
+            case Value::XOR_INSTRUCTION:
+            {
+                result = lhs ^ rhs;
+                return true;
+            }
+            case Value::ADDS_INSTRUCTION:
+            {
+                result = lhs.adds( rhs );
+                return true;
+            }
+            case Value::ADDU_INSTRUCTION:
+            {
+                result = lhs.addu( rhs );
+                return true;
+            }
+            case Value::DIVS_INSTRUCTION:
+            {
+                if( rhs.isZero() )
+                {
+                    return false;
+                }
+                result = lhs.divs( rhs );
+                return true;
+            }
+            case Value::MODU_INSTRUCTION:
+            {
+                if( rhs.isZero() )
+                {
+                    return false;
+                }
+                result = lhs.modu( rhs );
+                return true;
+            }
+            case Value::EQU_INSTRUCTION:
+            {
+                result = lhs.equ( rhs );
+                return true;
+            }
+            case Value::NEQ_INSTRUCTION:
+            {
+                result = lhs.neq( rhs );
+                return true;
+            }
+            default:
+            {
+                return false;
+            }
+        }
+    }
+}
+
+u64 CjelIRConstantFoldingPass::fold( Statement& statement, ConstantPool& pool )
+{
+    const auto& instructions = statement.instructions();
+    if( instructions.size() == 0 )
+    {
+        return 0;
+    }
+
+    // the last instruction of a branch or loop statement is its condition
+    const Value* condition = nullptr;
+    if( not isa< TrivialStatement >( statement ) )
+    {
+        condition = ( instructions.begin() + ( instructions.size() - 1 ) )->get();
+    }
+
+    std::unordered_set< const Value* > members;
+    std::unordered_set< const Value* > queued;
+    std::unordered_set< const Value* > folded;
+    std::vector< Instruction* > worklist;
+
+    members.reserve( instructions.size() );
+    worklist.reserve( instructions.size() );
+
+    // the work list is a stack, the first instruction is on top
+    for( auto instruction = instructions.end(); instruction != instructions.begin(); )
+    {
+        --instruction;
+        members.emplace( instruction->get() );
+        queued.emplace( instruction->get() );
+        worklist.emplace_back( instruction->get() );
+    }
+
+    while( not worklist.empty() )
+    {
+        auto& instr = *worklist.back();
+        worklist.pop_back();
+        queued.erase( &instr );
+
+        // a result above 64 bits does not fit into a bit constant
+        BitValue result;
+        if( &instr == condition or not evaluate( instr, result ) or not result.fits() )
+        {
+            continue;
+        }
+
+        for( const auto& use : instr.uses() )
+        {
+            if( members.count( use.user ) and queued.emplace( use.user ).second )
+            {
+                worklist.emplace_back( static_cast< Instruction* >( use.user ) );
+            }
+        }
+
+        instr.replaceAllUsesWith( pool.bit( result.bitsize(), result.value() ) );
+        folded.emplace( &instr );
+    }
+
+    if( folded.empty() )
+    {
+        return 0;
+    }
+
+    return statement.remove(
+        [&folded]( const Instruction& instruction ) { return folded.count( &instruction ) > 0; } );
+}
+
+u64 CjelIRConstantFoldingPass::fold( Module& module, ConstantPool& pool )
+{
+    // statements are collected first, folding modifies their instructions
+    std::vector< Statement* > statements;
+    module.iterate( PREORDER, [&statements]( Value& value ) {
+        if( isa< Statement >( value ) )
+        {
+            statements.emplace_back( static_cast< Statement* >( &value ) );
+        }
+    } );
+
+    u64 removed = 0;
+    for( auto statement : statements )
+    {
+        removed += fold( *statement, pool );
+    }
+
+    return removed;
+}
+
+u64 CjelIRConstantFoldingPass::fold( Module& module )
+{
+    ConstantPool pool( &module );
+    return fold( module, pool );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,433 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRDeadCodeEliminationPass.h"
+
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Statement>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <cstdio>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace libcjel_ir;
+
+char CjelIRDeadCodeEliminationPass::id = 0;
+
+static libpass::PassRegistration< CjelIRDeadCodeEliminationPass > PASS(
+    "CJEL IR Dead Code Elimination Pass",
+    "removes unused instructions, empty statements and empty scopes", "el-dce", 0 );
+
+bool CjelIRDeadCodeEliminationPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRDeadCodeEliminationPass >();
+    assert( data );
+
+    try
+    {
+        data->setRemoved( eliminate( *data->module() ) );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful EL dead code elimination: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    static void instructions(
+        const Scope& scope, const std::function< void( const Instruction& ) >& action )
+    {
+        for( const auto& block : scope.blocks() )
+        {
+            if( isa< Scope >( *block ) )
+            {
+                instructions( static_cast< const Scope& >( *block ), action );
+                continue;
+            }
+
+            const auto& statement = static_cast< const Statement& >( *block );
+            for( const auto& instruction : statement.instructions() )
+            {
+                action( *instruction );
+            }
+            for( const auto& nested : statement.scopes() )
+            {
+                instructions( *nested, action );
+            }
+        }
+    }
+
+    /**
+       the location is not an element of a reference or an allocation of the
+       frame of its callable
+    */
+
+    static u1 global( const Value& location )
+    {
+        const Value* value = &location;
+        while( isa< ExtractInstruction >( value ) )
+        {
+            value = static_cast< const Instruction* >( value )->operand( 0 ).get();
+        }
+        return not( isa< Reference >( value ) or isa< AllocInstruction >( value ) );
+    }
+
+    /**
+       callables without effects, an effect of a callable propagates to all
+       its callers
+    */
+
+    class Effects
+    {
+      public:
+        Effects( const Module& module )
+        {
+            std::unordered_map< const Value*, std::vector< const Value* > > callers;
+            std::unordered_set< const Value* > effects;
+            std::vector< const Value* > worklist;
+
+            for( const auto units : { &module.get< Function >(), &module.get< Intrinsic >() } )
+            {
+                for( const auto& value : *units )
+                {
+                    const auto& unit = static_cast< const CallableUnit& >( *value );
+                    const auto& context = unit.context();
+
+                    u1 effect = not context;
+                    if( context )
+                    {
+                        instructions( *context, [&]( const Instruction& instr ) {
+                            if( isa< CallInstruction >( instr ) )
+                            {
+                                callers[ instr.operand( 0 ).get() ].emplace_back( &unit );
+                            }
+                            else if( isa< StoreInstruction >( instr ) )
+                            {
+                                effect = effect or global( *instr.operand( 1 ) );
+                            }
+                            else
+                            {
+                                effect = effect or kept( instr );
+                            }
+                        } );
+                    }
+
+                    m_pure.emplace( &unit );
+                    if( effect and effects.emplace( &unit ).second )
+                    {
+                        worklist.emplace_back( &unit );
+                    }
+                }
+            }
+
+            // a callee which is not a callable of the module has effects
+            for( const auto& callee : callers )
+            {
+                if( not m_pure.count( callee.first ) )
+                {
+                    for( const auto caller : callee.second )
+                    {
+                        if( effects.emplace( caller ).second )
+                        {
+                            worklist.emplace_back( caller );
+                        }
+                    }
+                }
+            }
+
+            while( not worklist.empty() )
+            {
+                const auto unit = worklist.back();
+                worklist.pop_back();
+                m_pure.erase( unit );
+
+                const auto result = callers.find( unit );
+                if( result == callers.end() )
+                {
+                    continue;
+                }
+                for( const auto caller : result->second )
+                {
+                    if( effects.emplace( caller ).second )
+                    {
+                        worklist.emplace_back( caller );
+                    }
+                }
+            }
+        }
+
+        /**
+           the instruction has to be kept regardless of its uses
+        */
+
+        u1 kept( const Instruction& instr ) const
+        {
+            switch( instr.id() )
+            {
+                case Value::STORE_INSTRUCTION:    // fall-through
+                case Value::STREAM_INSTRUCTION:   // fall-through
+                case Value::ID_CALL_INSTRUCTION:
+                {
+                    return true;
+                }
+                case Value::CALL_INSTRUCTION:
+                {
+                    return m_pure.count( instr.operand( 0 ).get() ) == 0;
+                }
+                default:
+                {
+                    return instr.mayFault();
+                }
+            }
+        }
+
+      private:
+        std::unordered_set< const Value* > m_pure;
+    };
+
+    /**
+       backward sweep over the blocks of a callable, a block or instruction
+       is dead once it is in the dead set
+    */
+
+    class Sweep
+    {
+      public:
+        Sweep( const Effects& effects )
+        : m_effects( effects )
+        , m_removed( 0 )
+        {
+        }
+
+        u64 removed( void ) const
+        {
+            return m_removed;
+        }
+
+        void clear( void )
+        {
+            m_dead.clear();
+        }
+
+        /**
+           returns true if 'scope' is empty after the sweep
+        */
+
+        u1 scope( Scope& scope )
+        {
+            const auto& blocks = scope.blocks();
+
+            u1 emptied = false;
+            for( auto block = blocks.end(); block != blocks.begin(); )
+            {
+                --block;
+                auto& child = **block;
+
+                const u1 empty = isa< Scope >( child )
+                                     ? this->scope( static_cast< Scope& >( child ) )
+                                     : statement( static_cast< Statement& >( child ) );
+                if( empty )
+                {
+                    m_dead.emplace( &child );
+                    emptied = true;
+                }
+            }
+
+            if( emptied )
+            {
+                scope.remove( [this]( const Block& block ) { return m_dead.count( &block ) > 0; } );
+            }
+
+            return blocks.size() == 0;
+        }
+
+      private:
+        /**
+           returns true if 'statement' is empty after the sweep
+        */
+
+        u1 statement( Statement& statement )
+        {
+            const auto& scopes = statement.scopes();
+
+            u1 empty = true;
+            for( auto scope = scopes.end(); scope != scopes.begin(); )
+            {
+                --scope;
+                empty = this->scope( **scope ) and empty;
+            }
+
+            const auto& instructions = statement.instructions();
+            if( instructions.size() == 0 )
+            {
+                return true;
+            }
+
+            if( isa< BranchStatement >( statement ) and empty and unused( statement ) )
+            {
+                m_removed += statement.remove( []( const Instruction& ) { return true; } );
+                return true;
+            }
+
+            // the last instruction of a branch or loop statement is its condition
+            const auto condition = ( instructions.begin() + ( instructions.size() - 1 ) )->get();
+            const u1 trivial = isa< TrivialStatement >( statement );
+
+            u1 dead = false;
+            for( auto instruction = instructions.end(); instruction != instructions.begin(); )
+            {
+                --instruction;
+                const auto& instr = **instruction;
+
+                if( ( &instr == condition and not trivial ) or m_effects.kept( instr ) )
+                {
+                    continue;
+                }
+
+                if( isa< NopInstruction >( instr ) or unused( instr ) )
+                {
+                    m_dead.emplace( &instr );
+                    dead = true;
+                }
+            }
+
+            if( dead )
+            {
+                m_removed += statement.remove( [this]( const Instruction& instruction ) {
+                    return m_dead.count( &instruction ) > 0;
+                } );
+            }
+
+            return instructions.size() == 0;
+        }
+
+        u1 unused( const Value& value ) const
+        {
+            for( const auto& use : value.uses() )
+            {
+                if( not m_dead.count( use.user ) )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+           all instructions of 'statement' are only used by each other or by
+           dead code and none of them has to be kept
+        */
+
+        u1 unused( const Statement& statement )
+        {
+            const auto& instructions = statement.instructions();
+            for( const auto& instruction : instructions )
+            {
+                m_dead.emplace( instruction.get() );
+            }
+
+            u1 result = true;
+            for( const auto& instruction : instructions )
+            {
+                if( m_effects.kept( *instruction ) or not unused( *instruction ) )
+                {
+                    result = false;
+                    break;
+                }
+            }
+
+            if( not result )
+            {
+                for( const auto& instruction : instructions )
+                {
+                    m_dead.erase( instruction.get() );
+                }
+            }
+
+            return result;
+        }
+
+        const Effects& m_effects;
+        std::unordered_set< const Value* > m_dead;
+        u64 m_removed;
+    };
+}
+
+u64 CjelIRDeadCodeEliminationPass::eliminate( Module& module )
+{
+    const Effects effects( module );
+    Sweep sweep( effects );
+
+    for( const auto units : { &module.get< Function >(), &module.get< Intrinsic >() } )
+    {
+        for( const auto& unit : *units )
+        {
+            const auto& context = static_cast< const CallableUnit& >( *unit ).context();
+            if( context )
+            {
+                sweep.scope( *context );
+                sweep.clear();
+            }
+        }
+    }
+
+    return sweep.removed();
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,411 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRParallelizationPass.h"
+
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Variable>
+#include <libcjel-ir/Visitor>
+
+#include <libpass/PassRegistry>
+
+#include <libstdhl/Hash>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <unordered_map>
+
+using namespace libcjel_ir;
+
+char CjelIRParallelizationPass::id = 0;
+
+static libpass::PassRegistration< CjelIRParallelizationPass > PASS(
+    "CJEL IR Parallelization Pass",
+    "regroups independent blocks of sequential scopes into parallel scopes", "el-par", 0 );
+
+bool CjelIRParallelizationPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRParallelizationPass >();
+    assert( data );
+
+    try
+    {
+        data->setCreated( parallelize( *data->module() ) );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful EL parallelization: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    // every variable and memory, and the order of the runtime faults
+    static const u8 WORLD = 0;
+    static const u8 FAULT = 1;
+
+    // all elements of a domain, and the elements of a domain accessed so far
+    static const u64 ANY = ~( (u64)0 );
+    static const u64 ELEMENTS = ~( (u64)1 );
+
+    struct Access
+    {
+        const void* domain;
+        u64 element;
+        u1 write;
+    };
+
+    struct Key
+    {
+        const void* domain;
+        u64 element;
+
+        inline u1 operator==( const Key& rhs ) const
+        {
+            return domain == rhs.domain and element == rhs.element;
+        }
+    };
+
+    struct KeyHash
+    {
+        inline std::size_t operator()( const Key& key ) const
+        {
+            return libstdhl::Hash::combine(
+                std::hash< const void* >()( key.domain ), std::hash< u64 >()( key.element ) );
+        }
+    };
+
+    // the level after the last writer and the last reader
+    struct Levels
+    {
+        u32 writer;
+        u32 reader;
+    };
+
+    static void collect( const Block& block, std::vector< const Instruction* >& result )
+    {
+        if( isa< Scope >( block ) )
+        {
+            for( const auto& child : static_cast< const Scope& >( block ).blocks() )
+            {
+                collect( *child, result );
+            }
+            return;
+        }
+
+        const auto& statement = static_cast< const Statement& >( block );
+        for( const auto& instruction : statement.instructions() )
+        {
+            result.emplace_back( instruction.get() );
+        }
+        for( const auto& scope : statement.scopes() )
+        {
+            collect( *scope, result );
+        }
+    }
+
+    /**
+       the domain of a location and the element of the domain, an 'extract'
+       with a constant index from the domain selects one element
+    */
+
+    static Access location( const Value& value, u1 write )
+    {
+        const Value* domain = &value;
+        u64 element = ANY;
+
+        while( isa< ExtractInstruction >( domain ) )
+        {
+            const auto& instr = static_cast< const Instruction& >( *domain );
+            const auto& index = *instr.operand( 1 );
+            element = isa< BitConstant >( index )
+                          ? static_cast< const BitConstant& >( index ).value().value()
+                          : ANY;
+            domain = instr.operand( 0 ).get();
+        }
+
+        return Access{ domain, element == ELEMENTS ? ANY : element, write };
+    }
+
+    static void access( const Access& access, std::vector< Access >& result )
+    {
+        const auto& domain = *static_cast< const Value* >( access.domain );
+
+        result.emplace_back( access );
+        if( isa< Variable >( domain ) or isa< Memory >( domain ) )
+        {
+            result.emplace_back( Access{ &WORLD, ANY, false } );
+            if( access.write )
+            {
+                result.emplace_back( Access{ &FAULT, ANY, false } );
+            }
+        }
+    }
+
+    static void accesses( const Instruction& instr, std::vector< Access >& result )
+    {
+        // storage operands are read implicitly, except for the location of a
+        // 'load' or 'store' and the base of an 'extract' which are addressed
+        const auto& operands = instr.operands();
+        for( u32 c = 0; c < operands.size(); c++ )
+        {
+            const u1 addressed = ( c == 0 and ( isa< LoadInstruction >( instr ) or
+                                                  isa< ExtractInstruction >( instr ) ) ) or
+                                 ( c == 1 and isa< StoreInstruction >( instr ) );
+
+            if( not addressed and Instruction::storage( *operands[ c ] ) )
+            {
+                access( location( *operands[ c ], false ), result );
+            }
+        }
+
+        switch( instr.id() )
+        {
+            case Value::LOAD_INSTRUCTION:
+            {
+                access( location( *instr.operand( 0 ), false ), result );
+                break;
+            }
+            case Value::STORE_INSTRUCTION:
+            {
+                access( location( *instr.operand( 1 ), true ), result );
+                break;
+            }
+            case Value::CALL_INSTRUCTION:     // fall-through
+            case Value::ID_CALL_INSTRUCTION:  // fall-through
+            case Value::STREAM_INSTRUCTION:
+            {
+                result.emplace_back( Access{ &WORLD, ANY, true } );
+                result.emplace_back( Access{ &FAULT, ANY, true } );
+                break;
+            }
+            default:
+            {
+                if( instr.mayFault() )
+                {
+                    result.emplace_back( Access{ &FAULT, ANY, true } );
+                }
+                break;
+            }
+        }
+    }
+
+    /**
+       the level of a block has to follow every conflicting access, an
+       element conflicts with itself and with all elements, all elements
+       conflict with every element
+    */
+
+    class Domains
+    {
+      public:
+        u32 level( const Access& access )
+        {
+            u32 result = 0;
+            follow( result, Key{ access.domain, ANY }, access.write );
+            follow( result,
+                Key{ access.domain, access.element == ANY ? ELEMENTS : access.element },
+                access.write );
+            return result;
+        }
+
+        void update( const Access& access, u32 level )
+        {
+            update( Key{ access.domain, access.element }, access.write, level );
+            if( access.element != ANY )
+            {
+                update( Key{ access.domain, ELEMENTS }, access.write, level );
+            }
+        }
+
+      private:
+        void follow( u32& level, const Key& key, u1 write ) const
+        {
+            const auto result = m_levels.find( key );
+            if( result == m_levels.end() )
+            {
+                return;
+            }
+
+            level = std::max( level, result->second.writer );
+            if( write )
+            {
+                level = std::max( level, result->second.reader );
+            }
+        }
+
+        void update( const Key& key, u1 write, u32 level )
+        {
+            auto& levels = m_levels[ key ];
+            auto& last = write ? levels.writer : levels.reader;
+            last = std::max( last, level + 1 );
+        }
+
+        std::unordered_map< Key, Levels, KeyHash > m_levels;
+    };
+}
+
+u64 CjelIRParallelizationPass::parallelize( const Module& module, SequentialScope& scope )
+{
+    std::vector< Block::Ptr > blocks( scope.blocks().begin(), scope.blocks().end() );
+    if( blocks.size() < 2 )
+    {
+        return 0;
+    }
+
+    std::unordered_map< const Value*, u32 > definitions;
+    Domains domains;
+    std::vector< const Instruction* > instructions;
+    std::vector< Access > effects;
+    std::vector< u32 > levels( blocks.size(), 0 );
+    u32 depth = 0;
+
+    for( u32 index = 0; index < blocks.size(); index++ )
+    {
+        instructions.clear();
+        effects.clear();
+        collect( *blocks[ index ], instructions );
+
+        u32 level = 0;
+        for( const auto instr : instructions )
+        {
+            for( const auto& operand : instr->operands() )
+            {
+                const auto result = definitions.find( operand.get() );
+                if( result != definitions.end() )
+                {
+                    level = std::max( level, levels[ result->second ] + 1 );
+                }
+            }
+            accesses( *instr, effects );
+        }
+
+        for( const auto& access : effects )
+        {
+            level = std::max( level, domains.level( access ) );
+        }
+        for( const auto& access : effects )
+        {
+            domains.update( access, level );
+        }
+        for( const auto instr : instructions )
+        {
+            definitions.emplace( instr, index );
+        }
+
+        levels[ index ] = level;
+        depth = std::max( depth, level + 1 );
+    }
+
+    // every block depends on its predecessor
+    if( depth == blocks.size() )
+    {
+        return 0;
+    }
+
+    std::vector< std::vector< Block::Ptr > > groups( depth );
+    for( u32 index = 0; index < blocks.size(); index++ )
+    {
+        groups[ levels[ index ] ].emplace_back( blocks[ index ] );
+    }
+
+    const auto parent = blocks.front()->parent();
+    scope.remove( []( const Block& ) { return true; } );
+
+    u64 created = 0;
+    for( const auto& group : groups )
+    {
+        if( group.size() == 1 )
+        {
+            scope.add( group.front() );
+            continue;
+        }
+
+        const auto parallel = module.make< ParallelScope >();
+        parallel->setParent( parent );
+        for( const auto& block : group )
+        {
+            block->setParent( parallel );
+            parallel->add( block );
+        }
+
+        scope.add( parallel );
+        created++;
+    }
+
+    return created;
+}
+
+u64 CjelIRParallelizationPass::parallelize( Module& module )
+{
+    // scopes are collected first, regrouping adds parallel scopes
+    std::vector< SequentialScope* > scopes;
+    module.iterate( PREORDER, [&scopes]( Value& value ) {
+        if( isa< SequentialScope >( value ) )
+        {
+            scopes.emplace_back( static_cast< SequentialScope* >( &value ) );
+        }
+    } );
+
+    u64 created = 0;
+    for( auto scope : scopes )
+    {
+        created += parallelize( module, *scope );
+    }
+
+    return created;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,527 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRToBinaryPass.h"
+
+#include <libcjel-ir/CallableUnit>
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Interconnect>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Variable>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+using namespace libcjel_ir;
+
+char CjelIRToBinaryPass::id = 0;
+
+static libpass::PassRegistration< CjelIRToBinaryPass > PASS(
+    "CJEL IR to Binary Pass",
+    "serializes the CJEL IR into a memory-mappable binary module",
+    "el2bin",
+    0 );
+
+bool CjelIRToBinaryPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRToBinaryPass >();
+    assert( data );
+
+    try
+    {
+        const auto binary = encode( *data->module() );
+
+        std::ofstream file( data->filename(), std::ios::binary | std::ios::trunc );
+        file.write( binary.data(), binary.size() );
+
+        if( not file )
+        {
+            fprintf( stderr, "unable to write binary module '%s'\n", data->filename().c_str() );
+            return false;
+        }
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful binary module generation: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    class Writer
+    {
+      public:
+        std::string write( const Module& module )
+        {
+            const auto name = string( module.name() );
+
+            // module contents in the order of the module traversal
+            content< Structure >( module );
+            content< Constant >( module );
+            content< Variable >( module );
+            content< Memory >( module );
+            content< Interconnect >( module );
+            content< Intrinsic >( module );
+            content< Function >( module );
+
+            for( const auto& p : module.get< Intrinsic >() )
+            {
+                body( static_cast< const CallableUnit& >( *p ) );
+            }
+
+            for( const auto& p : module.get< Function >() )
+            {
+                body( static_cast< const CallableUnit& >( *p ) );
+            }
+
+            for( u32 c = 0; c < m_values.size(); c++ )
+            {
+                m_values[ c ].parent = parent( m_objects[ c ] );
+            }
+
+            return assemble( name );
+        }
+
+      private:
+        template < typename T >
+        void content( const Module& module )
+        {
+            for( const auto& p : module.get< T >() )
+            {
+                m_contents.emplace_back( value( p.get() ) );
+            }
+        }
+
+        u32 string( const std::string& text )
+        {
+            const auto result = m_string2index.emplace( text, m_strings.size() );
+            if( result.second )
+            {
+                m_strings.push_back( { static_cast< u32 >( m_blob.size() ),
+                    static_cast< u32 >( text.size() ) } );
+                m_blob.append( text.c_str(), text.size() + 1 );
+            }
+
+            return result.first->second;
+        }
+
+        u32 list( const std::vector< u32 >& indices )
+        {
+            const u32 first = m_operands.size();
+            m_operands.insert( m_operands.end(), indices.begin(), indices.end() );
+            return first;
+        }
+
+        u32 type( const Type* type )
+        {
+            if( not type )
+            {
+                return Binary::None;
+            }
+
+            const auto result = m_type2index.find( type->uid() );
+            if( result != m_type2index.end() )
+            {
+                return result->second;
+            }
+
+            Binary::TypeRecord record = {};
+            record.id = type->id();
+
+            if( type->isBit() )
+            {
+                record.length = type->bitsize();
+            }
+            else if( type->isVector() )
+            {
+                record.first = this->type( type->ptr_results()[ 0 ].get() );
+                record.length = type->results().size();
+            }
+            else if( type->isStructure() )
+            {
+                const auto structure = static_cast< const StructureType* >( type );
+                record.first = value( structure->ptr_kind().get() );
+            }
+            else if( type->isRelation() )
+            {
+                std::vector< u32 > indices;
+                for( const auto& result : type->results() )
+                {
+                    indices.emplace_back( this->type( result.get() ) );
+                }
+                for( const auto& argument : type->arguments() )
+                {
+                    indices.emplace_back( this->type( argument.get() ) );
+                }
+
+                record.first = list( indices );
+                record.count = type->results().size();
+                record.extra = type->arguments().size();
+            }
+
+            const u32 index = m_types.size();
+            m_types.emplace_back( record );
+            m_type2index.emplace( type->uid(), index );
+            return index;
+        }
+
+        u32 record( const Value* value, u8 flags = 0 )
+        {
+            Binary::ValueRecord record = {};
+            record.id = value->id();
+            record.flags = flags;
+            record.name = string( value->name() );
+            record.type = type( value->ptr_type().get() );
+            record.parent = Binary::None;
+
+            const u32 index = m_values.size();
+            m_values.emplace_back( record );
+            m_objects.emplace_back( value );
+            return index;
+        }
+
+        void operands( u32 index, const std::vector< u32 >& indices )
+        {
+            m_values[ index ].first = list( indices );
+            m_values[ index ].count = indices.size();
+        }
+
+        u32 value( const Value* value )
+        {
+            if( not value )
+            {
+                return Binary::None;
+            }
+
+            const auto result = m_value2index.find( value );
+            if( result != m_value2index.end() )
+            {
+                return result->second;
+            }
+
+            u32 index;
+
+            if( isa< Constant >( value ) )
+            {
+                index = constant( static_cast< const Constant& >( *value ) );
+            }
+            else if( isa< Instruction >( value ) )
+            {
+                index = instruction( static_cast< const Instruction& >( *value ) );
+            }
+            else if( isa< Variable >( value ) )
+            {
+                const auto& variable = static_cast< const Variable& >( *value );
+                const auto expression = this->value( variable.expression().get() );
+
+                index = record( value );
+                operands( index, { expression } );
+            }
+            else if( isa< Structure >( value ) )
+            {
+                std::vector< u32 > indices;
+                for( const auto& element : static_cast< const Structure& >( *value ).elements() )
+                {
+                    indices.emplace_back( type( std::get< 0 >( element ).get() ) );
+                    indices.emplace_back( string( std::get< 1 >( element ) ) );
+                }
+
+                index = record( value );
+                m_values[ index ].first = list( indices );
+                m_values[ index ].count = indices.size() / 2;
+            }
+            else if( isa< Memory >( value ) )
+            {
+                index = record( value );
+                m_values[ index ].payload = static_cast< const Memory& >( *value ).length();
+            }
+            else if( isa< Interconnect >( value ) )
+            {
+                std::vector< u32 > indices;
+                for( const auto& object : static_cast< const Interconnect& >( *value ).objects() )
+                {
+                    indices.emplace_back( this->value( object.get() ) );
+                }
+
+                index = record( value );
+                operands( index, indices );
+            }
+            else if( isa< CallableUnit >( value ) )
+            {
+                // the references and the context are emitted with the body
+                index = record( value );
+                m_values[ index ].payload = Binary::None;
+            }
+            else if( isa< Reference >( value ) )
+            {
+                index = record( value, static_cast< const Reference& >( *value ).kind() );
+            }
+            else if( isa< Block >( value ) )
+            {
+                return block( static_cast< const Block& >( *value ) );
+            }
+            else
+            {
+                throw std::domain_error(
+                    "unsupported value '" + value->description() + "' in binary module" );
+            }
+
+            m_value2index.emplace( value, index );
+            return index;
+        }
+
+        u32 constant( const Constant& constant )
+        {
+            if( isa< BitConstant >( constant ) )
+            {
+                const u32 index = record( &constant );
+                m_values[ index ].payload =
+                    static_cast< const BitConstant& >( constant ).value().value();
+                return index;
+            }
+            else if( isa< StructureConstant >( constant ) )
+            {
+                // elements are stored by value, their records are never shared
+                std::vector< u32 > indices;
+                for( const auto& element :
+                    static_cast< const StructureConstant& >( constant ).value() )
+                {
+                    indices.emplace_back( this->constant( element ) );
+                    m_objects.back() = nullptr;
+                }
+
+                const u32 index = record( &constant );
+                operands( index, indices );
+                return index;
+            }
+
+            return record( &constant );
+        }
+
+        u32 instruction( const Instruction& instruction )
+        {
+            std::vector< u32 > indices;
+            for( const auto& operand : instruction.operands() )
+            {
+                indices.emplace_back( value( operand.get() ) );
+            }
+
+            u8 flags = 0;
+            if( isa< StreamInstruction >( instruction ) )
+            {
+                flags = static_cast< const StreamInstruction& >( instruction ).channel();
+            }
+
+            const u32 index = record( &instruction, flags );
+            operands( index, indices );
+            return index;
+        }
+
+        u32 block( const Block& block )
+        {
+            const u32 index = record( &block );
+            m_value2index.emplace( &block, index );
+
+            std::vector< u32 > indices;
+
+            if( isa< Scope >( block ) )
+            {
+                for( const auto& child : static_cast< const Scope& >( block ).blocks() )
+                {
+                    indices.emplace_back( value( child.get() ) );
+                }
+
+                operands( index, indices );
+            }
+            else
+            {
+                const auto& statement = static_cast< const Statement& >( block );
+
+                for( const auto& instruction : statement.instructions() )
+                {
+                    indices.emplace_back( value( instruction.get() ) );
+                }
+
+                const u32 count = indices.size();
+
+                for( const auto& scope : statement.scopes() )
+                {
+                    indices.emplace_back( value( scope.get() ) );
+                }
+
+                operands( index, indices );
+                m_values[ index ].count = count;
+                m_values[ index ].payload = indices.size() - count;
+            }
+
+            return index;
+        }
+
+        void body( const CallableUnit& callable )
+        {
+            const auto index = value( &callable );
+            const u32 first = m_values.size();
+
+            std::vector< u32 > indices;
+            for( const auto& references :
+                { callable.inputs(), callable.outputs(), callable.linkage() } )
+            {
+                for( const auto& reference : references )
+                {
+                    indices.emplace_back( value( reference.get() ) );
+                }
+            }
+
+            operands( index, indices );
+
+            const auto context = value( callable.context().get() );
+            m_values[ index ].payload = context;
+
+            m_functions.push_back(
+                { index, context, first, static_cast< u32 >( m_values.size() - first ) } );
+        }
+
+        u32 parent( const Value* value )
+        {
+            if( not value )
+            {
+                return Binary::None;
+            }
+
+            const Value* parent = nullptr;
+
+            if( isa< Instruction >( value ) )
+            {
+                parent = static_cast< const Instruction* >( value )->statement().get();
+            }
+            else if( isa< Block >( value ) )
+            {
+                parent = static_cast< const Block* >( value )->parent().get();
+            }
+            else if( isa< Reference >( value ) )
+            {
+                parent = static_cast< const Reference* >( value )->callable().get();
+            }
+
+            const auto result = m_value2index.find( parent );
+            return result != m_value2index.end() ? result->second : Binary::None;
+        }
+
+        template < typename T >
+        Binary::Section section( std::string& buffer, const std::vector< T >& records )
+        {
+            const Binary::Section section = { buffer.size(), records.size() };
+            buffer.append(
+                reinterpret_cast< const char* >( records.data() ), records.size() * sizeof( T ) );
+            buffer.resize( ( buffer.size() + 7 ) & ~7 );
+            return section;
+        }
+
+        std::string assemble( u32 name )
+        {
+            std::string buffer( sizeof( Binary::Header ), '\0' );
+
+            Binary::Header header = {};
+            std::memcpy( header.magic, Binary::Magic, sizeof( header.magic ) );
+            header.version = Binary::Version;
+            header.endian = Binary::Endian;
+            header.name = name;
+
+            header.strings = section( buffer, m_strings );
+            buffer.append( m_blob );
+            buffer.resize( ( buffer.size() + 7 ) & ~7 );
+
+            header.types = section( buffer, m_types );
+            header.values = section( buffer, m_values );
+            header.functions = section( buffer, m_functions );
+            header.operands = section( buffer, m_operands );
+            header.contents = section( buffer, m_contents );
+            header.size = buffer.size();
+
+            std::memcpy( &buffer[ 0 ], &header, sizeof( header ) );
+            return buffer;
+        }
+
+        std::vector< Binary::String > m_strings;
+        std::string m_blob;
+        std::unordered_map< std::string, u32 > m_string2index;
+
+        std::vector< Binary::TypeRecord > m_types;
+        std::unordered_map< u32, u32 > m_type2index;
+
+        std::vector< Binary::ValueRecord > m_values;
+        std::vector< const Value* > m_objects;
+        std::unordered_map< const Value*, u32 > m_value2index;
+
+        std::vector< Binary::FunctionRecord > m_functions;
+        std::vector< u32 > m_operands;
+        std::vector< u32 > m_contents;
+    };
+}
+
+std::string CjelIRToBinaryPass::encode( const Module& module )
+{
+    Writer writer;
+    return writer.write( module );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,1046 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRToC11Pass.h"
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Variable>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <fstream>
+#include <set>
+
+using namespace libcjel_ir;
+
+char CjelIRToC11Pass::id = 0;
+
+static libpass::PassRegistration< CjelIRToC11Pass > PASS(
+    "CJEL IR to C11 Pass", "emits the CJEL IR as C11 source code", "el2c11", 0 );
+
+bool CjelIRToC11Pass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRToC11Pass >();
+    assert( data );
+
+    try
+    {
+        const auto source = emit( *data->module() );
+
+        std::ofstream file( data->filename(), std::ios::trunc );
+        file << source;
+
+        if( not file )
+        {
+            fprintf( stderr, "unable to write C11 source '%s'\n", data->filename().c_str() );
+            return false;
+        }
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful C11 code generation: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    static const char* PRELUDE = R"***(#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined( __GNUC__ )
+#define CJEL_PACKED __attribute__( ( packed ) )
+#else
+#define CJEL_PACKED
+#endif
+
+static inline uint64_t cjel_index( uint64_t index, uint64_t length )
+{
+    if( index >= length )
+    {
+        abort();
+    }
+    return index;
+}
+
+static inline uint64_t cjel_divs( uint64_t lhs, uint64_t rhs, unsigned bits )
+{
+    const uint64_t sign = (uint64_t)1 << ( bits - 1 );
+    const int64_t l = (int64_t)( ( lhs ^ sign ) - sign );
+    const int64_t r = (int64_t)( ( rhs ^ sign ) - sign );
+    if( r == 0 )
+    {
+        abort();
+    }
+    return r == -1 ? 0 - (uint64_t)l : (uint64_t)( l / r );
+}
+
+static inline uint64_t cjel_modu( uint64_t lhs, uint64_t rhs )
+{
+    if( rhs == 0 )
+    {
+        abort();
+    }
+    return lhs % rhs;
+}
+
+static inline void cjel_wide_add( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words, uint64_t mask )
+{
+    uint64_t carry = 0;
+    for( unsigned i = 0; i < words; i++ )
+    {
+        const uint64_t s = a[ i ] + carry;
+        carry = s < carry;
+        r[ i ] = s + b[ i ];
+        carry += r[ i ] < s;
+    }
+    r[ words - 1 ] &= mask;
+}
+
+static inline void cjel_wide_and( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words )
+{
+    for( unsigned i = 0; i < words; i++ )
+    {
+        r[ i ] = a[ i ] & b[ i ];
+    }
+}
+
+static inline void cjel_wide_or( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words )
+{
+    for( unsigned i = 0; i < words; i++ )
+    {
+        r[ i ] = a[ i ] | b[ i ];
+    }
+}
+
+static inline void cjel_wide_xor( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words )
+{
+    for( unsigned i = 0; i < words; i++ )
+    {
+        r[ i ] = a[ i ] ^ b[ i ];
+    }
+}
+
+static inline void cjel_wide_not( uint64_t* r, const uint64_t* a, unsigned words,
+    uint64_t mask )
+{
+    for( unsigned i = 0; i < words; i++ )
+    {
+        r[ i ] = ~a[ i ];
+    }
+    r[ words - 1 ] &= mask;
+}
+
+static inline uint8_t cjel_wide_equ( const uint64_t* a, const uint64_t* b, unsigned words )
+{
+    for( unsigned i = 0; i < words; i++ )
+    {
+        if( a[ i ] != b[ i ] )
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static inline uint8_t cjel_wide_lnot( const uint64_t* a, unsigned words )
+{
+    uint64_t any = 0;
+    for( unsigned i = 0; i < words; i++ )
+    {
+        any |= a[ i ];
+    }
+    return any == 0;
+}
+
+static inline uint8_t cjel_wide_geq( const uint64_t* a, const uint64_t* b, unsigned words )
+{
+    for( unsigned i = words; i-- > 0; )
+    {
+        if( a[ i ] != b[ i ] )
+        {
+            return a[ i ] > b[ i ];
+        }
+    }
+    return 1;
+}
+
+static inline void cjel_wide_neg( uint64_t* r, const uint64_t* a, unsigned words )
+{
+    uint64_t carry = 1;
+    for( unsigned i = 0; i < words; i++ )
+    {
+        r[ i ] = ~a[ i ] + carry;
+        carry = carry && r[ i ] == 0;
+    }
+}
+
+/* bit-wise long division, 'words' is at most 8 (512 bits) */
+static inline void cjel_wide_divmod( uint64_t* q, uint64_t* m, const uint64_t* a,
+    const uint64_t* b, unsigned words )
+{
+    if( cjel_wide_lnot( b, words ) )
+    {
+        abort();
+    }
+    memset( q, 0, words * sizeof( uint64_t ) );
+    memset( m, 0, words * sizeof( uint64_t ) );
+    for( unsigned i = words * 64; i-- > 0; )
+    {
+        uint64_t carry = ( a[ i / 64 ] >> ( i % 64 ) ) & 1;
+        for( unsigned k = 0; k < words; k++ )
+        {
+            const uint64_t next = m[ k ] >> 63;
+            m[ k ] = ( m[ k ] << 1 ) | carry;
+            carry = next;
+        }
+        if( carry || cjel_wide_geq( m, b, words ) )
+        {
+            uint64_t borrow = 0;
+            for( unsigned k = 0; k < words; k++ )
+            {
+                const uint64_t d = m[ k ] - b[ k ] - borrow;
+                borrow = m[ k ] < b[ k ] || ( m[ k ] == b[ k ] && borrow );
+                m[ k ] = d;
+            }
+            q[ i / 64 ] |= (uint64_t)1 << ( i % 64 );
+        }
+    }
+}
+
+static inline void cjel_wide_divs( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words, unsigned bits )
+{
+    const uint64_t sign = (uint64_t)1 << ( ( bits - 1 ) % 64 );
+    const uint64_t mask = sign | ( sign - 1 );
+    const int negative = ( ( a[ words - 1 ] ^ b[ words - 1 ] ) & sign ) != 0;
+    uint64_t x[ 8 ], y[ 8 ], q[ 8 ], m[ 8 ];
+    memcpy( x, a, words * sizeof( uint64_t ) );
+    memcpy( y, b, words * sizeof( uint64_t ) );
+    if( x[ words - 1 ] & sign )
+    {
+        cjel_wide_neg( x, x, words );
+        x[ words - 1 ] &= mask;
+    }
+    if( y[ words - 1 ] & sign )
+    {
+        cjel_wide_neg( y, y, words );
+        y[ words - 1 ] &= mask;
+    }
+    cjel_wide_divmod( q, m, x, y, words );
+    if( negative )
+    {
+        cjel_wide_neg( q, q, words );
+    }
+    q[ words - 1 ] &= mask;
+    memcpy( r, q, words * sizeof( uint64_t ) );
+}
+
+static inline void cjel_wide_modu( uint64_t* r, const uint64_t* a, const uint64_t* b,
+    unsigned words )
+{
+    uint64_t q[ 8 ], m[ 8 ];
+    cjel_wide_divmod( q, m, a, b, words );
+    memcpy( r, m, words * sizeof( uint64_t ) );
+}
+)***";
+
+    std::string identifier( const std::string& name )
+    {
+        std::string result( name );
+        for( auto& c : result )
+        {
+            if( not( ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+                     ( c >= '0' and c <= '9' ) or c == '_' ) )
+            {
+                c = '_';
+            }
+        }
+
+        if( result.empty() or ( result[ 0 ] >= '0' and result[ 0 ] <= '9' ) )
+        {
+            result = "_" + result;
+        }
+
+        return result;
+    }
+
+    std::string number( u64 value )
+    {
+        return "UINT64_C( " + std::to_string( value ) + " )";
+    }
+
+    u64 mask( u16 bits )
+    {
+        return bits >= 64 ? ~( (u64)0 ) : ( ( (u64)1 << bits ) - 1 );
+    }
+
+    u32 words( u16 bits )
+    {
+        return ( bits + 63 ) / 64;
+    }
+
+    /**
+       mask of the most significant word of a wide bit type
+    */
+
+    u64 top( u16 bits )
+    {
+        return mask( bits % 64 == 0 ? 64 : bits % 64 );
+    }
+
+    u1 wide( const Type& type )
+    {
+        return type.isBit() and type.bitsize() > 64;
+    }
+
+    class TypeEmitter
+    {
+      public:
+        std::string name( const Type& type )
+        {
+            if( type.isBit() )
+            {
+                const auto bits = type.bitsize();
+                if( bits <= 8 )
+                {
+                    return "uint8_t";
+                }
+                if( bits <= 16 )
+                {
+                    return "uint16_t";
+                }
+                if( bits <= 32 )
+                {
+                    return "uint32_t";
+                }
+                if( bits <= 64 )
+                {
+                    return "uint64_t";
+                }
+
+                m_wide.insert( bits );
+                return "cjel_b" + std::to_string( bits );
+            }
+
+            if( type.isStructure() )
+            {
+                return "struct " +
+                       identifier( static_cast< const StructureType& >( type ).kind().name() );
+            }
+
+            throw std::domain_error( "C11 backend does not support type '" + type.name() + "'" );
+        }
+
+        std::string literal( const Type& type, u64 value )
+        {
+            if( wide( type ) )
+            {
+                return "( " + name( type ) + " ){ { " + number( value ) + " } }";
+            }
+
+            return number( value & mask( type.bitsize() ) );
+        }
+
+        std::string signature( const CallableUnit& callable )
+        {
+            std::string result = "void " + identifier( callable.name() ) + "(";
+            std::string separator = " ";
+
+            for( const auto& reference : callable.inputs() )
+            {
+                result += separator + name( reference->type() ) + " " +
+                          identifier( reference->name() );
+                separator = ", ";
+            }
+
+            for( const auto& reference : callable.outputs() )
+            {
+                result += separator + name( reference->type() ) + "* " +
+                          identifier( reference->name() );
+                separator = ", ";
+            }
+
+            return result + ( separator == " " ? "void )" : " )" );
+        }
+
+        void merge( const TypeEmitter& other )
+        {
+            m_wide.insert( other.m_wide.begin(), other.m_wide.end() );
+        }
+
+        std::string definitions( void ) const
+        {
+            std::string result;
+            for( const auto bits : m_wide )
+            {
+                result += "typedef struct\n{\n    uint64_t word[ " +
+                          std::to_string( words( bits ) ) + " ];\n} cjel_b" +
+                          std::to_string( bits ) + ";\n\n";
+            }
+            return result;
+        }
+
+      private:
+        std::set< u16 > m_wide;
+    };
+
+    class FunctionEmitter
+    {
+      public:
+        FunctionEmitter( const Function& function, TypeEmitter& types )
+        : m_function( function )
+        , m_types( types )
+        , m_temporaries( 0 )
+        , m_indention( 1 )
+        {
+        }
+
+        std::string emit( void )
+        {
+            for( const auto& reference : m_function.inputs() )
+            {
+                m_names.emplace( reference.get(), identifier( reference->name() ) );
+            }
+
+            for( const auto& reference : m_function.outputs() )
+            {
+                m_names.emplace(
+                    reference.get(), "( *" + identifier( reference->name() ) + " )" );
+            }
+
+            for( const auto& reference : m_function.linkage() )
+            {
+                const auto name = identifier( reference->name() );
+                m_names.emplace( reference.get(), name );
+                m_declarations += "    " + m_types.name( reference->type() ) + " " + name + ";\n";
+                line( "memset( &" + name + ", 0, sizeof( " + name + " ) );" );
+            }
+
+            blocks( *m_function.context() );
+
+            return m_types.signature( m_function ) + "\n{\n" + m_declarations +
+                   ( m_declarations.empty() ? "" : "\n" ) + m_body + "}\n";
+        }
+
+      private:
+        void line( const std::string& text )
+        {
+            m_body.append( m_indention * 4, ' ' );
+            m_body += text;
+            m_body += "\n";
+        }
+
+        std::string temporary( const Instruction& instr )
+        {
+            const auto name = "v_" + std::to_string( m_temporaries++ );
+            m_declarations += "    " + m_types.name( instr.type() ) + " " + name + ";\n";
+            m_names.emplace( &instr, name );
+            return name;
+        }
+
+        std::string expression( const Value& value )
+        {
+            const auto result = m_names.find( &value );
+            if( result != m_names.end() )
+            {
+                return result->second;
+            }
+
+            if( isa< BitConstant >( value ) )
+            {
+                return m_types.literal(
+                    value.type(), static_cast< const BitConstant& >( value ).value().value() );
+            }
+
+            if( isa< Variable >( value ) or isa< Memory >( value ) )
+            {
+                return identifier( value.name() );
+            }
+
+            throw std::domain_error(
+                "value '" + value.name() + "' is used before its definition" );
+        }
+
+        void scope( const Scope& scope )
+        {
+            line( "{" );
+            m_indention++;
+            blocks( scope );
+            m_indention--;
+            line( "}" );
+        }
+
+        void blocks( const Scope& scope )
+        {
+            for( const auto& child : scope.blocks() )
+            {
+                if( isa< Scope >( child ) )
+                {
+                    this->scope( static_cast< const Scope& >( *child ) );
+                }
+                else
+                {
+                    statement( static_cast< const Statement& >( *child ) );
+                }
+            }
+        }
+
+        void statement( const Statement& statement )
+        {
+            const auto& instructions = statement.instructions();
+            if( instructions.size() == 0 )
+            {
+                throw std::domain_error( "a statement must contain at least one instruction" );
+            }
+
+            if( isa< TrivialStatement >( statement ) )
+            {
+                for( const auto& instr : instructions )
+                {
+                    instruction( *instr );
+                }
+                return;
+            }
+
+            const auto& scopes = statement.scopes();
+            if( scopes.size() == 0 )
+            {
+                throw std::domain_error( "statement '" + statement.name() + "' has no scope" );
+            }
+
+            if( isa< LoopStatement >( statement ) )
+            {
+                line( "for( ;; )" );
+                line( "{" );
+                m_indention++;
+            }
+
+            for( const auto& instr : instructions )
+            {
+                instruction( *instr );
+            }
+
+            const auto& last = *instructions[ instructions.size() - 1 ];
+            if( m_names.count( &last ) == 0 or wide( last.type() ) )
+            {
+                throw std::domain_error( "last instruction of statement '" + statement.name() +
+                                         "' does not produce a condition" );
+            }
+            const auto condition = expression( last );
+
+            if( isa< LoopStatement >( statement ) )
+            {
+                line( "if( !" + condition + " )" );
+                line( "{" );
+                line( "    break;" );
+                line( "}" );
+                scope( *scopes[ 0 ] );
+                m_indention--;
+                line( "}" );
+            }
+            else if( scopes.size() <= 2 )
+            {
+                line( "if( " + condition + " )" );
+                scope( *scopes[ 0 ] );
+
+                if( scopes.size() == 2 )
+                {
+                    line( "else" );
+                    scope( *scopes[ 1 ] );
+                }
+            }
+            else
+            {
+                line( "switch( " + condition + " )" );
+                line( "{" );
+                for( u32 c = 0; c < scopes.size(); c++ )
+                {
+                    line( "case " + std::to_string( c ) + ":" );
+                    scope( *scopes[ c ] );
+                    line( "break;" );
+                }
+                line( "}" );
+            }
+        }
+
+        void instruction( const Instruction& instr )
+        {
+            switch( instr.id() )
+            {
+                case Value::NOP_INSTRUCTION:
+                {
+                    break;
+                }
+                case Value::ALLOC_INSTRUCTION:
+                {
+                    const auto t = temporary( instr );
+                    line( "memset( &" + t + ", 0, sizeof( " + t + " ) );" );
+                    break;
+                }
+                case Value::LOAD_INSTRUCTION:
+                {
+                    const auto src = expression( *instr.operand( 0 ) );
+                    line( temporary( instr ) + " = " + src + ";" );
+                    break;
+                }
+                case Value::STORE_INSTRUCTION:
+                {
+                    const auto src = expression( *instr.operand( 0 ) );
+                    line( expression( *instr.operand( 1 ) ) + " = " + src + ";" );
+                    break;
+                }
+                case Value::EXTRACT_INSTRUCTION:
+                {
+                    extract( instr );
+                    break;
+                }
+                case Value::CALL_INSTRUCTION:
+                {
+                    const auto& callee = *instr.operand( 0 );
+                    std::string arguments;
+                    for( u32 c = 1; c < instr.operands().size(); c++ )
+                    {
+                        arguments += expression( *instr.operand( c ) ) + ", ";
+                    }
+                    const auto t = temporary( instr );
+                    line( identifier( callee.name() ) + "( " + arguments + "&" + t + " );" );
+                    break;
+                }
+                case Value::ZEXT_INSTRUCTION:
+                {
+                    const auto& src = *instr.operand( 0 );
+                    const auto a = expression( src );
+                    const auto t = temporary( instr );
+
+                    if( not wide( instr.type() ) )
+                    {
+                        line( t + " = " + a + ";" );
+                    }
+                    else
+                    {
+                        line( "memset( &" + t + ", 0, sizeof( " + t + " ) );" );
+                        if( wide( src.type() ) )
+                        {
+                            line( "memcpy( " + t + ".word, " + a + ".word, sizeof( " + a +
+                                  ".word ) );" );
+                        }
+                        else
+                        {
+                            line( t + ".word[ 0 ] = " + a + ";" );
+                        }
+                    }
+                    break;
+                }
+                case Value::TRUNC_INSTRUCTION:
+                {
+                    const auto& src = *instr.operand( 0 );
+                    const auto a = expression( src );
+                    const auto t = temporary( instr );
+                    const auto bits = instr.type().bitsize();
+
+                    if( wide( instr.type() ) )
+                    {
+                        line( "memcpy( " + t + ".word, " + a + ".word, sizeof( " + t +
+                              ".word ) );" );
+                        line( t + ".word[ " + std::to_string( words( bits ) - 1 ) +
+                              " ] &= " + number( top( bits ) ) + ";" );
+                    }
+                    else
+                    {
+                        line( t + " = " + a + ( wide( src.type() ) ? ".word[ 0 ]" : "" ) +
+                              " & " + number( mask( bits ) ) + ";" );
+                    }
+                    break;
+                }
+                case Value::NOT_INSTRUCTION:
+                {
+                    const auto a = expression( *instr.operand( 0 ) );
+                    const auto t = temporary( instr );
+                    const auto bits = instr.type().bitsize();
+
+                    if( wide( instr.type() ) )
+                    {
+                        line( "cjel_wide_not( " + t + ".word, " + a + ".word, " +
+                              std::to_string( words( bits ) ) + ", " + number( top( bits ) ) +
+                              " );" );
+                    }
+                    else
+                    {
+                        line( t + " = ~" + a + " & " + number( mask( bits ) ) + ";" );
+                    }
+                    break;
+                }
+                case Value::LNOT_INSTRUCTION:
+                {
+                    const auto& src = *instr.operand( 0 );
+                    const auto a = expression( src );
+
+                    if( wide( src.type() ) )
+                    {
+                        line( temporary( instr ) + " = cjel_wide_lnot( " + a + ".word, " +
+                              std::to_string( words( src.type().bitsize() ) ) + " );" );
+                    }
+                    else
+                    {
+                        line( temporary( instr ) + " = !" + a + ";" );
+                    }
+                    break;
+                }
+                case Value::AND_INSTRUCTION:
+                {
+                    bitwise( instr, "&", "and" );
+                    break;
+                }
+                case Value::OR_INSTRUCTION:
+                {
+                    bitwise( instr, "|", "or" );
+                    break;
+                }
+                case Value::XOR_INSTRUCTION:
+                {
+                    bitwise( instr, "^", "xor" );
+                    break;
+                }
+                case Value::ADDS_INSTRUCTION:  // fall-through, equal in two's complement
+                case Value::ADDU_INSTRUCTION:
+                {
+                    const auto a = expression( *instr.operand( 0 ) );
+                    const auto b = expression( *instr.operand( 1 ) );
+                    const auto t = temporary( instr );
+                    const auto bits = instr.type().bitsize();
+
+                    if( wide( instr.type() ) )
+                    {
+                        line( "cjel_wide_add( " + t + ".word, " + a + ".word, " + b +
+                              ".word, " + std::to_string( words( bits ) ) + ", " +
+                              number( top( bits ) ) + " );" );
+                    }
+                    else
+                    {
+                        line( t + " = ( " + a + " + " + b + " ) & " + number( mask( bits ) ) +
+                              ";" );
+                    }
+                    break;
+                }
+                case Value::DIVS_INSTRUCTION:
+                {
+                    const auto a = expression( *instr.operand( 0 ) );
+                    const auto b = expression( *instr.operand( 1 ) );
+                    const auto t = temporary( instr );
+                    const auto bits = instr.type().bitsize();
+
+                    if( wide( instr.type() ) )
+                    {
+                        line( "cjel_wide_divs( " + t + ".word, " + a + ".word, " + b +
+                              ".word, " + std::to_string( words( bits ) ) + ", " +
+                              std::to_string( bits ) + " );" );
+                    }
+                    else
+                    {
+                        line( t + " = cjel_divs( " + a + ", " + b + ", " + std::to_string( bits ) +
+                              " ) & " + number( mask( bits ) ) + ";" );
+                    }
+                    break;
+                }
+                case Value::MODU_INSTRUCTION:
+                {
+                    const auto a = expression( *instr.operand( 0 ) );
+                    const auto b = expression( *instr.operand( 1 ) );
+                    const auto t = temporary( instr );
+
+                    if( wide( instr.type() ) )
+                    {
+                        line( "cjel_wide_modu( " + t + ".word, " + a + ".word, " + b +
+                              ".word, " + std::to_string( words( instr.type().bitsize() ) ) +
+                              " );" );
+                    }
+                    else
+                    {
+                        line( t + " = cjel_modu( " + a + ", " + b + " );" );
+                    }
+                    break;
+                }
+                case Value::EQU_INSTRUCTION:
+                {
+                    compare( instr, "==", "" );
+                    break;
+                }
+                case Value::NEQ_INSTRUCTION:
+                {
+                    compare( instr, "!=", "!" );
+                    break;
+                }
+                default:
+                {
+                    throw std::domain_error(
+                        "C11 backend does not support instruction '" + instr.name() + "'" );
+                }
+            }
+        }
+
+        void bitwise( const Instruction& instr, const char* op, const char* helper )
+        {
+            const auto a = expression( *instr.operand( 0 ) );
+            const auto b = expression( *instr.operand( 1 ) );
+            const auto t = temporary( instr );
+
+            if( wide( instr.type() ) )
+            {
+                line( std::string( "cjel_wide_" ) + helper + "( " + t + ".word, " + a +
+                      ".word, " + b + ".word, " +
+                      std::to_string( words( instr.type().bitsize() ) ) + " );" );
+            }
+            else
+            {
+                line( t + " = " + a + " " + op + " " + b + ";" );
+            }
+        }
+
+        void compare( const Instruction& instr, const char* op, const char* negation )
+        {
+            const auto& lhs = *instr.operand( 0 );
+            const auto a = expression( lhs );
+            const auto b = expression( *instr.operand( 1 ) );
+            const auto t = temporary( instr );
+
+            if( wide( lhs.type() ) )
+            {
+                line( t + " = " + negation + "cjel_wide_equ( " + a + ".word, " + b + ".word, " +
+                      std::to_string( words( lhs.type().bitsize() ) ) + " );" );
+            }
+            else
+            {
+                line( t + " = " + a + " " + op + " " + b + ";" );
+            }
+        }
+
+        void extract( const Instruction& instr )
+        {
+            const auto& src = *instr.operand( 0 );
+            const auto& index = *instr.operand( 1 );
+
+            if( isa< Memory >( src ) )
+            {
+                if( wide( index.type() ) )
+                {
+                    throw std::domain_error( "memory index of '" + src.name() +
+                                             "' exceeds 64 bits" );
+                }
+
+                const auto length = static_cast< const Memory& >( src ).length();
+                const auto name = "v_" + std::to_string( m_temporaries++ );
+                m_declarations += "    uint64_t " + name + ";\n";
+
+                line( name + " = cjel_index( " + expression( index ) + ", " + number( length ) +
+                      " );" );
+                m_names.emplace( &instr, identifier( src.name() ) + "[ " + name + " ]" );
+                return;
+            }
+
+            if( not src.type().isStructure() or not isa< BitConstant >( index ) )
+            {
+                throw std::domain_error(
+                    "C11 backend supports constant element extraction of structures only" );
+            }
+
+            const auto& kind = static_cast< const StructureType& >( src.type() ).kind();
+            const auto element = static_cast< const BitConstant& >( index ).value().value();
+            const auto& elements = kind.elements();
+
+            if( element >= elements.size() )
+            {
+                throw std::domain_error( "element '" + std::to_string( element ) +
+                                         "' is out of range of '" + kind.name() + "'" );
+            }
+
+            m_names.emplace( &instr, expression( src ) + "." +
+                                         identifier( std::get< 1 >( elements[ element ] ) ) );
+        }
+
+        const Function& m_function;
+
+        TypeEmitter& m_types;
+
+        std::unordered_map< const Value*, std::string > m_names;
+
+        std::string m_declarations;
+
+        std::string m_body;
+
+        u32 m_temporaries;
+
+        u32 m_indention;
+    };
+}
+
+std::string CjelIRToC11Pass::emit( const Module& module, ThreadPool& pool )
+{
+    TypeEmitter types;
+    std::string structures;
+    std::string globals;
+    std::string prototypes;
+
+    for( const auto& value : module.get< Structure >() )
+    {
+        const auto& structure = static_cast< const Structure& >( *value );
+
+        structures += "struct CJEL_PACKED " + identifier( structure.name() ) + "\n{\n";
+        for( const auto& element : structure.elements() )
+        {
+            structures += "    " + types.name( *std::get< 0 >( element ) ) + " " +
+                          identifier( std::get< 1 >( element ) ) + ";\n";
+        }
+        structures += "};\n\n";
+    }
+
+    for( const auto& value : module.get< Variable >() )
+    {
+        const auto& variable = static_cast< const Variable& >( *value );
+        const auto expression = variable.expression();
+
+        if( not isa< BitConstant >( expression ) )
+        {
+            throw std::domain_error(
+                "C11 backend supports bit constant initialized variables only" );
+        }
+
+        globals += "static " + types.name( variable.type() ) + " " +
+                   identifier( variable.name() ) + " = " +
+                   types.literal( variable.type(),
+                       static_cast< const BitConstant& >( *expression ).value().value() ) +
+                   ";\n";
+    }
+
+    for( const auto& value : module.get< Memory >() )
+    {
+        const auto& memory = static_cast< const Memory& >( *value );
+
+        globals += "static " + types.name( *memory.type().results()[ 0 ] ) + " " +
+                   identifier( memory.name() ) + "[ " + std::to_string( memory.length() ) +
+                   " ];\n";
+    }
+
+    for( const auto& value : module.get< Intrinsic >() )
+    {
+        prototypes +=
+            "extern " + types.signature( static_cast< const CallableUnit& >( *value ) ) + ";\n";
+    }
+
+    const auto& functions = module.get< Function >();
+    for( const auto& value : functions )
+    {
+        prototypes += types.signature( static_cast< const CallableUnit& >( *value ) ) + ";\n";
+    }
+
+    std::vector< std::string > bodies( functions.size() );
+    std::vector< TypeEmitter > used( functions.size() );
+
+    pool.parallel( functions.size(), [&functions, &bodies, &used]( u32 index ) {
+        const auto& function = static_cast< const Function& >( *functions[ index ] );
+        if( not function.context() )
+        {
+            throw std::domain_error( "function '" + function.name() + "' has no context" );
+        }
+
+        FunctionEmitter emitter( function, used[ index ] );
+        bodies[ index ] = emitter.emit();
+    } );
+
+    for( const auto& other : used )
+    {
+        types.merge( other );
+    }
+
+    std::string result = "/* module '" + module.name() + "', generated by libcjel-ir */\n\n";
+    result += PRELUDE;
+    result += "\n";
+    result += types.definitions();
+    result += structures;
+
+    if( not globals.empty() )
+    {
+        result += globals + "\n";
+    }
+
+    if( not prototypes.empty() )
+    {
+        result += prototypes + "\n";
+    }
+
+    for( const auto& body : bodies )
+    {
+        result += body + "\n";
+    }
+
+    return result;
+}
+
+std::string CjelIRToC11Pass::emit( const Module& module )
+{
+    return emit( module, ThreadPool::shared() );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,915 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRToLLPass.h"
+
+#include <libcjel-ir/Constant>
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Memory>
+#include <libcjel-ir/Reference>
+#include <libcjel-ir/Scope>
+#include <libcjel-ir/Statement>
+#include <libcjel-ir/Structure>
+#include <libcjel-ir/Variable>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <fstream>
+
+using namespace libcjel_ir;
+
+char CjelIRToLLPass::id = 0;
+
+static libpass::PassRegistration< CjelIRToLLPass > PASS(
+    "CJEL IR to LLVM IR Pass", "emits the CJEL IR as textual LLVM IR", "el2ll", 0 );
+
+bool CjelIRToLLPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRToLLPass >();
+    assert( data );
+
+    try
+    {
+        const auto source = emit( *data->module() );
+
+        std::ofstream file( data->filename(), std::ios::trunc );
+        file << source;
+
+        if( not file )
+        {
+            fprintf( stderr, "unable to write LLVM IR '%s'\n", data->filename().c_str() );
+            return false;
+        }
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful LLVM IR code generation: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    /**
+       append-only text buffer, numbers are formatted in place without
+       temporary strings
+    */
+
+    class Writer
+    {
+      public:
+        Writer( void )
+        {
+            m_buffer.reserve( 4096 );
+        }
+
+        Writer& operator<<( const char* text )
+        {
+            m_buffer.append( text );
+            return *this;
+        }
+
+        Writer& operator<<( const std::string& text )
+        {
+            m_buffer.append( text );
+            return *this;
+        }
+
+        Writer& operator<<( char c )
+        {
+            m_buffer.push_back( c );
+            return *this;
+        }
+
+        Writer& operator<<( u32 value )
+        {
+            return *this << (u64)value;
+        }
+
+        Writer& operator<<( u64 value )
+        {
+            char digits[ 20 ];
+            u32 length = 0;
+            do
+            {
+                digits[ length++ ] = '0' + ( value % 10 );
+                value /= 10;
+            } while( value );
+
+            while( length )
+            {
+                m_buffer.push_back( digits[ --length ] );
+            }
+            return *this;
+        }
+
+        std::string& str( void )
+        {
+            return m_buffer;
+        }
+
+      private:
+        std::string m_buffer;
+    };
+
+    /**
+       LLVM identifiers of the form '[-a-zA-Z$._][-a-zA-Z$._0-9]*' are
+       emitted as is, all others are quoted
+    */
+
+    std::string symbol( char prefix, const std::string& name )
+    {
+        u1 plain = not name.empty() and not( name[ 0 ] >= '0' and name[ 0 ] <= '9' );
+        for( const auto c : name )
+        {
+            plain = plain and ( ( c >= 'a' and c <= 'z' ) or ( c >= 'A' and c <= 'Z' ) or
+                                  ( c >= '0' and c <= '9' ) or c == '-' or c == '$' or
+                                  c == '.' or c == '_' );
+        }
+
+        if( plain )
+        {
+            return prefix + name;
+        }
+
+        static const char* HEX = "0123456789ABCDEF";
+        std::string result = std::string( 1, prefix ) + "\"";
+        for( const auto c : name )
+        {
+            if( c == '"' or c == '\\' or c < ' ' )
+            {
+                result += '\\';
+                result += HEX[ ( c >> 4 ) & 0xf ];
+                result += HEX[ c & 0xf ];
+            }
+            else
+            {
+                result += c;
+            }
+        }
+        return result + "\"";
+    }
+
+    std::string type( const Type& type )
+    {
+        if( type.isBit() )
+        {
+            return "i" + std::to_string( type.bitsize() );
+        }
+
+        if( type.isStructure() )
+        {
+            return symbol( '%', static_cast< const StructureType& >( type ).kind().name() );
+        }
+
+        throw std::domain_error( "LLVM IR backend does not support type '" + type.name() + "'" );
+    }
+
+    class FunctionEmitter
+    {
+      public:
+        FunctionEmitter( const Function& function )
+        : m_function( function )
+        , m_temporaries( 0 )
+        , m_labels( 0 )
+        , m_trap( false )
+        {
+        }
+
+        std::string emit( void )
+        {
+            Writer header;
+            header << "define void " << symbol( '@', m_function.name() ) << "(";
+
+            const char* separator = "";
+            for( const auto& references : { m_function.inputs(), m_function.outputs() } )
+            {
+                for( const auto& reference : references )
+                {
+                    const auto name = symbol( '%', reference->name() );
+                    m_pointers.emplace( reference.get(), name );
+                    header << separator << "ptr " << name;
+                    separator = ", ";
+                }
+            }
+            header << ") {\nentry:\n";
+
+            for( const auto& reference : m_function.linkage() )
+            {
+                const auto name = symbol( '%', reference->name() );
+                m_pointers.emplace( reference.get(), name );
+                allocate( name, reference->type() );
+            }
+
+            blocks( *m_function.context() );
+
+            m_body << "  ret void\n";
+
+            if( m_trap )
+            {
+                m_body << "\ntrap:\n  call void @llvm.trap()\n  unreachable\n";
+            }
+
+            header << m_entry.str() << m_body.str() << "}\n";
+            return std::move( header.str() );
+        }
+
+        u1 trap( void ) const
+        {
+            return m_trap;
+        }
+
+      private:
+        std::string temporary( void )
+        {
+            return "%." + std::to_string( m_temporaries++ );
+        }
+
+        std::string label( void )
+        {
+            return "bb." + std::to_string( m_labels++ );
+        }
+
+        void begin( const std::string& label )
+        {
+            m_body << "\n" << label << ":\n";
+        }
+
+        void allocate( const std::string& name, const Type& type )
+        {
+            const auto t = ::type( type );
+            m_entry << "  " << name << " = alloca " << t << "\n";
+            m_body << "  store " << t << " zeroinitializer, ptr " << name << "\n";
+        }
+
+        std::string pointer( const Value& value )
+        {
+            const auto result = m_pointers.find( &value );
+            if( result != m_pointers.end() )
+            {
+                return result->second;
+            }
+
+            if( isa< Variable >( value ) or isa< Memory >( value ) )
+            {
+                return symbol( '@', value.name() );
+            }
+
+            throw std::domain_error( "value '" + value.name() + "' is not addressable" );
+        }
+
+        std::string value( const Value& value )
+        {
+            const auto result = m_values.find( &value );
+            if( result != m_values.end() )
+            {
+                return result->second;
+            }
+
+            if( isa< BitConstant >( value ) )
+            {
+                return std::to_string(
+                    static_cast< const BitConstant& >( value ).value().value() );
+            }
+
+            if( m_pointers.count( &value ) or isa< Variable >( value ) )
+            {
+                const auto p = pointer( value );
+                const auto t = temporary();
+                m_body << "  " << t << " = load " << type( value.type() ) << ", ptr " << p << "\n";
+                return t;
+            }
+
+            throw std::domain_error(
+                "value '" + value.name() + "' is used before its definition" );
+        }
+
+        /**
+           branches to the trap block if 'condition' holds
+        */
+
+        void check( const std::string& condition )
+        {
+            const auto next = label();
+            m_body << "  br i1 " << condition << ", label %trap, label %" << next << "\n";
+            begin( next );
+            m_trap = true;
+        }
+
+        std::string widen( const std::string& condition, const Type& result )
+        {
+            if( result.bitsize() == 1 )
+            {
+                return condition;
+            }
+
+            const auto t = temporary();
+            m_body << "  " << t << " = zext i1 " << condition << " to " << type( result ) << "\n";
+            return t;
+        }
+
+        std::string condition( const Value& value )
+        {
+            const auto v = this->value( value );
+            if( value.type().bitsize() == 1 )
+            {
+                return v;
+            }
+
+            const auto t = temporary();
+            m_body << "  " << t << " = icmp ne " << type( value.type() ) << " " << v << ", 0\n";
+            return t;
+        }
+
+        void scope( const Scope& scope )
+        {
+            blocks( scope );
+        }
+
+        void blocks( const Scope& scope )
+        {
+            for( const auto& child : scope.blocks() )
+            {
+                if( isa< Scope >( child ) )
+                {
+                    this->scope( static_cast< const Scope& >( *child ) );
+                }
+                else
+                {
+                    statement( static_cast< const Statement& >( *child ) );
+                }
+            }
+        }
+
+        void statement( const Statement& statement )
+        {
+            const auto& instructions = statement.instructions();
+            if( instructions.size() == 0 )
+            {
+                throw std::domain_error( "a statement must contain at least one instruction" );
+            }
+
+            if( isa< TrivialStatement >( statement ) )
+            {
+                for( const auto& instr : instructions )
+                {
+                    instruction( *instr );
+                }
+                return;
+            }
+
+            const auto& scopes = statement.scopes();
+            if( scopes.size() == 0 )
+            {
+                throw std::domain_error( "statement '" + statement.name() + "' has no scope" );
+            }
+
+            const auto& last = *instructions[ instructions.size() - 1 ];
+
+            if( isa< LoopStatement >( statement ) )
+            {
+                const auto head = label();
+                const auto body = label();
+                const auto end = label();
+
+                m_body << "  br label %" << head << "\n";
+                begin( head );
+                for( const auto& instr : instructions )
+                {
+                    instruction( *instr );
+                }
+                m_body << "  br i1 " << condition( last ) << ", label %" << body << ", label %"
+                       << end << "\n";
+
+                begin( body );
+                scope( *scopes[ 0 ] );
+                m_body << "  br label %" << head << "\n";
+                begin( end );
+                return;
+            }
+
+            for( const auto& instr : instructions )
+            {
+                instruction( *instr );
+            }
+
+            if( m_values.count( &last ) == 0 )
+            {
+                throw std::domain_error( "last instruction of statement '" + statement.name() +
+                                         "' does not produce a condition" );
+            }
+
+            if( scopes.size() <= 2 )
+            {
+                const auto then = label();
+                const auto otherwise = label();
+                const auto end = scopes.size() == 2 ? label() : otherwise;
+
+                m_body << "  br i1 " << condition( last ) << ", label %" << then << ", label %"
+                       << otherwise << "\n";
+
+                begin( then );
+                scope( *scopes[ 0 ] );
+                m_body << "  br label %" << end << "\n";
+
+                if( scopes.size() == 2 )
+                {
+                    begin( otherwise );
+                    scope( *scopes[ 1 ] );
+                    m_body << "  br label %" << end << "\n";
+                }
+
+                begin( end );
+            }
+            else
+            {
+                const auto t = type( last.type() );
+                std::vector< std::string > cases;
+
+                for( u32 c = 0; c < scopes.size(); c++ )
+                {
+                    cases.emplace_back( label() );
+                }
+                const auto end = label();
+
+                m_body << "  switch " << t << " " << value( last ) << ", label %" << end << " [\n";
+                for( u32 c = 0; c < scopes.size(); c++ )
+                {
+                    m_body << "    " << t << " " << c << ", label %" << cases[ c ] << "\n";
+                }
+                m_body << "  ]\n";
+
+                for( u32 c = 0; c < scopes.size(); c++ )
+                {
+                    begin( cases[ c ] );
+                    scope( *scopes[ c ] );
+                    m_body << "  br label %" << end << "\n";
+                }
+
+                begin( end );
+            }
+        }
+
+        void instruction( const Instruction& instr )
+        {
+            switch( instr.id() )
+            {
+                case Value::NOP_INSTRUCTION:
+                {
+                    break;
+                }
+                case Value::ALLOC_INSTRUCTION:
+                {
+                    const auto t = temporary();
+                    allocate( t, instr.type() );
+                    m_pointers.emplace( &instr, t );
+                    break;
+                }
+                case Value::LOAD_INSTRUCTION:
+                {
+                    const auto p = pointer( *instr.operand( 0 ) );
+                    const auto t = temporary();
+                    m_body << "  " << t << " = load " << type( instr.type() ) << ", ptr " << p
+                           << "\n";
+                    m_values.emplace( &instr, t );
+                    break;
+                }
+                case Value::STORE_INSTRUCTION:
+                {
+                    const auto& src = *instr.operand( 0 );
+                    const auto v = value( src );
+                    m_body << "  store " << type( src.type() ) << " " << v << ", ptr "
+                           << pointer( *instr.operand( 1 ) ) << "\n";
+                    break;
+                }
+                case Value::EXTRACT_INSTRUCTION:
+                {
+                    extract( instr );
+                    break;
+                }
+                case Value::CALL_INSTRUCTION:
+                {
+                    call( instr );
+                    break;
+                }
+                case Value::ZEXT_INSTRUCTION:
+                {
+                    cast( instr, "zext" );
+                    break;
+                }
+                case Value::TRUNC_INSTRUCTION:
+                {
+                    cast( instr, "trunc" );
+                    break;
+                }
+                case Value::NOT_INSTRUCTION:
+                {
+                    const auto a = value( *instr.operand( 0 ) );
+                    const auto t = temporary();
+                    m_body << "  " << t << " = xor " << type( instr.type() ) << " " << a
+                           << ", -1\n";
+                    m_values.emplace( &instr, t );
+                    break;
+                }
+                case Value::LNOT_INSTRUCTION:
+                {
+                    const auto& src = *instr.operand( 0 );
+                    const auto a = value( src );
+                    const auto c = temporary();
+                    m_body << "  " << c << " = icmp eq " << type( src.type() ) << " " << a
+                           << ", 0\n";
+                    m_values.emplace( &instr, widen( c, instr.type() ) );
+                    break;
+                }
+                case Value::AND_INSTRUCTION:
+                {
+                    binary( instr, "and" );
+                    break;
+                }
+                case Value::OR_INSTRUCTION:
+                {
+                    binary( instr, "or" );
+                    break;
+                }
+                case Value::XOR_INSTRUCTION:
+                {
+                    binary( instr, "xor" );
+                    break;
+                }
+                case Value::ADDS_INSTRUCTION:  // fall-through, equal in two's complement
+                case Value::ADDU_INSTRUCTION:
+                {
+                    binary( instr, "add" );
+                    break;
+                }
+                case Value::DIVS_INSTRUCTION:
+                {
+                    const auto t = type( instr.type() );
+                    const auto a = value( *instr.operand( 0 ) );
+                    const auto b = value( *instr.operand( 1 ) );
+                    zero( t, b );
+
+                    // 'sdiv' of the minimum by -1 is undefined, it wraps to the minimum
+                    const auto m = temporary();
+                    const auto d = temporary();
+                    const auto q = temporary();
+                    const auto n = temporary();
+                    const auto r = temporary();
+                    m_body << "  " << m << " = icmp eq " << t << " " << b << ", -1\n";
+                    m_body << "  " << d << " = select i1 " << m << ", " << t << " 1, " << t << " "
+                           << b << "\n";
+                    m_body << "  " << q << " = sdiv " << t << " " << a << ", " << d << "\n";
+                    m_body << "  " << n << " = sub " << t << " 0, " << a << "\n";
+                    m_body << "  " << r << " = select i1 " << m << ", " << t << " " << n << ", "
+                           << t << " " << q << "\n";
+                    m_values.emplace( &instr, r );
+                    break;
+                }
+                case Value::MODU_INSTRUCTION:
+                {
+                    const auto t = type( instr.type() );
+                    const auto a = value( *instr.operand( 0 ) );
+                    const auto b = value( *instr.operand( 1 ) );
+                    zero( t, b );
+
+                    const auto r = temporary();
+                    m_body << "  " << r << " = urem " << t << " " << a << ", " << b << "\n";
+                    m_values.emplace( &instr, r );
+                    break;
+                }
+                case Value::EQU_INSTRUCTION:
+                {
+                    compare( instr, "eq" );
+                    break;
+                }
+                case Value::NEQ_INSTRUCTION:
+                {
+                    compare( instr, "ne" );
+                    break;
+                }
+                default:
+                {
+                    throw std::domain_error(
+                        "LLVM IR backend does not support instruction '" + instr.name() + "'" );
+                }
+            }
+        }
+
+        void zero( const std::string& t, const std::string& divisor )
+        {
+            const auto c = temporary();
+            m_body << "  " << c << " = icmp eq " << t << " " << divisor << ", 0\n";
+            check( c );
+        }
+
+        void binary( const Instruction& instr, const char* op )
+        {
+            const auto a = value( *instr.operand( 0 ) );
+            const auto b = value( *instr.operand( 1 ) );
+            const auto t = temporary();
+            m_body << "  " << t << " = " << op << " " << type( instr.type() ) << " " << a << ", "
+                   << b << "\n";
+            m_values.emplace( &instr, t );
+        }
+
+        void compare( const Instruction& instr, const char* predicate )
+        {
+            const auto& lhs = *instr.operand( 0 );
+            const auto a = value( lhs );
+            const auto b = value( *instr.operand( 1 ) );
+            const auto c = temporary();
+            m_body << "  " << c << " = icmp " << predicate << " " << type( lhs.type() ) << " "
+                   << a << ", " << b << "\n";
+            m_values.emplace( &instr, widen( c, instr.type() ) );
+        }
+
+        void cast( const Instruction& instr, const char* op )
+        {
+            const auto& src = *instr.operand( 0 );
+            const auto a = value( src );
+
+            if( src.type().bitsize() == instr.type().bitsize() )
+            {
+                m_values.emplace( &instr, a );
+                return;
+            }
+
+            const auto t = temporary();
+            m_body << "  " << t << " = " << op << " " << type( src.type() ) << " " << a << " to "
+                   << type( instr.type() ) << "\n";
+            m_values.emplace( &instr, t );
+        }
+
+        void call( const Instruction& instr )
+        {
+            const auto& callee = static_cast< const CallableUnit& >( *instr.operand( 0 ) );
+            const auto& inputs = callee.inputs();
+
+            if( instr.operands().size() != inputs.size() + 1 )
+            {
+                throw std::domain_error( "call of '" + callee.name() + "' has " +
+                                         std::to_string( instr.operands().size() - 1 ) +
+                                         " arguments, expected " +
+                                         std::to_string( inputs.size() ) );
+            }
+
+            // inputs are passed by value, therefore every argument is copied
+            std::string arguments;
+            for( u32 c = 0; c < inputs.size(); c++ )
+            {
+                const auto& argument = *instr.operand( c + 1 );
+                const auto v = value( argument );
+                const auto p = temporary();
+                const auto t = type( inputs[ c ]->type() );
+
+                m_entry << "  " << p << " = alloca " << t << "\n";
+                m_body << "  store " << t << " " << v << ", ptr " << p << "\n";
+                arguments += ( c ? ", ptr " : "ptr " ) + p;
+            }
+
+            for( const auto& output : callee.outputs() )
+            {
+                const auto p = temporary();
+                m_entry << "  " << p << " = alloca " << type( output->type() ) << "\n";
+                arguments += ( arguments.empty() ? "ptr " : ", ptr " ) + p;
+
+                if( not m_pointers.count( &instr ) )
+                {
+                    m_pointers.emplace( &instr, p );
+                }
+            }
+
+            m_body << "  call void " << symbol( '@', callee.name() ) << "(" << arguments << ")\n";
+        }
+
+        void extract( const Instruction& instr )
+        {
+            const auto& src = *instr.operand( 0 );
+            const auto& index = *instr.operand( 1 );
+
+            if( isa< Memory >( src ) )
+            {
+                const auto& memory = static_cast< const Memory& >( src );
+                const auto bits = index.type().bitsize();
+                auto i = value( index );
+
+                if( bits < 64 )
+                {
+                    const auto t = temporary();
+                    m_body << "  " << t << " = zext " << type( index.type() ) << " " << i
+                           << " to i64\n";
+                    i = t;
+                }
+
+                const auto c = temporary();
+                m_body << "  " << c << " = icmp uge i" << ( bits < 64 ? 64 : bits ) << " " << i
+                       << ", " << memory.length() << "\n";
+                check( c );
+
+                if( bits > 64 )
+                {
+                    const auto t = temporary();
+                    m_body << "  " << t << " = trunc " << type( index.type() ) << " " << i
+                           << " to i64\n";
+                    i = t;
+                }
+
+                const auto p = temporary();
+                m_body << "  " << p << " = getelementptr inbounds [" << memory.length() << " x "
+                       << type( *memory.type().results()[ 0 ] ) << "], ptr "
+                       << symbol( '@', memory.name() ) << ", i64 0, i64 " << i << "\n";
+                m_pointers.emplace( &instr, p );
+                return;
+            }
+
+            if( not src.type().isStructure() or not isa< BitConstant >( index ) )
+            {
+                throw std::domain_error(
+                    "LLVM IR backend supports constant element extraction of structures only" );
+            }
+
+            const auto element = static_cast< const BitConstant& >( index ).value().value();
+            const auto& kind = static_cast< const StructureType& >( src.type() ).kind();
+
+            if( element >= kind.elements().size() )
+            {
+                throw std::domain_error( "element '" + std::to_string( element ) +
+                                         "' is out of range of '" + kind.name() + "'" );
+            }
+
+            const auto p = temporary();
+            m_body << "  " << p << " = getelementptr inbounds " << type( src.type() ) << ", ptr "
+                   << pointer( src ) << ", i32 0, i32 " << element << "\n";
+            m_pointers.emplace( &instr, p );
+        }
+
+        const Function& m_function;
+
+        std::unordered_map< const Value*, std::string > m_pointers;
+
+        std::unordered_map< const Value*, std::string > m_values;
+
+        Writer m_entry;
+
+        Writer m_body;
+
+        u32 m_temporaries;
+
+        u32 m_labels;
+
+        u1 m_trap;
+    };
+}
+
+std::string CjelIRToLLPass::emit( const Module& module, ThreadPool& pool )
+{
+    Writer result;
+    result << "; ModuleID = '" << module.name() << "'\n";
+    result << "source_filename = \"" << module.name() << "\"\n\n";
+
+    const auto& structures = module.get< Structure >();
+    for( const auto& value : structures )
+    {
+        const auto& structure = static_cast< const Structure& >( *value );
+
+        result << symbol( '%', structure.name() ) << " = type <{ ";
+        const char* separator = "";
+        for( const auto& element : structure.elements() )
+        {
+            result << separator << type( *std::get< 0 >( element ) );
+            separator = ", ";
+        }
+        result << " }>\n";
+    }
+    result << ( structures.size() ? "\n" : "" );
+
+    const auto& variables = module.get< Variable >();
+    for( const auto& value : variables )
+    {
+        const auto& variable = static_cast< const Variable& >( *value );
+        const auto expression = variable.expression();
+
+        if( not isa< BitConstant >( expression ) )
+        {
+            throw std::domain_error(
+                "LLVM IR backend supports bit constant initialized variables only" );
+        }
+
+        result << symbol( '@', variable.name() ) << " = internal global "
+               << type( variable.type() ) << " "
+               << static_cast< const BitConstant& >( *expression ).value().value() << "\n";
+    }
+
+    const auto& memories = module.get< Memory >();
+    for( const auto& value : memories )
+    {
+        const auto& memory = static_cast< const Memory& >( *value );
+
+        result << symbol( '@', memory.name() ) << " = internal global [" << memory.length()
+               << " x " << type( *memory.type().results()[ 0 ] ) << "] zeroinitializer\n";
+    }
+    result << ( variables.size() + memories.size() ? "\n" : "" );
+
+    const auto& intrinsics = module.get< Intrinsic >();
+    for( const auto& value : intrinsics )
+    {
+        const auto& intrinsic = static_cast< const CallableUnit& >( *value );
+
+        result << "declare void " << symbol( '@', intrinsic.name() ) << "(";
+        const u32 count = intrinsic.inputs().size() + intrinsic.outputs().size();
+        for( u32 c = 0; c < count; c++ )
+        {
+            result << ( c ? ", ptr" : "ptr" );
+        }
+        result << ")\n";
+    }
+    result << ( intrinsics.size() ? "\n" : "" );
+
+    const auto& functions = module.get< Function >();
+    std::vector< std::string > bodies( functions.size() );
+    std::vector< u8 > traps( functions.size(), false );
+
+    pool.parallel( functions.size(), [&functions, &bodies, &traps]( u32 index ) {
+        const auto& function = static_cast< const Function& >( *functions[ index ] );
+        if( not function.context() )
+        {
+            throw std::domain_error( "function '" + function.name() + "' has no context" );
+        }
+
+        FunctionEmitter emitter( function );
+        bodies[ index ] = emitter.emit();
+        traps[ index ] = emitter.trap();
+    } );
+
+    u1 trap = false;
+    for( u32 c = 0; c < functions.size(); c++ )
+    {
+        result << bodies[ c ] << "\n";
+        trap = trap or traps[ c ];
+    }
+
+    if( trap )
+    {
+        result << "declare void @llvm.trap() cold noreturn nounwind\n";
+    }
+
+    return std::move( result.str() );
+}
+
+std::string CjelIRToLLPass::emit( const Module& module )
+{
+    return emit( module, ThreadPool::shared() );
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,292 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#include "CjelIRValueNumberingPass.h"
+
+#include <libcjel-ir/Function>
+#include <libcjel-ir/Instruction>
+#include <libcjel-ir/Intrinsic>
+#include <libcjel-ir/Statement>
+
+#include <libpass/PassRegistry>
+
+#include <cassert>
+#include <cstdio>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace libcjel_ir;
+
+char CjelIRValueNumberingPass::id = 0;
+
+static libpass::PassRegistration< CjelIRValueNumberingPass > PASS(
+    "CJEL IR Value Numbering Pass", "eliminates redundant instructions", "el-gvn", 0 );
+
+bool CjelIRValueNumberingPass::run( libpass::PassResult& pr )
+{
+    auto data = pr.result< CjelIRValueNumberingPass >();
+    assert( data );
+
+    try
+    {
+        data->setRemoved( eliminate( *data->module() ) );
+    }
+    catch( const std::exception& e )
+    {
+        fprintf( stderr, "unsuccessful EL value numbering: %s\n", e.what() );
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    /**
+       scoped value table, every insertion is logged and a scope rolls the
+       log back to its mark on exit
+    */
+
+    class Numbering
+    {
+      public:
+        Numbering( void )
+        : m_generation( 0 )
+        , m_removed( 0 )
+        {
+        }
+
+        u64 removed( void ) const
+        {
+            return m_removed;
+        }
+
+        void scope( const Scope& scope )
+        {
+            const auto mark = m_log.size();
+            const u1 parallel = isa< ParallelScope >( scope );
+
+            for( const auto& block : scope.blocks() )
+            {
+                if( isa< Scope >( block ) )
+                {
+                    this->scope( static_cast< const Scope& >( *block ) );
+                }
+                else
+                {
+                    statement( static_cast< Statement& >( *block ) );
+                }
+
+                if( parallel )
+                {
+                    rollback( mark );
+                }
+            }
+
+            rollback( mark );
+        }
+
+      private:
+        struct Entry
+        {
+            Instruction::Ptr instruction;
+            u64 generation;
+        };
+
+        void statement( Statement& statement )
+        {
+            const auto& instructions = statement.instructions();
+
+            // the last instruction of a branch or loop statement is its
+            // condition, the stores of a loop body reach its next header
+            const Instruction* condition = nullptr;
+            if( not isa< TrivialStatement >( statement ) and instructions.size() > 0 )
+            {
+                condition = ( instructions.begin() + ( instructions.size() - 1 ) )->get();
+            }
+            if( isa< LoopStatement >( statement ) )
+            {
+                m_generation++;
+            }
+
+            for( const auto& instruction : instructions )
+            {
+                value( instruction, instruction.get() == condition );
+            }
+
+            if( not m_redundant.empty() )
+            {
+                m_removed += statement.remove( [this]( const Instruction& instruction ) {
+                    return m_redundant.count( &instruction ) > 0;
+                } );
+                m_redundant.clear();
+            }
+
+            for( const auto& scope : statement.scopes() )
+            {
+                this->scope( *scope );
+            }
+        }
+
+        void value( const Instruction::Ptr& instruction, u1 condition )
+        {
+            auto& instr = *instruction;
+
+            u64 generation = 0;
+            switch( instr.id() )
+            {
+                case Value::STORE_INSTRUCTION:    // fall-through
+                case Value::CALL_INSTRUCTION:     // fall-through
+                case Value::ID_CALL_INSTRUCTION:  // fall-through
+                case Value::STREAM_INSTRUCTION:
+                {
+                    m_generation++;
+                    return;
+                }
+                case Value::NOP_INSTRUCTION:  // fall-through
+                case Value::ALLOC_INSTRUCTION:
+                {
+                    return;
+                }
+                case Value::LOAD_INSTRUCTION:
+                {
+                    generation = m_generation;
+                    break;
+                }
+                default:
+                {
+                    // storage operands are read like a 'load', the base of an
+                    // 'extract' is only addressed
+                    const auto& operands = instr.operands();
+                    const u32 first = isa< ExtractInstruction >( instr ) ? 1 : 0;
+                    for( u32 c = first; c < operands.size(); c++ )
+                    {
+                        if( Instruction::storage( *operands[ c ] ) )
+                        {
+                            generation = m_generation;
+                            break;
+                        }
+                    }
+                    break;
+                }
+            }
+
+            const auto hash = libstdhl::Hash::combine( instr.hash(), generation );
+            auto& bucket = m_table[ hash ];
+
+            for( const auto& entry : bucket )
+            {
+                if( entry.generation == generation and entry.instruction->congruent( instr ) )
+                {
+                    if( not condition )
+                    {
+                        instr.replaceAllUsesWith( entry.instruction );
+                        m_redundant.emplace( &instr );
+                    }
+                    return;
+                }
+            }
+
+            bucket.emplace_back( Entry{ instruction, generation } );
+            m_log.emplace_back( hash );
+        }
+
+        void rollback( std::size_t mark )
+        {
+            while( m_log.size() > mark )
+            {
+                // the log is a stack, the entry of a hash is the last one in its bucket
+                const auto result = m_table.find( m_log.back() );
+                assert( result != m_table.end() and not result->second.empty() );
+
+                result->second.pop_back();
+                if( result->second.empty() )
+                {
+                    m_table.erase( result );
+                }
+                m_log.pop_back();
+            }
+        }
+
+        std::unordered_map< std::size_t, std::vector< Entry > > m_table;
+        std::vector< std::size_t > m_log;
+        std::unordered_set< const Instruction* > m_redundant;
+
+        u64 m_generation;
+        u64 m_removed;
+    };
+}
+
+u64 CjelIRValueNumberingPass::eliminate( const Scope& scope )
+{
+    Numbering numbering;
+    numbering.scope( scope );
+    return numbering.removed();
+}
+
+u64 CjelIRValueNumberingPass::eliminate( Module& module )
+{
+    u64 removed = 0;
+
+    for( const auto units : { &module.get< Function >(), &module.get< Intrinsic >() } )
+    {
+        for( const auto& unit : *units )
+        {
+            const auto& context = static_cast< const CallableUnit& >( *unit ).context();
+            if( context )
+            {
+                removed += eliminate( *context );
+            }
+        }
+    }
+
+    return removed;
+}
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//
@@ -0,0 +1,144 @@
+//
+//  Copyright (C) 2015-2024 CASM Organization <https://casm-lang.org>
+//  All rights reserved.
+//
+//  Developed by: Philipp Paulweber et al.
+//  <https://github.com/casm-lang/libcjel-ir/graphs/contributors>
+//
+//  This file is part of libcjel-ir.
+//
+//  libcjel-ir is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  libcjel-ir is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with libcjel-ir. If not, see <http://www.gnu.org/licenses/>.
+//
+//  Additional permission under GNU GPL version 3 section 7
+//
+//  libcjel-ir is distributed under the terms of the GNU General Public License
+//  with the following clarification and special exception: Linking libcjel-ir
+//  statically or dynamically with other modules is making a combined work
+//  based on libcjel-ir. Thus, the terms and conditions of the GNU General
+//  Public License cover the whole combination. As a special exception,
+//  the copyright holders of libcjel-ir give you permission to link libcjel-ir
+//  with independent modules to produce an executable, regardless of the
+//  license terms of these independent modules, and to copy and distribute
+//  the resulting executable under terms of your choice, provided that you
+//  also meet, for each linked independent module, the terms and conditions
+//  of the license of that module. An independent module is a module which
+//  is not derived from or based on libcjel-ir. If you modify libcjel-ir, you
+//  may extend this exception to your version of the library, but you are
+//  not obliged to do so. If you do not wish to do so, delete this exception
+//  statement from your version.
+//
+
+#ifndef _LIBCJEL_IR_VALUE_NUMBERING_PASS_H_
+#define _LIBCJEL_IR_VALUE_NUMBERING_PASS_H_
+
+#include <libpass/Pass>
+#include <libpass/PassData>
+#include <libpass/PassResult>
+
+#include <libcjel-ir/Module>
+#include <libcjel-ir/Scope>
+
+namespace libcjel_ir
+{
+    /**
+       @brief    eliminates redundant instructions by value numbering
+
+       Instructions are numbered by their structural 'hash' and compared with
+       'congruent'. An instruction is replaced in all its uses by a congruent
+       instruction which is available at its position and removed from its
+       statement. The table is scoped by the block structure in a single walk:
+
+       - an instruction is available to the following instructions of its
+         statement, the following statements of its sequential scope and all
+         scopes nested in them
+       - the blocks of a parallel scope are unordered, no value is shared
+         between them and their values are not available after the scope
+       - the values of a branch or loop scope are not available outside of it
+
+       A 'load', and every instruction reading a storage operand implicitly
+       (see 'Instruction::storage'), is only congruent to an instruction of
+       the same operands without a 'store', 'call', 'icall' or 'stream' in
+       between, and a loop header does not reuse such an instruction from
+       before the loop. 'alloc', 'nop' and the
+       instructions with side effects are never eliminated, neither is the
+       condition of a branch or loop statement. The time is linear in the
+       number of instructions.
+    */
+
+    class CjelIRValueNumberingPass final : public libpass::Pass
+    {
+      public:
+        static char id;
+
+        bool run( libpass::PassResult& pr ) override;
+
+        /**
+           eliminates the redundant instructions of 'scope' and its nested
+           blocks, returns the number of removed instructions
+        */
+
+        static u64 eliminate( const Scope& scope );
+
+        /**
+           eliminates the redundant instructions of every function and
+           intrinsic of 'module', returns the number of removed instructions
+        */
+
+        static u64 eliminate( Module& module );
+
+        class Data : public libpass::PassData
+        {
+          public:
+            using Ptr = std::shared_ptr< Data >;
+
+            Data( const Module::Ptr& module )
+            : m_module( module )
+            , m_removed( 0 )
+            {
+            }
+
+            Module::Ptr module( void ) const
+            {
+                return m_module;
+            }
+
+            u64 removed( void ) const
+            {
+                return m_removed;
+            }
+
+            void setRemoved( u64 removed )
+            {
+                m_removed = removed;
+            }
+
+          private:
+            Module::Ptr m_module;
+
+            u64 m_removed;
+        };
+    };
+}
+
+#endif  // _LIBCJEL_IR_VALUE_NUMBERING_PASS_H_
+
+//
+//  Local variables:
+//  mode: c++
+//  indent-tabs-mode: nil
+//  c-basic-offset: 4
+//  tab-width: 4
+//  End:
+//  vim:noexpandtab:sw=4:ts=4:
+//